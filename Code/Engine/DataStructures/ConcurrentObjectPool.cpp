@@ -0,0 +1,21 @@
+#include "Engine/DataStructures/ConcurrentObjectPool.hpp"
+
+
+
+static std::atomic<size_t> s_NumberOfPoolThreads(0);
+thread_local size_t t_ObjectPoolThreadIndex = INVALID_POOL_THREAD_INDEX;
+thread_local bool t_ObjectPoolThreadIndexAssigned = false;
+
+
+
+size_t GetObjectPoolThreadIndex()
+{
+	if (!t_ObjectPoolThreadIndexAssigned)
+	{
+		size_t newThreadIndex = s_NumberOfPoolThreads.fetch_add(1, std::memory_order_relaxed);
+		t_ObjectPoolThreadIndex = (newThreadIndex < MAXIMUM_NUMBER_OF_POOL_THREADS) ? newThreadIndex : INVALID_POOL_THREAD_INDEX;
+		t_ObjectPoolThreadIndexAssigned = true;
+	}
+
+	return t_ObjectPoolThreadIndex;
+}
\ No newline at end of file
@@ -0,0 +1,244 @@
+#pragma once
+
+#include "Engine/DataStructures/ObjectPool.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+
+
+const size_t MAXIMUM_NUMBER_OF_POOL_THREADS = 64U;
+const size_t OBJECT_POOL_MAGAZINE_SIZE = 32U;
+const size_t INVALID_POOL_THREAD_INDEX = 0xFFFFFFFFU;
+const size_t OBJECT_POOL_PADDING_SIZE = 64U;
+
+
+
+size_t GetObjectPoolThreadIndex();
+
+
+
+struct ObjectPoolMagazine
+{
+	PageNode* m_FreeObjects[OBJECT_POOL_MAGAZINE_SIZE];
+	size_t m_NumberOfFreeObjects;
+	unsigned char m_Padding[OBJECT_POOL_PADDING_SIZE];
+};
+
+
+
+template <typename data_type>
+class ConcurrentObjectPool
+{
+	static_assert(sizeof(data_type) >= sizeof(PageNode), "Pooled objects must be large enough to hold a free list node.");
+
+public:
+	ConcurrentObjectPool() :
+	m_FreeStack(nullptr),
+	m_NumberOfObjectsPerChunk(0),
+	m_MaximumNumberOfObjects(0),
+	m_NumberOfAllocatedObjects(0)
+	{
+		for (size_t threadIndex = 0; threadIndex < MAXIMUM_NUMBER_OF_POOL_THREADS; ++threadIndex)
+		{
+			m_ThreadMagazines[threadIndex].m_NumberOfFreeObjects = 0;
+		}
+	}
+
+	void InitializeObjectPool(const size_t& numberOfObjectsPerChunk, const size_t& maximumNumberOfObjects = 0)
+	{
+		m_NumberOfObjectsPerChunk = (numberOfObjectsPerChunk > 0) ? numberOfObjectsPerChunk : 1;
+		m_MaximumNumberOfObjects = maximumNumberOfObjects;
+
+		m_MutexLock.lock();
+		AllocateNewChunk();
+		m_MutexLock.unlock();
+	}
+
+	void UninitializeObjectPool()
+	{
+		m_MutexLock.lock();
+
+		for (data_type* currentChunk : m_AllChunks)
+		{
+			free(currentChunk);
+		}
+
+		m_AllChunks.clear();
+		m_FreeStack = nullptr;
+		m_NumberOfAllocatedObjects.store(0, std::memory_order_relaxed);
+
+		for (size_t threadIndex = 0; threadIndex < MAXIMUM_NUMBER_OF_POOL_THREADS; ++threadIndex)
+		{
+			m_ThreadMagazines[threadIndex].m_NumberOfFreeObjects = 0;
+		}
+
+		m_MutexLock.unlock();
+	}
+
+	data_type* AllocateObjectFromPool()
+	{
+		PageNode* freeNode = nullptr;
+		size_t threadIndex = GetObjectPoolThreadIndex();
+
+		if (threadIndex != INVALID_POOL_THREAD_INDEX)
+		{
+			ObjectPoolMagazine& threadMagazine = m_ThreadMagazines[threadIndex];
+			if (threadMagazine.m_NumberOfFreeObjects == 0)
+			{
+				RefillMagazine(threadMagazine);
+			}
+
+			if (threadMagazine.m_NumberOfFreeObjects > 0)
+			{
+				freeNode = threadMagazine.m_FreeObjects[--threadMagazine.m_NumberOfFreeObjects];
+			}
+		}
+		else
+		{
+			m_MutexLock.lock();
+			freeNode = PopFreeNode();
+			m_MutexLock.unlock();
+		}
+
+		if (freeNode == nullptr)
+		{
+			return nullptr;
+		}
+
+		data_type* pointerToObject = (data_type*)freeNode;
+		new(pointerToObject)data_type();
+
+		return pointerToObject;
+	}
+
+	void DeallocateObjectToPool(data_type* pointerToObject)
+	{
+		pointerToObject->~data_type();
+		PageNode* nodePointer = (PageNode*)pointerToObject;
+		size_t threadIndex = GetObjectPoolThreadIndex();
+
+		if (threadIndex != INVALID_POOL_THREAD_INDEX)
+		{
+			ObjectPoolMagazine& threadMagazine = m_ThreadMagazines[threadIndex];
+			if (threadMagazine.m_NumberOfFreeObjects == OBJECT_POOL_MAGAZINE_SIZE)
+			{
+				FlushMagazine(threadMagazine, OBJECT_POOL_MAGAZINE_SIZE / 2);
+			}
+
+			threadMagazine.m_FreeObjects[threadMagazine.m_NumberOfFreeObjects++] = nodePointer;
+		}
+		else
+		{
+			m_MutexLock.lock();
+			nodePointer->m_NextNode = m_FreeStack;
+			m_FreeStack = nodePointer;
+			m_MutexLock.unlock();
+		}
+	}
+
+	size_t GetNumberOfAllocatedObjects() const
+	{
+		return m_NumberOfAllocatedObjects.load(std::memory_order_relaxed);
+	}
+
+private:
+	bool AllocateNewChunk()
+	{
+		size_t numberOfAllocatedObjects = m_NumberOfAllocatedObjects.load(std::memory_order_relaxed);
+		size_t numberOfObjectsInChunk = m_NumberOfObjectsPerChunk;
+
+		if (m_MaximumNumberOfObjects > 0)
+		{
+			if (numberOfAllocatedObjects >= m_MaximumNumberOfObjects)
+			{
+				return false;
+			}
+
+			if (numberOfAllocatedObjects + numberOfObjectsInChunk > m_MaximumNumberOfObjects)
+			{
+				numberOfObjectsInChunk = m_MaximumNumberOfObjects - numberOfAllocatedObjects;
+			}
+		}
+
+		data_type* newChunk = (data_type*)malloc(sizeof(data_type) * numberOfObjectsInChunk);
+		if (newChunk == nullptr)
+		{
+			return false;
+		}
+
+		m_AllChunks.push_back(newChunk);
+
+		for (int32_t objectIndex = (int32_t)numberOfObjectsInChunk - 1; objectIndex >= 0; --objectIndex)
+		{
+			PageNode* nodePointer = (PageNode*)&newChunk[objectIndex];
+			nodePointer->m_NextNode = m_FreeStack;
+			m_FreeStack = nodePointer;
+		}
+
+		m_NumberOfAllocatedObjects.store(numberOfAllocatedObjects + numberOfObjectsInChunk, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	PageNode* PopFreeNode()
+	{
+		if (m_FreeStack == nullptr && !AllocateNewChunk())
+		{
+			return nullptr;
+		}
+
+		PageNode* freeNode = m_FreeStack;
+		m_FreeStack = m_FreeStack->m_NextNode;
+
+		return freeNode;
+	}
+
+	void RefillMagazine(ObjectPoolMagazine& threadMagazine)
+	{
+		m_MutexLock.lock();
+
+		while (threadMagazine.m_NumberOfFreeObjects < OBJECT_POOL_MAGAZINE_SIZE / 2)
+		{
+			PageNode* freeNode = PopFreeNode();
+			if (freeNode == nullptr)
+			{
+				break;
+			}
+
+			threadMagazine.m_FreeObjects[threadMagazine.m_NumberOfFreeObjects++] = freeNode;
+		}
+
+		m_MutexLock.unlock();
+	}
+
+	void FlushMagazine(ObjectPoolMagazine& threadMagazine, size_t numberOfObjectsToFlush)
+	{
+		m_MutexLock.lock();
+
+		for (size_t flushIndex = 0; flushIndex < numberOfObjectsToFlush && threadMagazine.m_NumberOfFreeObjects > 0; ++flushIndex)
+		{
+			PageNode* nodePointer = threadMagazine.m_FreeObjects[--threadMagazine.m_NumberOfFreeObjects];
+			nodePointer->m_NextNode = m_FreeStack;
+			m_FreeStack = nodePointer;
+		}
+
+		m_MutexLock.unlock();
+	}
+
+private:
+	ObjectPoolMagazine m_ThreadMagazines[MAXIMUM_NUMBER_OF_POOL_THREADS];
+
+	std::mutex m_MutexLock;
+	PageNode* m_FreeStack;
+	std::vector<data_type*> m_AllChunks;
+
+	size_t m_NumberOfObjectsPerChunk;
+	size_t m_MaximumNumberOfObjects;
+
+	std::atomic<size_t> m_NumberOfAllocatedObjects;
+};
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+
+
+template <size_t NUMBER_OF_BITS>
+class FixedBitset
+{
+public:
+	FixedBitset()
+	{
+		ClearAllBits();
+	}
+
+	void SetBit(size_t bitIndex)
+	{
+		m_BitWords[bitIndex >> 5] |= (1U << (bitIndex & 31U));
+	}
+
+	void ClearBit(size_t bitIndex)
+	{
+		m_BitWords[bitIndex >> 5] &= ~(1U << (bitIndex & 31U));
+	}
+
+	bool IsBitSet(size_t bitIndex) const
+	{
+		return ((m_BitWords[bitIndex >> 5] & (1U << (bitIndex & 31U))) != 0);
+	}
+
+	void ClearAllBits()
+	{
+		memset(m_BitWords, 0, sizeof(m_BitWords));
+	}
+
+	size_t GetNumberOfBits() const
+	{
+		return NUMBER_OF_BITS;
+	}
+
+private:
+	uint32_t m_BitWords[(NUMBER_OF_BITS + 31U) / 32U];
+};
\ No newline at end of file
@@ -45,6 +45,7 @@ public:
 
 	data_type* AllocateObjectFromPool()
 	{
+		GUARANTEE_OR_DIE(m_FreeStack != nullptr, "Object pool exhausted.");
 		++m_NumberOfActiveObjects;
 		
 		data_type* pointerToObject = (data_type*)m_FreeStack;
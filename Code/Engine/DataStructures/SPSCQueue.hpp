@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+
+
+
+const size_t SPSC_QUEUE_PADDING_SIZE = 64U;
+
+
+
+template <typename data_type, size_t QUEUE_CAPACITY>
+class SPSC_Queue
+{
+	static_assert((QUEUE_CAPACITY & (QUEUE_CAPACITY - 1)) == 0, "Queue capacity must be a power of two.");
+
+public:
+	SPSC_Queue() :
+	m_ReadIndex(0U),
+	m_WriteIndex(0U)
+	{
+
+	}
+
+	bool Enqueue(const data_type& nodeData)
+	{
+		size_t writeIndex = m_WriteIndex.load(std::memory_order_relaxed);
+		if (writeIndex - m_ReadIndex.load(std::memory_order_acquire) == QUEUE_CAPACITY)
+		{
+			return false;
+		}
+
+		m_QueueNodes[writeIndex & (QUEUE_CAPACITY - 1)] = nodeData;
+		m_WriteIndex.store(writeIndex + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	bool Dequeue(data_type& dequeuedNodeData)
+	{
+		size_t readIndex = m_ReadIndex.load(std::memory_order_relaxed);
+		if (readIndex == m_WriteIndex.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		dequeuedNodeData = m_QueueNodes[readIndex & (QUEUE_CAPACITY - 1)];
+		m_ReadIndex.store(readIndex + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	size_t QueueSize() const
+	{
+		return m_WriteIndex.load(std::memory_order_acquire) - m_ReadIndex.load(std::memory_order_acquire);
+	}
+
+	bool IsEmpty() const
+	{
+		return (QueueSize() == 0);
+	}
+
+private:
+	unsigned char m_LeadingPadding[SPSC_QUEUE_PADDING_SIZE];
+	std::atomic<size_t> m_ReadIndex;
+	unsigned char m_ReadIndexPadding[SPSC_QUEUE_PADDING_SIZE];
+	std::atomic<size_t> m_WriteIndex;
+	unsigned char m_WriteIndexPadding[SPSC_QUEUE_PADDING_SIZE];
+	data_type m_QueueNodes[QUEUE_CAPACITY];
+	unsigned char m_TrailingPadding[SPSC_QUEUE_PADDING_SIZE];
+};
\ No newline at end of file
@@ -0,0 +1,691 @@
+#include "Engine/DebugTools/LoggerSystem/BinaryLogFormat.hpp"
+#include "Engine/DebugTools/LoggerSystem/LoggerSystem.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+#include "Engine/ErrorHandling/StringUtils.hpp"
+
+#include <ctype.h>
+#include <string.h>
+#include <map>
+
+
+
+const char* FindNextFormatSpecifier(const char* messageFormat, LogFormatSpecifier& formatSpecifier)
+{
+	const char* specifierStart = strchr(messageFormat, '%');
+	if (specifierStart == nullptr)
+	{
+		return nullptr;
+	}
+
+	formatSpecifier.m_SpecifierStart = specifierStart;
+	formatSpecifier.m_NumberOfStarArguments = 0U;
+	formatSpecifier.m_ArgumentType = NO_ARGUMENT;
+
+	const char* currentCharacter = specifierStart + 1;
+	if (*currentCharacter == '%')
+	{
+		formatSpecifier.m_ArgumentType = PERCENT_LITERAL;
+		formatSpecifier.m_SpecifierLength = 2U;
+
+		return specifierStart;
+	}
+
+	while (*currentCharacter != '\0' && strchr("-+ #0", *currentCharacter) != nullptr)
+	{
+		++currentCharacter;
+	}
+
+	if (*currentCharacter == '*')
+	{
+		++formatSpecifier.m_NumberOfStarArguments;
+		++currentCharacter;
+	}
+	else
+	{
+		while (isdigit(static_cast<unsigned char>(*currentCharacter)))
+		{
+			++currentCharacter;
+		}
+	}
+
+	if (*currentCharacter == '.')
+	{
+		++currentCharacter;
+		if (*currentCharacter == '*')
+		{
+			++formatSpecifier.m_NumberOfStarArguments;
+			++currentCharacter;
+		}
+		else
+		{
+			while (isdigit(static_cast<unsigned char>(*currentCharacter)))
+			{
+				++currentCharacter;
+			}
+		}
+	}
+
+	size_t integerSize = sizeof(int);
+	bool isLongDouble = false;
+	bool isWideString = false;
+
+	switch (*currentCharacter)
+	{
+	case 'h':
+		++currentCharacter;
+		if (*currentCharacter == 'h')
+		{
+			++currentCharacter;
+		}
+		break;
+
+	case 'l':
+		++currentCharacter;
+		if (*currentCharacter == 'l')
+		{
+			integerSize = sizeof(long long);
+			++currentCharacter;
+		}
+		else
+		{
+			integerSize = sizeof(long);
+			isWideString = true;
+		}
+		break;
+
+	case 'j':
+		integerSize = sizeof(intmax_t);
+		++currentCharacter;
+		break;
+
+	case 'z':
+	case 't':
+		integerSize = sizeof(size_t);
+		++currentCharacter;
+		break;
+
+	case 'L':
+		isLongDouble = true;
+		++currentCharacter;
+		break;
+
+	case 'w':
+		isWideString = true;
+		++currentCharacter;
+		break;
+
+	case 'I':
+		if (strncmp(currentCharacter, "I64", 3) == 0)
+		{
+			integerSize = sizeof(int64_t);
+			currentCharacter += 3;
+		}
+		else if (strncmp(currentCharacter, "I32", 3) == 0)
+		{
+			integerSize = sizeof(int32_t);
+			currentCharacter += 3;
+		}
+		else
+		{
+			integerSize = sizeof(size_t);
+			++currentCharacter;
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	switch (*currentCharacter)
+	{
+	case 'd':
+	case 'i':
+	case 'u':
+	case 'o':
+	case 'x':
+	case 'X':
+		formatSpecifier.m_ArgumentType = (integerSize == sizeof(int64_t)) ? INTEGER_64_ARGUMENT : INTEGER_32_ARGUMENT;
+		break;
+
+	case 'c':
+	case 'C':
+		formatSpecifier.m_ArgumentType = INTEGER_32_ARGUMENT;
+		break;
+
+	case 'f':
+	case 'F':
+	case 'e':
+	case 'E':
+	case 'g':
+	case 'G':
+	case 'a':
+	case 'A':
+		formatSpecifier.m_ArgumentType = (isLongDouble) ? LONG_FLOATING_POINT_ARGUMENT : FLOATING_POINT_ARGUMENT;
+		break;
+
+	case 's':
+		formatSpecifier.m_ArgumentType = (isWideString) ? WIDE_STRING_ARGUMENT : STRING_ARGUMENT;
+		break;
+
+	case 'S':
+		formatSpecifier.m_ArgumentType = WIDE_STRING_ARGUMENT;
+		break;
+
+	case 'p':
+		formatSpecifier.m_ArgumentType = POINTER_ARGUMENT;
+		break;
+
+	case 'n':
+		formatSpecifier.m_ArgumentType = WRITE_COUNT_ARGUMENT;
+		break;
+
+	default:
+		break;
+	}
+
+	if (*currentCharacter != '\0')
+	{
+		++currentCharacter;
+	}
+
+	formatSpecifier.m_SpecifierLength = static_cast<size_t>(currentCharacter - specifierStart);
+
+	return specifierStart;
+}
+
+
+
+static bool AppendArgumentBytes(const void* byteData, size_t numberOfBytes, unsigned char* argumentData, size_t& argumentDataSize, size_t maximumDataSize)
+{
+	if (argumentDataSize + numberOfBytes > maximumDataSize)
+	{
+		return false;
+	}
+
+	memcpy(argumentData + argumentDataSize, byteData, numberOfBytes);
+	argumentDataSize += numberOfBytes;
+
+	return true;
+}
+
+
+
+static bool AppendStringArgument(const char* stringData, size_t stringLength, unsigned char* argumentData, size_t& argumentDataSize, size_t maximumDataSize)
+{
+	if (argumentDataSize + sizeof(uint16_t) > maximumDataSize)
+	{
+		return false;
+	}
+
+	size_t remainingDataSize = maximumDataSize - (argumentDataSize + sizeof(uint16_t));
+	uint16_t storedLength = static_cast<uint16_t>((stringLength < remainingDataSize) ? stringLength : remainingDataSize);
+
+	AppendArgumentBytes(&storedLength, sizeof(uint16_t), argumentData, argumentDataSize, maximumDataSize);
+	AppendArgumentBytes(stringData, storedLength, argumentData, argumentDataSize, maximumDataSize);
+
+	return (storedLength == stringLength);
+}
+
+
+
+size_t PackLogArguments(const char* messageFormat, va_list variableArgumentList, unsigned char* argumentData, size_t maximumDataSize)
+{
+	size_t argumentDataSize = 0U;
+	LogFormatSpecifier formatSpecifier;
+
+	const char* currentFormat = messageFormat;
+	while ((currentFormat = FindNextFormatSpecifier(currentFormat, formatSpecifier)) != nullptr)
+	{
+		currentFormat += formatSpecifier.m_SpecifierLength;
+
+		for (uint8_t starIndex = 0U; starIndex < formatSpecifier.m_NumberOfStarArguments; ++starIndex)
+		{
+			int starArgument = va_arg(variableArgumentList, int);
+			if (!AppendArgumentBytes(&starArgument, sizeof(int), argumentData, argumentDataSize, maximumDataSize))
+			{
+				return argumentDataSize;
+			}
+		}
+
+		bool argumentPacked = true;
+
+		switch (formatSpecifier.m_ArgumentType)
+		{
+		case INTEGER_32_ARGUMENT:
+		{
+			int32_t integerArgument = va_arg(variableArgumentList, int32_t);
+			argumentPacked = AppendArgumentBytes(&integerArgument, sizeof(int32_t), argumentData, argumentDataSize, maximumDataSize);
+		}
+		break;
+
+		case INTEGER_64_ARGUMENT:
+		{
+			int64_t integerArgument = va_arg(variableArgumentList, int64_t);
+			argumentPacked = AppendArgumentBytes(&integerArgument, sizeof(int64_t), argumentData, argumentDataSize, maximumDataSize);
+		}
+		break;
+
+		case FLOATING_POINT_ARGUMENT:
+		{
+			double floatingPointArgument = va_arg(variableArgumentList, double);
+			argumentPacked = AppendArgumentBytes(&floatingPointArgument, sizeof(double), argumentData, argumentDataSize, maximumDataSize);
+		}
+		break;
+
+		case LONG_FLOATING_POINT_ARGUMENT:
+		{
+			double floatingPointArgument = static_cast<double>(va_arg(variableArgumentList, long double));
+			argumentPacked = AppendArgumentBytes(&floatingPointArgument, sizeof(double), argumentData, argumentDataSize, maximumDataSize);
+		}
+		break;
+
+		case STRING_ARGUMENT:
+		{
+			const char* stringArgument = va_arg(variableArgumentList, const char*);
+			if (stringArgument == nullptr)
+			{
+				stringArgument = "(null)";
+			}
+
+			argumentPacked = AppendStringArgument(stringArgument, strlen(stringArgument), argumentData, argumentDataSize, maximumDataSize);
+		}
+		break;
+
+		case WIDE_STRING_ARGUMENT:
+		{
+			const wchar_t* wideStringArgument = va_arg(variableArgumentList, const wchar_t*);
+			if (wideStringArgument == nullptr)
+			{
+				wideStringArgument = L"(null)";
+			}
+
+			char narrowString[MAXIMUM_LOG_ARGUMENT_DATA_SIZE];
+			size_t narrowLength = 0U;
+			while (wideStringArgument[narrowLength] != L'\0' && narrowLength < MAXIMUM_LOG_ARGUMENT_DATA_SIZE)
+			{
+				wchar_t wideCharacter = wideStringArgument[narrowLength];
+				narrowString[narrowLength] = (wideCharacter < 128) ? static_cast<char>(wideCharacter) : '?';
+				++narrowLength;
+			}
+
+			argumentPacked = AppendStringArgument(narrowString, narrowLength, argumentData, argumentDataSize, maximumDataSize);
+		}
+		break;
+
+		case POINTER_ARGUMENT:
+		{
+			uint64_t pointerArgument = reinterpret_cast<uint64_t>(va_arg(variableArgumentList, void*));
+			argumentPacked = AppendArgumentBytes(&pointerArgument, sizeof(uint64_t), argumentData, argumentDataSize, maximumDataSize);
+		}
+		break;
+
+		case WRITE_COUNT_ARGUMENT:
+			va_arg(variableArgumentList, int*);
+			break;
+
+		default:
+			break;
+		}
+
+		if (!argumentPacked)
+		{
+			break;
+		}
+	}
+
+	return argumentDataSize;
+}
+
+
+
+static bool ReadArgumentBytes(void* byteData, size_t numberOfBytes, const unsigned char* argumentData, size_t& readOffset, size_t argumentDataSize, bool convertEndianness)
+{
+	if (readOffset + numberOfBytes > argumentDataSize)
+	{
+		return false;
+	}
+
+	memcpy(byteData, argumentData + readOffset, numberOfBytes);
+	readOffset += numberOfBytes;
+
+	if (convertEndianness)
+	{
+		ConvertByteDataToOppositeEndianMode(byteData, numberOfBytes);
+	}
+
+	return true;
+}
+
+
+
+template <typename argumentType>
+static std::string FormatLogArgument(const std::string& specifierFormat, const int* starArguments, uint8_t numberOfStarArguments, argumentType argumentValue)
+{
+	switch (numberOfStarArguments)
+	{
+	case 1:
+		return Stringf(specifierFormat.c_str(), starArguments[0], argumentValue);
+
+	case 2:
+		return Stringf(specifierFormat.c_str(), starArguments[0], starArguments[1], argumentValue);
+
+	default:
+		return Stringf(specifierFormat.c_str(), argumentValue);
+	}
+}
+
+
+
+std::string UnpackLogArguments(const char* messageFormat, const unsigned char* argumentData, size_t argumentDataSize, bool convertEndianness)
+{
+	std::string messageText;
+	size_t readOffset = 0U;
+	LogFormatSpecifier formatSpecifier;
+
+	const char* currentFormat = messageFormat;
+	const char* nextSpecifier = nullptr;
+	while ((nextSpecifier = FindNextFormatSpecifier(currentFormat, formatSpecifier)) != nullptr)
+	{
+		messageText.append(currentFormat, nextSpecifier - currentFormat);
+		currentFormat = nextSpecifier + formatSpecifier.m_SpecifierLength;
+
+		std::string specifierFormat(nextSpecifier, formatSpecifier.m_SpecifierLength);
+		int starArguments[2] = { 0, 0 };
+		bool argumentUnpacked = true;
+
+		for (uint8_t starIndex = 0U; starIndex < formatSpecifier.m_NumberOfStarArguments; ++starIndex)
+		{
+			argumentUnpacked = argumentUnpacked && ReadArgumentBytes(&starArguments[starIndex], sizeof(int), argumentData, readOffset, argumentDataSize, convertEndianness);
+		}
+
+		switch (formatSpecifier.m_ArgumentType)
+		{
+		case PERCENT_LITERAL:
+			messageText += '%';
+			break;
+
+		case NO_ARGUMENT:
+			messageText += specifierFormat;
+			break;
+
+		case INTEGER_32_ARGUMENT:
+		{
+			int32_t integerArgument = 0;
+			argumentUnpacked = argumentUnpacked && ReadArgumentBytes(&integerArgument, sizeof(int32_t), argumentData, readOffset, argumentDataSize, convertEndianness);
+			if (argumentUnpacked)
+			{
+				messageText += FormatLogArgument(specifierFormat, starArguments, formatSpecifier.m_NumberOfStarArguments, integerArgument);
+			}
+		}
+		break;
+
+		case INTEGER_64_ARGUMENT:
+		{
+			int64_t integerArgument = 0;
+			argumentUnpacked = argumentUnpacked && ReadArgumentBytes(&integerArgument, sizeof(int64_t), argumentData, readOffset, argumentDataSize, convertEndianness);
+			if (argumentUnpacked)
+			{
+				messageText += FormatLogArgument(specifierFormat, starArguments, formatSpecifier.m_NumberOfStarArguments, integerArgument);
+			}
+		}
+		break;
+
+		case FLOATING_POINT_ARGUMENT:
+		case LONG_FLOATING_POINT_ARGUMENT:
+		{
+			double floatingPointArgument = 0.0;
+			argumentUnpacked = argumentUnpacked && ReadArgumentBytes(&floatingPointArgument, sizeof(double), argumentData, readOffset, argumentDataSize, convertEndianness);
+			if (argumentUnpacked)
+			{
+				if (formatSpecifier.m_ArgumentType == LONG_FLOATING_POINT_ARGUMENT)
+				{
+					messageText += FormatLogArgument(specifierFormat, starArguments, formatSpecifier.m_NumberOfStarArguments, static_cast<long double>(floatingPointArgument));
+				}
+				else
+				{
+					messageText += FormatLogArgument(specifierFormat, starArguments, formatSpecifier.m_NumberOfStarArguments, floatingPointArgument);
+				}
+			}
+		}
+		break;
+
+		case STRING_ARGUMENT:
+		case WIDE_STRING_ARGUMENT:
+		{
+			uint16_t stringLength = 0U;
+			argumentUnpacked = argumentUnpacked && ReadArgumentBytes(&stringLength, sizeof(uint16_t), argumentData, readOffset, argumentDataSize, convertEndianness);
+			argumentUnpacked = argumentUnpacked && (readOffset + stringLength <= argumentDataSize);
+			if (argumentUnpacked)
+			{
+				std::string stringArgument(reinterpret_cast<const char*>(argumentData + readOffset), stringLength);
+				readOffset += stringLength;
+
+				if (formatSpecifier.m_ArgumentType == WIDE_STRING_ARGUMENT)
+				{
+					std::string narrowSpecifierFormat;
+					for (char specifierCharacter : specifierFormat)
+					{
+						if (specifierCharacter == 'l' || specifierCharacter == 'w')
+						{
+							continue;
+						}
+
+						narrowSpecifierFormat += (specifierCharacter == 'S') ? 's' : specifierCharacter;
+					}
+
+					specifierFormat = narrowSpecifierFormat;
+				}
+
+				messageText += FormatLogArgument(specifierFormat, starArguments, formatSpecifier.m_NumberOfStarArguments, stringArgument.c_str());
+			}
+		}
+		break;
+
+		case POINTER_ARGUMENT:
+		{
+			uint64_t pointerArgument = 0U;
+			argumentUnpacked = argumentUnpacked && ReadArgumentBytes(&pointerArgument, sizeof(uint64_t), argumentData, readOffset, argumentDataSize, convertEndianness);
+			if (argumentUnpacked)
+			{
+				messageText += FormatLogArgument(specifierFormat, starArguments, formatSpecifier.m_NumberOfStarArguments, reinterpret_cast<void*>(static_cast<uintptr_t>(pointerArgument)));
+			}
+		}
+		break;
+
+		default:
+			break;
+		}
+
+		if (!argumentUnpacked)
+		{
+			messageText += "...";
+
+			return messageText;
+		}
+	}
+
+	messageText += currentFormat;
+
+	return messageText;
+}
+
+
+
+static bool DecodeBinaryLogMessage(const BinaryFileReader& fileReader, std::map<uint32_t, std::string>& formatStrings, std::map<uint32_t, std::string>& tagStrings, bool convertEndianness, std::string& messageText)
+{
+	uint32_t formatStringID;
+	uint32_t tagStringID;
+	uint8_t messageFlags;
+	uint8_t logLevel;
+	int64_t messageRawTime;
+	uint16_t argumentDataSize;
+
+	bool success = true;
+	success = success && fileReader.Read<uint32_t>(formatStringID);
+	success = success && fileReader.Read<uint32_t>(tagStringID);
+	success = success && fileReader.Read<uint8_t>(messageFlags);
+	success = success && fileReader.Read<uint8_t>(logLevel);
+	success = success && fileReader.Read<int64_t>(messageRawTime);
+	success = success && fileReader.Read<uint16_t>(argumentDataSize);
+	success = success && (argumentDataSize <= MAXIMUM_LOG_ARGUMENT_DATA_SIZE);
+
+	unsigned char argumentData[MAXIMUM_LOG_ARGUMENT_DATA_SIZE];
+	success = success && (fileReader.ReadBytes(argumentData, argumentDataSize) == argumentDataSize);
+
+	std::vector<CallStackLine> callStackLines;
+	if (success && (messageFlags & CALL_STACK_FLAG) != 0U)
+	{
+		uint32_t numberOfCallStackLines;
+		success = success && fileReader.Read<uint32_t>(numberOfCallStackLines);
+
+		for (uint32_t callStackLineIndex = 0U; success && callStackLineIndex < numberOfCallStackLines; ++callStackLineIndex)
+		{
+			std::string fileName;
+			std::string functionName;
+			CallStackLine currentLine;
+
+			success = success && fileReader.ReadBinaryString(fileName);
+			success = success && fileReader.ReadBinaryString(functionName);
+			success = success && fileReader.Read<uint32_t>(currentLine.m_LineNumber);
+
+			CopyString(currentLine.m_FileName, fileName.c_str(), sizeof(currentLine.m_FileName));
+			CopyString(currentLine.m_FunctionName, functionName.c_str(), sizeof(currentLine.m_FunctionName));
+			currentLine.m_Offset = 0U;
+
+			callStackLines.push_back(currentLine);
+		}
+	}
+
+	if (!success)
+	{
+		return false;
+	}
+
+	std::string messageString = UnpackLogArguments(formatStrings[formatStringID].c_str(), argumentData, argumentDataSize, convertEndianness);
+
+	if ((messageFlags & SIMPLE_FORM_FLAG) != 0U)
+	{
+		LogMessage decodedMessage(messageString.c_str());
+		messageText = decodedMessage.GetLogMessageText();
+	}
+	else
+	{
+		LogMessage decodedMessage(messageString.c_str(), GetTimeStampForRawTime(messageRawTime), static_cast<LogLevel>(logLevel), tagStrings[tagStringID].c_str());
+		messageText = decodedMessage.GetLogMessageText();
+	}
+
+	if (!callStackLines.empty())
+	{
+		messageText += GetCallStackText(callStackLines.data(), callStackLines.size());
+	}
+
+	return true;
+}
+
+
+
+bool DecodeBinaryLogFile(const char* binaryFileName, const char* textFileName)
+{
+	BinaryFileReader fileReader;
+	if (!fileReader.OpenBinaryFile(binaryFileName))
+	{
+		return false;
+	}
+
+	char fileSignature[sizeof(BINARY_LOG_SIGNATURE)];
+	uint8_t fileVersion = 0U;
+	uint8_t fileEndianness = 0U;
+
+	bool validHeader = true;
+	validHeader = validHeader && (fileReader.ReadBytes(fileSignature, sizeof(fileSignature)) == sizeof(fileSignature));
+	validHeader = validHeader && (memcmp(fileSignature, BINARY_LOG_SIGNATURE, sizeof(fileSignature)) == 0);
+	validHeader = validHeader && fileReader.Read<uint8_t>(fileVersion) && (fileVersion == BINARY_LOG_VERSION);
+	validHeader = validHeader && fileReader.Read<uint8_t>(fileEndianness);
+
+	BinaryFileWriter fileWriter;
+	if (!validHeader || !fileWriter.OpenBinaryFile(textFileName))
+	{
+		fileReader.CloseBinaryFile();
+
+		return false;
+	}
+
+	EndianMode fileEndianMode = static_cast<EndianMode>(fileEndianness);
+	fileReader.SetEndianness(fileEndianMode);
+	bool convertEndianness = (fileEndianMode != GetLocalEndianness());
+
+	std::map<uint32_t, std::string> formatStrings;
+	std::map<uint32_t, std::string> tagStrings;
+
+	bool success = true;
+	uint8_t recordType;
+	while (success && fileReader.Read<uint8_t>(recordType))
+	{
+		switch (recordType)
+		{
+		case FORMAT_STRING_RECORD:
+		case TAG_STRING_RECORD:
+		{
+			uint32_t stringID;
+			std::string stringData;
+
+			success = fileReader.Read<uint32_t>(stringID) && fileReader.ReadBinaryString(stringData);
+			if (success)
+			{
+				std::map<uint32_t, std::string>& stringTable = (recordType == FORMAT_STRING_RECORD) ? formatStrings : tagStrings;
+				stringTable[stringID] = stringData;
+			}
+		}
+		break;
+
+		case MESSAGE_RECORD:
+		{
+			std::string messageText;
+
+			success = DecodeBinaryLogMessage(fileReader, formatStrings, tagStrings, convertEndianness, messageText);
+			if (success)
+			{
+				fileWriter.WriteTextString(messageText);
+			}
+		}
+		break;
+
+		default:
+			success = false;
+			break;
+		}
+	}
+
+	fileWriter.CloseBinaryFile();
+	fileReader.CloseBinaryFile();
+
+	return success;
+}
+
+
+
+void DecodeBinaryLogCommand(Command& currentCommand)
+{
+	ConsoleLine decodeMessage;
+
+	std::vector<std::string> currentCommandArguments;
+	currentCommand.GetCommandArguments(currentCommandArguments);
+
+	if (currentCommandArguments.size() == 2)
+	{
+		if (DecodeBinaryLogFile(currentCommandArguments[0].c_str(), currentCommandArguments[1].c_str()))
+		{
+			decodeMessage = ConsoleLine("Binary log decoded.", RGBA::GREEN);
+		}
+		else
+		{
+			decodeMessage = ConsoleLine("Binary log could not be fully decoded.", RGBA::RED);
+		}
+	}
+	else
+	{
+		decodeMessage = ConsoleLine("DecodeBinaryLog takes the binary log file and the text log file as arguments.", RGBA::RED);
+	}
+
+	DeveloperConsole::AddNewConsoleLine(decodeMessage);
+}
\ No newline at end of file
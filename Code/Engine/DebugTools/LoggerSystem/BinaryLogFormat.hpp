@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Engine/DeveloperConsole/Command.hpp"
+#include "Engine/IO Utilities/BinaryIO.hpp"
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <string>
+
+
+
+const char BINARY_LOG_SIGNATURE[4] = { 'B', 'L', 'O', 'G' };
+const uint8_t BINARY_LOG_VERSION = 1U;
+
+const size_t MAXIMUM_LOG_ARGUMENT_DATA_SIZE = 512U;
+const size_t MAXIMUM_LOG_TAG_LENGTH = 64U;
+
+
+
+enum BinaryLogRecordType : uint8_t
+{
+	FORMAT_STRING_RECORD,
+	TAG_STRING_RECORD,
+	MESSAGE_RECORD
+};
+
+
+
+enum BinaryLogMessageFlags : uint8_t
+{
+	SIMPLE_FORM_FLAG = 1 << 0,
+	CALL_STACK_FLAG = 1 << 1
+};
+
+
+
+enum LogArgumentType
+{
+	NO_ARGUMENT,
+	INTEGER_32_ARGUMENT,
+	INTEGER_64_ARGUMENT,
+	FLOATING_POINT_ARGUMENT,
+	LONG_FLOATING_POINT_ARGUMENT,
+	STRING_ARGUMENT,
+	WIDE_STRING_ARGUMENT,
+	POINTER_ARGUMENT,
+	WRITE_COUNT_ARGUMENT,
+	PERCENT_LITERAL
+};
+
+
+
+struct LogFormatSpecifier
+{
+	const char* m_SpecifierStart;
+	size_t m_SpecifierLength;
+
+	LogArgumentType m_ArgumentType;
+	uint8_t m_NumberOfStarArguments;
+};
+
+
+
+const char* FindNextFormatSpecifier(const char* messageFormat, LogFormatSpecifier& formatSpecifier);
+
+size_t PackLogArguments(const char* messageFormat, va_list variableArgumentList, unsigned char* argumentData, size_t maximumDataSize);
+std::string UnpackLogArguments(const char* messageFormat, const unsigned char* argumentData, size_t argumentDataSize, bool convertEndianness);
+
+bool DecodeBinaryLogFile(const char* binaryFileName, const char* textFileName);
+
+
+
+void DecodeBinaryLogCommand(Command& currentCommand);
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include "Engine/DebugTools/LoggerSystem/LogRotation.hpp"
+#include "Engine/IO Utilities/BinaryFileIO.hpp"
+
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#include <compressapi.h>
+#include <vector>
+
+#pragma comment(lib, "Cabinet.lib")
+
+
+
+LogRotationSettings::LogRotationSettings() :
+m_MaximumFileSizeInBytes(0U),
+m_MaximumFileAgeInSeconds(0.0),
+m_MaximumNumberOfRetainedFiles(0U),
+m_CompressRotatedFiles(false)
+{
+
+}
+
+
+
+LogRotationSettings::LogRotationSettings(size_t maximumFileSizeInBytes, double maximumFileAgeInSeconds, uint32_t maximumNumberOfRetainedFiles /*= 0U*/, bool compressRotatedFiles /*= false*/) :
+m_MaximumFileSizeInBytes(maximumFileSizeInBytes),
+m_MaximumFileAgeInSeconds(maximumFileAgeInSeconds),
+m_MaximumNumberOfRetainedFiles(maximumNumberOfRetainedFiles),
+m_CompressRotatedFiles(compressRotatedFiles)
+{
+
+}
+
+
+
+bool LogRotationSettings::IsRotationEnabled() const
+{
+	return (m_MaximumFileSizeInBytes > 0U || m_MaximumFileAgeInSeconds > 0.0);
+}
+
+
+
+bool LinkLatestLogFile(const char* segmentFileName, const char* latestFileName)
+{
+	DeleteFileA(latestFileName);
+
+	return (CreateHardLinkA(latestFileName, segmentFileName, NULL) != FALSE);
+}
+
+
+
+bool CopyLatestLogFile(const char* segmentFileName, const char* latestFileName)
+{
+	return (CopyFileA(segmentFileName, latestFileName, FALSE) != FALSE);
+}
+
+
+
+bool DeleteLogFile(const char* fileName)
+{
+	return (DeleteFileA(fileName) != FALSE);
+}
+
+
+
+static bool LoadLogFileToBuffer(const char* fileName, std::vector<unsigned char>& fileBuffer)
+{
+	BinaryFileReader fileReader;
+	if (!fileReader.OpenBinaryFile(fileName))
+	{
+		return false;
+	}
+
+	size_t fileBufferSize = fileReader.GetBinaryFileSize();
+	fileBuffer.resize(fileBufferSize);
+
+	size_t bytesRead = (fileBufferSize > 0U) ? fileReader.ReadBytes(fileBuffer.data(), fileBufferSize) : 0U;
+	fileReader.CloseBinaryFile();
+
+	return (bytesRead == fileBufferSize);
+}
+
+
+
+static bool SaveBufferToLogFile(const char* fileName, const unsigned char* fileBuffer, size_t fileBufferSize)
+{
+	BinaryFileWriter fileWriter;
+	if (!fileWriter.OpenBinaryFile(fileName))
+	{
+		return false;
+	}
+
+	size_t bytesWritten = fileWriter.WriteBytes(fileBuffer, fileBufferSize);
+	fileWriter.CloseBinaryFile();
+
+	return (bytesWritten == fileBufferSize);
+}
+
+
+
+bool CompressLogFile(const char* fileName, const char* compressedFileName)
+{
+	std::vector<unsigned char> fileBuffer;
+	if (!LoadLogFileToBuffer(fileName, fileBuffer) || fileBuffer.empty())
+	{
+		return false;
+	}
+
+	COMPRESSOR_HANDLE logCompressor = NULL;
+	if (!CreateCompressor(COMPRESS_ALGORITHM_XPRESS_HUFF, NULL, &logCompressor))
+	{
+		return false;
+	}
+
+	SIZE_T compressedBufferSize = 0;
+	Compress(logCompressor, fileBuffer.data(), fileBuffer.size(), NULL, 0, &compressedBufferSize);
+
+	std::vector<unsigned char> compressedBuffer(compressedBufferSize);
+	BOOL compressionSucceeded = Compress(logCompressor, fileBuffer.data(), fileBuffer.size(), compressedBuffer.data(), compressedBuffer.size(), &compressedBufferSize);
+	CloseCompressor(logCompressor);
+
+	if (!compressionSucceeded)
+	{
+		return false;
+	}
+
+	return SaveBufferToLogFile(compressedFileName, compressedBuffer.data(), compressedBufferSize);
+}
+
+
+
+bool DecompressLogFile(const char* compressedFileName, const char* fileName)
+{
+	std::vector<unsigned char> compressedBuffer;
+	if (!LoadLogFileToBuffer(compressedFileName, compressedBuffer) || compressedBuffer.empty())
+	{
+		return false;
+	}
+
+	DECOMPRESSOR_HANDLE logDecompressor = NULL;
+	if (!CreateDecompressor(COMPRESS_ALGORITHM_XPRESS_HUFF, NULL, &logDecompressor))
+	{
+		return false;
+	}
+
+	SIZE_T fileBufferSize = 0;
+	Decompress(logDecompressor, compressedBuffer.data(), compressedBuffer.size(), NULL, 0, &fileBufferSize);
+
+	std::vector<unsigned char> fileBuffer(fileBufferSize);
+	BOOL decompressionSucceeded = Decompress(logDecompressor, compressedBuffer.data(), compressedBuffer.size(), fileBuffer.data(), fileBuffer.size(), &fileBufferSize);
+	CloseDecompressor(logDecompressor);
+
+	if (!decompressionSucceeded)
+	{
+		return false;
+	}
+
+	return SaveBufferToLogFile(fileName, fileBuffer.data(), fileBufferSize);
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+
+
+
+const char* const COMPRESSED_LOG_FILE_EXTENSION = ".xpr";
+
+
+
+struct LogRotationSettings
+{
+public:
+	LogRotationSettings();
+	LogRotationSettings(size_t maximumFileSizeInBytes, double maximumFileAgeInSeconds, uint32_t maximumNumberOfRetainedFiles = 0U, bool compressRotatedFiles = false);
+
+	bool IsRotationEnabled() const;
+
+public:
+	size_t m_MaximumFileSizeInBytes;
+	double m_MaximumFileAgeInSeconds;
+	uint32_t m_MaximumNumberOfRetainedFiles;
+	bool m_CompressRotatedFiles;
+};
+
+
+
+bool LinkLatestLogFile(const char* segmentFileName, const char* latestFileName);
+bool CopyLatestLogFile(const char* segmentFileName, const char* latestFileName);
+bool DeleteLogFile(const char* fileName);
+
+bool CompressLogFile(const char* fileName, const char* compressedFileName);
+bool DecompressLogFile(const char* compressedFileName, const char* fileName);
\ No newline at end of file
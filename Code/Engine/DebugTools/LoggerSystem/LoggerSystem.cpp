@@ -1,5 +1,7 @@
 #include "Engine/DebugTools/LoggerSystem/LoggerSystem.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
 #include "Engine/ErrorHandling/StringUtils.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
 
 #include <stdarg.h>
 
@@ -84,15 +86,7 @@ std::string LogMessage::GetLogMessageText()
 
 	if (currentCallStackLines != nullptr)
 	{
-		messageText += "\n";
-		
-		for (size_t callStackLineIndex = 0; callStackLineIndex < m_CurrentCallStack->m_NumberOfCallStackFrames; ++callStackLineIndex)
-		{
-			CallStackLine currentLine = currentCallStackLines[callStackLineIndex];
-			messageText += Stringf("\t%s(%u): %s\n", currentLine.m_FileName, currentLine.m_LineNumber, currentLine.m_FunctionName);
-		}
-
-		messageText += "\n";
+		messageText += GetCallStackText(currentCallStackLines, m_CurrentCallStack->m_NumberOfCallStackFrames);
 	}
 
 	return messageText;
@@ -100,23 +94,60 @@ std::string LogMessage::GetLogMessageText()
 
 
 
+BinaryLogMessage::BinaryLogMessage(const char* messageFormat, va_list variableArgumentList) :
+m_SimpleForm(true),
+m_MessageFormat(messageFormat),
+m_MessageRawTime(0),
+m_LogLevel(LOG_NONE),
+m_CurrentCallStack(nullptr)
+{
+	m_MessageTag[0] = '\0';
+	m_ArgumentDataSize = PackLogArguments(messageFormat, variableArgumentList, m_ArgumentData, MAXIMUM_LOG_ARGUMENT_DATA_SIZE);
+}
+
+
+
+BinaryLogMessage::BinaryLogMessage(const char* messageFormat, va_list variableArgumentList, int64_t messageRawTime, const LogLevel& logLevel, const char* messageTag, CallStack* currentCallStack /*= nullptr*/) :
+m_SimpleForm(false),
+m_MessageFormat(messageFormat),
+m_MessageRawTime(messageRawTime),
+m_LogLevel(logLevel),
+m_CurrentCallStack(currentCallStack)
+{
+	CopyString(m_MessageTag, messageTag, MAXIMUM_LOG_TAG_LENGTH);
+	m_ArgumentDataSize = PackLogArguments(messageFormat, variableArgumentList, m_ArgumentData, MAXIMUM_LOG_ARGUMENT_DATA_SIZE);
+}
+
+
+
 LoggerSystem::LoggerSystem() :
 m_LoggerThread(nullptr),
+m_MaintenanceThread(nullptr),
+m_LoggingMode(TEXT_LOGGING_MODE),
 m_IsRunning(false),
+m_MaintenanceIsRunning(false),
 m_FlushLogs(false)
 {
-	
+	DeveloperConsole::RegisterCommands("DecodeBinaryLog", "Decodes a binary log into a text log. Takes the binary log file and the text log file as arguments.", DecodeBinaryLogCommand);
 }
 
 
 
-void LoggerSystem::InitializeLoggerSystem(const char* loggerName)
+void LoggerSystem::InitializeLoggerSystem(const char* loggerName, const LoggingMode& loggingMode /*= TEXT_LOGGING_MODE*/, const LogRotationSettings& rotationSettings /*= LogRotationSettings()*/)
 {
 	g_LoggerSystem = new LoggerSystem();
 
 	g_LoggerSystem->m_LoggerName = loggerName;
+	g_LoggerSystem->m_LoggingMode = loggingMode;
+	g_LoggerSystem->m_RotationSettings = rotationSettings;
 	g_LoggerSystem->m_IsRunning = true;
 	g_LoggerSystem->m_LoggerThread = Thread::CreateNewThread(MessageLoggingThread, g_LoggerSystem);
+
+	if (rotationSettings.IsRotationEnabled())
+	{
+		g_LoggerSystem->m_MaintenanceIsRunning = true;
+		g_LoggerSystem->m_MaintenanceThread = Thread::CreateNewThread(LogMaintenanceThread, g_LoggerSystem);
+	}
 }
 
 
@@ -128,6 +159,14 @@ void LoggerSystem::UninitializeLoggerSystem()
 
 	Thread::DestroyThread(g_LoggerSystem->m_LoggerThread);
 
+	if (g_LoggerSystem->m_MaintenanceThread != nullptr)
+	{
+		g_LoggerSystem->m_MaintenanceIsRunning = false;
+		g_LoggerSystem->m_MaintenanceThread->JoinThread();
+
+		Thread::DestroyThread(g_LoggerSystem->m_MaintenanceThread);
+	}
+
 	delete g_LoggerSystem;
 	g_LoggerSystem = nullptr;
 }
@@ -151,25 +190,35 @@ void LoggerSystem::FlushLogger()
 
 void MessageLoggingThread(void* messageLogger)
 {
+	MEMORY_SCOPE("Logging");
+
 	LoggerSystem* loggerSystem = (LoggerSystem*)messageLogger;
-	TimeStampData currentTimeStamp = GetTimeStampForCurrentTime();
+	TimeStampData startingTimeStamp = GetTimeStampForCurrentTime();
 
-	char fileName[128];
-	sprintf_s(fileName, "Logs/%s__%04i-%02i-%02i__%02i.%02i.%02i.log",
-			loggerSystem->m_LoggerName,
-			currentTimeStamp.m_Year,
-			currentTimeStamp.m_Month,
-			currentTimeStamp.m_Day,
-			currentTimeStamp.m_Hour,
-			currentTimeStamp.m_Minute,
-			currentTimeStamp.m_Second);
+	uint32_t segmentIndex = 0U;
+	char fileName[256];
+	GetLogSegmentFileName(loggerSystem, startingTimeStamp, segmentIndex, fileName, sizeof(fileName));
 
 	BinaryFileWriter fileWriter;
-	fileWriter.OpenBinaryFile(fileName);
+	bool latestFileIsLinked = OpenLogSegment(loggerSystem, fileWriter, fileName);
+	double segmentStartingTime = GetCurrentTimeInSeconds();
 
 	while (loggerSystem->m_IsRunning)
 	{
 		HandleMessagesInQueue(loggerSystem, fileWriter);
+
+		if (LogSegmentNeedsRotation(loggerSystem, fileWriter, segmentStartingTime))
+		{
+			fileWriter.CloseBinaryFile();
+			loggerSystem->m_AllRotatedLogFiles.Enqueue(new std::string(fileName));
+
+			++segmentIndex;
+			GetLogSegmentFileName(loggerSystem, startingTimeStamp, segmentIndex, fileName, sizeof(fileName));
+
+			latestFileIsLinked = OpenLogSegment(loggerSystem, fileWriter, fileName);
+			segmentStartingTime = GetCurrentTimeInSeconds();
+		}
+
 		Thread::YieldThread();
 	}
 
@@ -177,7 +226,12 @@ void MessageLoggingThread(void* messageLogger)
 
 	fileWriter.CloseBinaryFile();
 
-	MakeDefaultFileCopy(loggerSystem, fileName);
+	if (!latestFileIsLinked)
+	{
+		char latestFileName[256];
+		GetLatestLogFileName(loggerSystem, latestFileName, sizeof(latestFileName));
+		CopyLatestLogFile(fileName, latestFileName);
+	}
 }
 
 
@@ -192,6 +246,13 @@ void HandleMessagesInQueue(LoggerSystem* loggerSystem, BinaryFileWriter& fileWri
 		delete currentLogMessage;
 	}
 
+	BinaryLogMessage* currentBinaryLogMessage = nullptr;
+	while (loggerSystem->m_AllBinaryLogMessages.Dequeue(currentBinaryLogMessage))
+	{
+		WriteBinaryLogMessage(loggerSystem, fileWriter, currentBinaryLogMessage);
+		delete currentBinaryLogMessage;
+	}
+
 	if (loggerSystem->m_FlushLogs)
 	{
 		fileWriter.FlushBinaryFile();
@@ -201,135 +262,335 @@ void HandleMessagesInQueue(LoggerSystem* loggerSystem, BinaryFileWriter& fileWri
 
 
 
-void MakeDefaultFileCopy(LoggerSystem* loggerSystem, const char* fileName)
+void GetLogSegmentFileName(LoggerSystem* loggerSystem, const TimeStampData& startingTimeStamp, uint32_t segmentIndex, char* fileName, size_t fileNameLength)
 {
-	unsigned char* fileBuffer = nullptr;
+	const char* fileExtension = (loggerSystem->m_LoggingMode == BINARY_LOGGING_MODE) ? "blog" : "log";
 
-	BinaryFileReader fileReader;
-	fileReader.OpenBinaryFile(fileName);
-	
-	size_t fileBufferSize = fileReader.GetBinaryFileSize();
-	fileBuffer = new unsigned char[fileBufferSize];
+	if (segmentIndex == 0U)
+	{
+		sprintf_s(fileName, fileNameLength, "Logs/%s__%04i-%02i-%02i__%02i.%02i.%02i.%s",
+			loggerSystem->m_LoggerName,
+			startingTimeStamp.m_Year,
+			startingTimeStamp.m_Month,
+			startingTimeStamp.m_Day,
+			startingTimeStamp.m_Hour,
+			startingTimeStamp.m_Minute,
+			startingTimeStamp.m_Second,
+			fileExtension);
+	}
+	else
+	{
+		sprintf_s(fileName, fileNameLength, "Logs/%s__%04i-%02i-%02i__%02i.%02i.%02i__%03u.%s",
+			loggerSystem->m_LoggerName,
+			startingTimeStamp.m_Year,
+			startingTimeStamp.m_Month,
+			startingTimeStamp.m_Day,
+			startingTimeStamp.m_Hour,
+			startingTimeStamp.m_Minute,
+			startingTimeStamp.m_Second,
+			segmentIndex,
+			fileExtension);
+	}
+}
 
-	fileReader.ReadBytes(fileBuffer, fileBufferSize);
-	fileReader.CloseBinaryFile();
 
-	char copiedFileName[128];
-	sprintf_s(copiedFileName, "Logs/%s.log", loggerSystem->m_LoggerName);
 
-	BinaryFileWriter fileWriter;
-	fileWriter.OpenBinaryFile(copiedFileName);
+void GetLatestLogFileName(LoggerSystem* loggerSystem, char* fileName, size_t fileNameLength)
+{
+	const char* fileExtension = (loggerSystem->m_LoggingMode == BINARY_LOGGING_MODE) ? "blog" : "log";
+	sprintf_s(fileName, fileNameLength, "Logs/%s.%s", loggerSystem->m_LoggerName, fileExtension);
+}
 
-	fileWriter.WriteBytes(fileBuffer, fileBufferSize);
-	fileWriter.CloseBinaryFile();
 
-	delete[] fileBuffer;
+
+bool OpenLogSegment(LoggerSystem* loggerSystem, BinaryFileWriter& fileWriter, const char* fileName)
+{
+	fileWriter.OpenBinaryFile(fileName);
+
+	if (loggerSystem->m_LoggingMode == BINARY_LOGGING_MODE)
+	{
+		loggerSystem->m_BinaryFormatStringIDs.clear();
+		loggerSystem->m_BinaryTagStringIDs.clear();
+
+		WriteBinaryLogHeader(fileWriter);
+	}
+
+	char latestFileName[256];
+	GetLatestLogFileName(loggerSystem, latestFileName, sizeof(latestFileName));
+
+	return LinkLatestLogFile(fileName, latestFileName);
 }
 
 
 
-void PrintToLog(const char* messageFormat, ...)
+bool LogSegmentNeedsRotation(LoggerSystem* loggerSystem, const BinaryFileWriter& fileWriter, double segmentStartingTime)
 {
-	const int MAXIMUM_MESSAGE_LENGTH = 2048;
-	char messageLiteral[MAXIMUM_MESSAGE_LENGTH];
-	
-	va_list variableArgumentList;
-	va_start(variableArgumentList, messageFormat);
-	vsnprintf_s(messageLiteral, MAXIMUM_MESSAGE_LENGTH, _TRUNCATE, messageFormat, variableArgumentList);
-	va_end(variableArgumentList);
+	const LogRotationSettings& rotationSettings = loggerSystem->m_RotationSettings;
 
-	messageLiteral[MAXIMUM_MESSAGE_LENGTH - 1] = '\0';
+	if (rotationSettings.m_MaximumFileSizeInBytes > 0U && fileWriter.GetBinaryFileSize() >= rotationSettings.m_MaximumFileSizeInBytes)
+	{
+		return true;
+	}
 
-	LogMessage* newLogMessage = new LogMessage(messageLiteral, GetTimeStampForCurrentTime(), LOG_DEFAULT, "Default");
-	g_LoggerSystem->m_AllLogMessages.Enqueue(newLogMessage);
+	if (rotationSettings.m_MaximumFileAgeInSeconds > 0.0 && (GetCurrentTimeInSeconds() - segmentStartingTime) >= rotationSettings.m_MaximumFileAgeInSeconds)
+	{
+		return true;
+	}
+
+	return false;
 }
 
 
 
-void PrintToLogSimple(const char* messageFormat, ...)
+void LogMaintenanceThread(void* messageLogger)
 {
-	const int MAXIMUM_MESSAGE_LENGTH = 2048;
-	char messageLiteral[MAXIMUM_MESSAGE_LENGTH];
+	LoggerSystem* loggerSystem = (LoggerSystem*)messageLogger;
+	std::deque<std::string> retainedLogFiles;
 
-	va_list variableArgumentList;
-	va_start(variableArgumentList, messageFormat);
-	vsnprintf_s(messageLiteral, MAXIMUM_MESSAGE_LENGTH, _TRUNCATE, messageFormat, variableArgumentList);
-	va_end(variableArgumentList);
+	while (loggerSystem->m_MaintenanceIsRunning)
+	{
+		HandleRotatedLogFiles(loggerSystem, retainedLogFiles);
+		Thread::SleepThreadForTime(0.1f);
+	}
 
-	messageLiteral[MAXIMUM_MESSAGE_LENGTH - 1] = '\0';
+	HandleRotatedLogFiles(loggerSystem, retainedLogFiles);
+}
 
-	LogMessage* newLogMessage = new LogMessage(messageLiteral);
-	g_LoggerSystem->m_AllLogMessages.Enqueue(newLogMessage);
+
+
+void HandleRotatedLogFiles(LoggerSystem* loggerSystem, std::deque<std::string>& retainedLogFiles)
+{
+	const LogRotationSettings& rotationSettings = loggerSystem->m_RotationSettings;
+
+	std::string* rotatedLogFile = nullptr;
+	while (loggerSystem->m_AllRotatedLogFiles.Dequeue(rotatedLogFile))
+	{
+		std::string retainedLogFile = *rotatedLogFile;
+		delete rotatedLogFile;
+
+		if (rotationSettings.m_CompressRotatedFiles)
+		{
+			std::string compressedLogFile = retainedLogFile + COMPRESSED_LOG_FILE_EXTENSION;
+			if (CompressLogFile(retainedLogFile.c_str(), compressedLogFile.c_str()))
+			{
+				DeleteLogFile(retainedLogFile.c_str());
+				retainedLogFile = compressedLogFile;
+			}
+		}
+
+		retainedLogFiles.push_back(retainedLogFile);
+
+		while (rotationSettings.m_MaximumNumberOfRetainedFiles > 0U && retainedLogFiles.size() > rotationSettings.m_MaximumNumberOfRetainedFiles)
+		{
+			DeleteLogFile(retainedLogFiles.front().c_str());
+			retainedLogFiles.pop_front();
+		}
+	}
 }
 
 
 
-void PrintToLogWithTag(const char* messageTag, const char* messageFormat, ...)
+void WriteBinaryLogHeader(BinaryFileWriter& fileWriter)
 {
-	const int MAXIMUM_MESSAGE_LENGTH = 2048;
-	char messageLiteral[MAXIMUM_MESSAGE_LENGTH];
+	fileWriter.WriteBytes(BINARY_LOG_SIGNATURE, sizeof(BINARY_LOG_SIGNATURE));
+	fileWriter.Write<uint8_t>(BINARY_LOG_VERSION);
+	fileWriter.Write<uint8_t>(static_cast<uint8_t>(GetLocalEndianness()));
+}
 
-	va_list variableArgumentList;
-	va_start(variableArgumentList, messageFormat);
-	vsnprintf_s(messageLiteral, MAXIMUM_MESSAGE_LENGTH, _TRUNCATE, messageFormat, variableArgumentList);
-	va_end(variableArgumentList);
 
-	messageLiteral[MAXIMUM_MESSAGE_LENGTH - 1] = '\0';
 
-	LogMessage* newLogMessage = new LogMessage(messageLiteral, GetTimeStampForCurrentTime(), LOG_DEFAULT, messageTag);
-	g_LoggerSystem->m_AllLogMessages.Enqueue(newLogMessage);
+void WriteBinaryLogMessage(LoggerSystem* loggerSystem, BinaryFileWriter& fileWriter, BinaryLogMessage* binaryLogMessage)
+{
+	uint32_t formatStringID = GetBinaryFormatStringID(loggerSystem, fileWriter, binaryLogMessage->m_MessageFormat);
+	uint32_t tagStringID = GetBinaryTagStringID(loggerSystem, fileWriter, binaryLogMessage->m_MessageTag);
+
+	CallStackLine* currentCallStackLines = nullptr;
+	if (binaryLogMessage->m_CurrentCallStack != nullptr)
+	{
+		currentCallStackLines = GetCallStackLines(binaryLogMessage->m_CurrentCallStack);
+	}
+
+	uint8_t messageFlags = 0U;
+	messageFlags |= (binaryLogMessage->m_SimpleForm) ? SIMPLE_FORM_FLAG : 0U;
+	messageFlags |= (currentCallStackLines != nullptr) ? CALL_STACK_FLAG : 0U;
+
+	fileWriter.Write<uint8_t>(MESSAGE_RECORD);
+	fileWriter.Write<uint32_t>(formatStringID);
+	fileWriter.Write<uint32_t>(tagStringID);
+	fileWriter.Write<uint8_t>(messageFlags);
+	fileWriter.Write<uint8_t>(static_cast<uint8_t>(binaryLogMessage->m_LogLevel));
+	fileWriter.Write<int64_t>(binaryLogMessage->m_MessageRawTime);
+	fileWriter.Write<uint16_t>(static_cast<uint16_t>(binaryLogMessage->m_ArgumentDataSize));
+	fileWriter.WriteBytes(binaryLogMessage->m_ArgumentData, binaryLogMessage->m_ArgumentDataSize);
+
+	if (currentCallStackLines != nullptr)
+	{
+		size_t numberOfCallStackLines = binaryLogMessage->m_CurrentCallStack->m_NumberOfCallStackFrames;
+		fileWriter.Write<uint32_t>(static_cast<uint32_t>(numberOfCallStackLines));
+
+		for (size_t callStackLineIndex = 0; callStackLineIndex < numberOfCallStackLines; ++callStackLineIndex)
+		{
+			const CallStackLine& currentLine = currentCallStackLines[callStackLineIndex];
+			fileWriter.WriteBinaryString(currentLine.m_FileName);
+			fileWriter.WriteBinaryString(currentLine.m_FunctionName);
+			fileWriter.Write<uint32_t>(currentLine.m_LineNumber);
+		}
+	}
 }
 
 
 
-void PrintToLogWithLogLevel(const LogLevel& logLevel, const char* messageFormat, ...)
+uint32_t GetBinaryFormatStringID(LoggerSystem* loggerSystem, BinaryFileWriter& fileWriter, const char* messageFormat)
+{
+	auto formatStringIterator = loggerSystem->m_BinaryFormatStringIDs.find(messageFormat);
+	if (formatStringIterator != loggerSystem->m_BinaryFormatStringIDs.end())
+	{
+		return formatStringIterator->second;
+	}
+
+	uint32_t formatStringID = static_cast<uint32_t>(loggerSystem->m_BinaryFormatStringIDs.size());
+	loggerSystem->m_BinaryFormatStringIDs[messageFormat] = formatStringID;
+
+	fileWriter.Write<uint8_t>(FORMAT_STRING_RECORD);
+	fileWriter.Write<uint32_t>(formatStringID);
+	fileWriter.WriteBinaryString(messageFormat);
+
+	return formatStringID;
+}
+
+
+
+uint32_t GetBinaryTagStringID(LoggerSystem* loggerSystem, BinaryFileWriter& fileWriter, const char* messageTag)
 {
+	auto tagStringIterator = loggerSystem->m_BinaryTagStringIDs.find(messageTag);
+	if (tagStringIterator != loggerSystem->m_BinaryTagStringIDs.end())
+	{
+		return tagStringIterator->second;
+	}
+
+	uint32_t tagStringID = static_cast<uint32_t>(loggerSystem->m_BinaryTagStringIDs.size());
+	loggerSystem->m_BinaryTagStringIDs[messageTag] = tagStringID;
+
+	fileWriter.Write<uint8_t>(TAG_STRING_RECORD);
+	fileWriter.Write<uint32_t>(tagStringID);
+	fileWriter.WriteBinaryString(messageTag);
+
+	return tagStringID;
+}
+
+
+
+std::string GetCallStackText(const CallStackLine* callStackLines, size_t numberOfCallStackLines)
+{
+	std::string callStackText = "\n";
+
+	for (size_t callStackLineIndex = 0; callStackLineIndex < numberOfCallStackLines; ++callStackLineIndex)
+	{
+		const CallStackLine& currentLine = callStackLines[callStackLineIndex];
+		callStackText += Stringf("\t%s(%u): %s\n", currentLine.m_FileName, currentLine.m_LineNumber, currentLine.m_FunctionName);
+	}
+
+	callStackText += "\n";
+
+	return callStackText;
+}
+
+
+
+void EnqueueLogMessage(bool simpleForm, const char* messageTag, const LogLevel& logLevel, CallStack* currentCallStack, const char* messageFormat, va_list variableArgumentList)
+{
+	if (g_LoggerSystem->m_LoggingMode == BINARY_LOGGING_MODE)
+	{
+		BinaryLogMessage* newBinaryLogMessage = nullptr;
+		if (simpleForm)
+		{
+			newBinaryLogMessage = new BinaryLogMessage(messageFormat, variableArgumentList);
+		}
+		else
+		{
+			newBinaryLogMessage = new BinaryLogMessage(messageFormat, variableArgumentList, GetRawTimeForCurrentTime(), logLevel, messageTag, currentCallStack);
+		}
+
+		g_LoggerSystem->m_AllBinaryLogMessages.Enqueue(newBinaryLogMessage);
+
+		return;
+	}
+
 	const int MAXIMUM_MESSAGE_LENGTH = 2048;
 	char messageLiteral[MAXIMUM_MESSAGE_LENGTH];
 
-	va_list variableArgumentList;
-	va_start(variableArgumentList, messageFormat);
 	vsnprintf_s(messageLiteral, MAXIMUM_MESSAGE_LENGTH, _TRUNCATE, messageFormat, variableArgumentList);
-	va_end(variableArgumentList);
-
 	messageLiteral[MAXIMUM_MESSAGE_LENGTH - 1] = '\0';
 
-	LogMessage* newLogMessage = new LogMessage(messageLiteral, GetTimeStampForCurrentTime(), logLevel, "Default");
+	LogMessage* newLogMessage = nullptr;
+	if (simpleForm)
+	{
+		newLogMessage = new LogMessage(messageLiteral);
+	}
+	else
+	{
+		newLogMessage = new LogMessage(messageLiteral, GetTimeStampForCurrentTime(), logLevel, messageTag, currentCallStack);
+	}
+
 	g_LoggerSystem->m_AllLogMessages.Enqueue(newLogMessage);
 }
 
 
 
-void PrintToLogWithCallStack(CallStack* currentCallStack, const char* messageFormat, ...)
+void PrintToLog(const char* messageFormat, ...)
 {
-	const int MAXIMUM_MESSAGE_LENGTH = 2048;
-	char messageLiteral[MAXIMUM_MESSAGE_LENGTH];
+	va_list variableArgumentList;
+	va_start(variableArgumentList, messageFormat);
+	EnqueueLogMessage(false, "Default", LOG_DEFAULT, nullptr, messageFormat, variableArgumentList);
+	va_end(variableArgumentList);
+}
+
+
 
+void PrintToLogSimple(const char* messageFormat, ...)
+{
 	va_list variableArgumentList;
 	va_start(variableArgumentList, messageFormat);
-	vsnprintf_s(messageLiteral, MAXIMUM_MESSAGE_LENGTH, _TRUNCATE, messageFormat, variableArgumentList);
+	EnqueueLogMessage(true, "", LOG_NONE, nullptr, messageFormat, variableArgumentList);
 	va_end(variableArgumentList);
+}
 
-	messageLiteral[MAXIMUM_MESSAGE_LENGTH - 1] = '\0';
 
-	LogMessage* newLogMessage = new LogMessage(messageLiteral, GetTimeStampForCurrentTime(), LOG_DEFAULT, "Default", currentCallStack);
-	g_LoggerSystem->m_AllLogMessages.Enqueue(newLogMessage);
+
+void PrintToLogWithTag(const char* messageTag, const char* messageFormat, ...)
+{
+	va_list variableArgumentList;
+	va_start(variableArgumentList, messageFormat);
+	EnqueueLogMessage(false, messageTag, LOG_DEFAULT, nullptr, messageFormat, variableArgumentList);
+	va_end(variableArgumentList);
 }
 
 
 
-void PrintToLogWithEverything(const char* messageTag, const LogLevel& logLevel, CallStack* currentCallStack, const char* messageFormat, ...)
+void PrintToLogWithLogLevel(const LogLevel& logLevel, const char* messageFormat, ...)
 {
-	const int MAXIMUM_MESSAGE_LENGTH = 2048;
-	char messageLiteral[MAXIMUM_MESSAGE_LENGTH];
+	va_list variableArgumentList;
+	va_start(variableArgumentList, messageFormat);
+	EnqueueLogMessage(false, "Default", logLevel, nullptr, messageFormat, variableArgumentList);
+	va_end(variableArgumentList);
+}
+
 
+
+void PrintToLogWithCallStack(CallStack* currentCallStack, const char* messageFormat, ...)
+{
 	va_list variableArgumentList;
 	va_start(variableArgumentList, messageFormat);
-	vsnprintf_s(messageLiteral, MAXIMUM_MESSAGE_LENGTH, _TRUNCATE, messageFormat, variableArgumentList);
+	EnqueueLogMessage(false, "Default", LOG_DEFAULT, currentCallStack, messageFormat, variableArgumentList);
 	va_end(variableArgumentList);
+}
 
-	messageLiteral[MAXIMUM_MESSAGE_LENGTH - 1] = '\0';
 
-	LogMessage* newLogMessage = new LogMessage(messageLiteral, GetTimeStampForCurrentTime(), logLevel, messageTag, currentCallStack);
-	g_LoggerSystem->m_AllLogMessages.Enqueue(newLogMessage);
+
+void PrintToLogWithEverything(const char* messageTag, const LogLevel& logLevel, CallStack* currentCallStack, const char* messageFormat, ...)
+{
+	va_list variableArgumentList;
+	va_start(variableArgumentList, messageFormat);
+	EnqueueLogMessage(false, messageTag, logLevel, currentCallStack, messageFormat, variableArgumentList);
+	va_end(variableArgumentList);
 }
\ No newline at end of file
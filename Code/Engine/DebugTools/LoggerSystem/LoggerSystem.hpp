@@ -1,11 +1,16 @@
 #pragma once
 
 #include "Engine/DataStructures/ThreadSafeQueue.hpp"
+#include "Engine/DebugTools/LoggerSystem/BinaryLogFormat.hpp"
+#include "Engine/DebugTools/LoggerSystem/LogRotation.hpp"
 #include "Engine/DebugTools/MemoryAnalytics/CallStack.hpp"
 #include "Engine/IO Utilities/BinaryFileIO.hpp"
 #include "Engine/Threading/Thread.hpp"
 #include "Engine/Time/Time.hpp"
 
+#include <deque>
+#include <map>
+
 
 
 enum LogLevel
@@ -18,6 +23,14 @@ enum LogLevel
 
 
 
+enum LoggingMode
+{
+	TEXT_LOGGING_MODE,
+	BINARY_LOGGING_MODE
+};
+
+
+
 class LogMessage
 {
 public:
@@ -39,23 +52,55 @@ public:
 
 
 
+class BinaryLogMessage
+{
+public:
+	BinaryLogMessage(const char* messageFormat, va_list variableArgumentList);
+	BinaryLogMessage(const char* messageFormat, va_list variableArgumentList, int64_t messageRawTime, const LogLevel& logLevel, const char* messageTag, CallStack* currentCallStack = nullptr);
+
+public:
+	bool m_SimpleForm;
+	const char* m_MessageFormat;
+	int64_t m_MessageRawTime;
+
+	LogLevel m_LogLevel;
+	char m_MessageTag[MAXIMUM_LOG_TAG_LENGTH];
+
+	CallStack* m_CurrentCallStack;
+
+	size_t m_ArgumentDataSize;
+	unsigned char m_ArgumentData[MAXIMUM_LOG_ARGUMENT_DATA_SIZE];
+};
+
+
+
 class LoggerSystem
 {
 private:
 	LoggerSystem();
 
 public:
-	static void InitializeLoggerSystem(const char* loggerName);
+	static void InitializeLoggerSystem(const char* loggerName, const LoggingMode& loggingMode = TEXT_LOGGING_MODE, const LogRotationSettings& rotationSettings = LogRotationSettings());
 	static void UninitializeLoggerSystem();
 
 	void FlushLogger();
 
 public:
 	TS_Queue<LogMessage*> m_AllLogMessages;
+	TS_Queue<BinaryLogMessage*> m_AllBinaryLogMessages;
 	Thread* m_LoggerThread;
 
+	TS_Queue<std::string*> m_AllRotatedLogFiles;
+	Thread* m_MaintenanceThread;
+	LogRotationSettings m_RotationSettings;
+
+	std::map<const char*, uint32_t> m_BinaryFormatStringIDs;
+	std::map<std::string, uint32_t> m_BinaryTagStringIDs;
+
 	const char* m_LoggerName;
+	LoggingMode m_LoggingMode;
 	bool m_IsRunning;
+	bool m_MaintenanceIsRunning;
 	bool m_FlushLogs;
 };
 
@@ -65,7 +110,23 @@ extern LoggerSystem* g_LoggerSystem;
 
 void MessageLoggingThread(void* messageLogger);
 void HandleMessagesInQueue(LoggerSystem* loggerSystem, BinaryFileWriter& fileWriter);
-void MakeDefaultFileCopy(LoggerSystem* loggerSystem, const char* fileName);
+
+void GetLogSegmentFileName(LoggerSystem* loggerSystem, const TimeStampData& startingTimeStamp, uint32_t segmentIndex, char* fileName, size_t fileNameLength);
+void GetLatestLogFileName(LoggerSystem* loggerSystem, char* fileName, size_t fileNameLength);
+bool OpenLogSegment(LoggerSystem* loggerSystem, BinaryFileWriter& fileWriter, const char* fileName);
+bool LogSegmentNeedsRotation(LoggerSystem* loggerSystem, const BinaryFileWriter& fileWriter, double segmentStartingTime);
+
+void LogMaintenanceThread(void* messageLogger);
+void HandleRotatedLogFiles(LoggerSystem* loggerSystem, std::deque<std::string>& retainedLogFiles);
+
+void WriteBinaryLogHeader(BinaryFileWriter& fileWriter);
+void WriteBinaryLogMessage(LoggerSystem* loggerSystem, BinaryFileWriter& fileWriter, BinaryLogMessage* binaryLogMessage);
+uint32_t GetBinaryFormatStringID(LoggerSystem* loggerSystem, BinaryFileWriter& fileWriter, const char* messageFormat);
+uint32_t GetBinaryTagStringID(LoggerSystem* loggerSystem, BinaryFileWriter& fileWriter, const char* messageTag);
+
+std::string GetCallStackText(const CallStackLine* callStackLines, size_t numberOfCallStackLines);
+
+void EnqueueLogMessage(bool simpleForm, const char* messageTag, const LogLevel& logLevel, CallStack* currentCallStack, const char* messageFormat, va_list variableArgumentList);
 
 void PrintToLog(const char* messageFormat, ...);
 void PrintToLogSimple(const char* messageFormat, ...);
@@ -0,0 +1,340 @@
+#include "Engine/DebugTools/MemoryAnalytics/AllocationSampler.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/CallStack.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+#include "Engine/IO Utilities/BinaryFileIO.hpp"
+
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#include <Psapi.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#pragma comment(lib, "psapi.lib")
+
+
+
+AllocationSampleTable g_AllocationSampleTable;
+
+static std::atomic<size_t> s_SamplingIntervalInBytes(DEFAULT_SAMPLING_INTERVAL_IN_BYTES);
+
+thread_local bool t_SamplerIsInitialized = false;
+thread_local uint64_t t_SamplerRandomState = 0U;
+thread_local int64_t t_BytesUntilNextSample = 0;
+
+
+
+static double GetNextSamplerRandomValue()
+{
+	if (t_SamplerRandomState == 0U)
+	{
+		t_SamplerRandomState = (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&t_SamplerRandomState)) * 0x9E3779B97F4A7C15ULL) | 1U;
+	}
+
+	t_SamplerRandomState ^= t_SamplerRandomState >> 12;
+	t_SamplerRandomState ^= t_SamplerRandomState << 25;
+	t_SamplerRandomState ^= t_SamplerRandomState >> 27;
+
+	uint64_t randomBits = (t_SamplerRandomState * 0x2545F4914F6CDD1DULL) >> 11;
+
+	return (static_cast<double>(randomBits) + 1.0) * (1.0 / 9007199254740992.0);
+}
+
+
+
+static int64_t GetNextSamplingDistance()
+{
+	double samplingInterval = static_cast<double>(s_SamplingIntervalInBytes.load(std::memory_order_relaxed));
+
+	return static_cast<int64_t>(-log(GetNextSamplerRandomValue()) * samplingInterval) + 1;
+}
+
+
+
+void SetAllocationSamplingInterval(size_t samplingIntervalInBytes)
+{
+	s_SamplingIntervalInBytes.store((samplingIntervalInBytes > 0U) ? samplingIntervalInBytes : 1U, std::memory_order_relaxed);
+}
+
+
+
+size_t GetAllocationSamplingInterval()
+{
+	return s_SamplingIntervalInBytes.load(std::memory_order_relaxed);
+}
+
+
+
+bool ShouldSampleAllocation(size_t numberOfBytes)
+{
+	if (!t_SamplerIsInitialized)
+	{
+		t_BytesUntilNextSample = GetNextSamplingDistance();
+		t_SamplerIsInitialized = true;
+	}
+
+	t_BytesUntilNextSample -= static_cast<int64_t>(numberOfBytes);
+	if (t_BytesUntilNextSample > 0)
+	{
+		return false;
+	}
+
+	t_BytesUntilNextSample = GetNextSamplingDistance();
+
+	return true;
+}
+
+
+
+uintptr_t AllocationSampleTable::GetAddressHash(uintptr_t allocationAddress)
+{
+	uint64_t addressHash = static_cast<uint64_t>(allocationAddress >> 4) * 0x9E3779B97F4A7C15ULL;
+
+	return static_cast<uintptr_t>(addressHash >> 16);
+}
+
+
+
+bool AllocationSampleTable::InsertSample(void* allocationAddress, size_t numberOfBytes, size_t skippedFramesOffset)
+{
+	uintptr_t sampleAddress = reinterpret_cast<uintptr_t>(allocationAddress);
+	uintptr_t addressHash = GetAddressHash(sampleAddress);
+
+	AllocationSampleShard& sampleShard = m_Shards[addressHash % NUMBER_OF_SAMPLE_SHARDS];
+	size_t startingSlotIndex = (addressHash / NUMBER_OF_SAMPLE_SHARDS) % NUMBER_OF_SAMPLES_PER_SHARD;
+
+	for (size_t probeIndex = 0; probeIndex < MAXIMUM_SAMPLE_PROBE_LENGTH; ++probeIndex)
+	{
+		AllocationSample& currentSample = sampleShard.m_Samples[(startingSlotIndex + probeIndex) % NUMBER_OF_SAMPLES_PER_SHARD];
+
+		uintptr_t slotState = currentSample.m_Address.load(std::memory_order_relaxed);
+		if (slotState != EMPTY_SAMPLE_SLOT && slotState != REMOVED_SAMPLE_SLOT)
+		{
+			continue;
+		}
+
+		if (currentSample.m_Address.compare_exchange_strong(slotState, RESERVED_SAMPLE_SLOT, std::memory_order_acquire))
+		{
+			currentSample.m_NumberOfBytes = numberOfBytes;
+			currentSample.m_NumberOfCallStackFrames = CaptureCallStackFrames(1 + skippedFramesOffset, currentSample.m_CallStackFrames, MAXIMUM_SAMPLED_CALLSTACK_DEPTH);
+			currentSample.m_Address.store(sampleAddress, std::memory_order_release);
+
+			return true;
+		}
+	}
+
+	m_NumberOfDroppedSamples.fetch_add(1U, std::memory_order_relaxed);
+
+	return false;
+}
+
+
+
+bool AllocationSampleTable::RemoveSample(void* allocationAddress)
+{
+	uintptr_t sampleAddress = reinterpret_cast<uintptr_t>(allocationAddress);
+	uintptr_t addressHash = GetAddressHash(sampleAddress);
+
+	AllocationSampleShard& sampleShard = m_Shards[addressHash % NUMBER_OF_SAMPLE_SHARDS];
+	size_t startingSlotIndex = (addressHash / NUMBER_OF_SAMPLE_SHARDS) % NUMBER_OF_SAMPLES_PER_SHARD;
+
+	for (size_t probeIndex = 0; probeIndex < MAXIMUM_SAMPLE_PROBE_LENGTH; ++probeIndex)
+	{
+		AllocationSample& currentSample = sampleShard.m_Samples[(startingSlotIndex + probeIndex) % NUMBER_OF_SAMPLES_PER_SHARD];
+
+		uintptr_t slotState = currentSample.m_Address.load(std::memory_order_acquire);
+		if (slotState == sampleAddress)
+		{
+			currentSample.m_Address.store(REMOVED_SAMPLE_SLOT, std::memory_order_release);
+
+			return true;
+		}
+
+		if (slotState == EMPTY_SAMPLE_SLOT)
+		{
+			break;
+		}
+	}
+
+	return false;
+}
+
+
+
+size_t AllocationSampleTable::GetNumberOfDroppedSamples() const
+{
+	return m_NumberOfDroppedSamples.load(std::memory_order_relaxed);
+}
+
+
+
+size_t CollectHeapProfileEntries(HeapProfileEntry* profileEntries, size_t maximumNumberOfEntries)
+{
+	size_t numberOfEntries = 0U;
+
+	for (size_t shardIndex = 0; shardIndex < NUMBER_OF_SAMPLE_SHARDS; ++shardIndex)
+	{
+		for (size_t sampleIndex = 0; sampleIndex < NUMBER_OF_SAMPLES_PER_SHARD; ++sampleIndex)
+		{
+			AllocationSample& currentSample = g_AllocationSampleTable.m_Shards[shardIndex].m_Samples[sampleIndex];
+			if (currentSample.m_Address.load(std::memory_order_acquire) < NUMBER_OF_SAMPLE_SLOT_STATES)
+			{
+				continue;
+			}
+
+			size_t numberOfCallStackFrames = currentSample.m_NumberOfCallStackFrames;
+			if (numberOfCallStackFrames > MAXIMUM_SAMPLED_CALLSTACK_DEPTH)
+			{
+				numberOfCallStackFrames = MAXIMUM_SAMPLED_CALLSTACK_DEPTH;
+			}
+
+			if (numberOfEntries >= maximumNumberOfEntries)
+			{
+				return numberOfEntries;
+			}
+
+			HeapProfileEntry& newEntry = profileEntries[numberOfEntries];
+			newEntry.m_NumberOfBytes = currentSample.m_NumberOfBytes;
+			newEntry.m_NumberOfCallStackFrames = numberOfCallStackFrames;
+			memcpy(newEntry.m_CallStackFrames, currentSample.m_CallStackFrames, sizeof(void*) * numberOfCallStackFrames);
+
+			++numberOfEntries;
+		}
+	}
+
+	return numberOfEntries;
+}
+
+
+
+static void WriteProfileLine(BinaryFileWriter& fileWriter, const char* lineFormat, ...)
+{
+	char lineLiteral[1024];
+
+	va_list variableArgumentList;
+	va_start(variableArgumentList, lineFormat);
+	int lineLength = vsnprintf_s(lineLiteral, sizeof(lineLiteral), _TRUNCATE, lineFormat, variableArgumentList);
+	va_end(variableArgumentList);
+
+	if (lineLength > 0)
+	{
+		fileWriter.WriteBytes(lineLiteral, static_cast<size_t>(lineLength));
+	}
+}
+
+
+
+static void WriteMappedLibraries(BinaryFileWriter& fileWriter)
+{
+	WriteProfileLine(fileWriter, "\nMAPPED_LIBRARIES:\n");
+
+	HANDLE currentProcess = GetCurrentProcess();
+	HMODULE processModules[1024];
+	DWORD bytesNeeded = 0;
+
+	if (!EnumProcessModules(currentProcess, processModules, sizeof(processModules), &bytesNeeded))
+	{
+		return;
+	}
+
+	size_t numberOfModules = bytesNeeded / sizeof(HMODULE);
+	if (numberOfModules > sizeof(processModules) / sizeof(HMODULE))
+	{
+		numberOfModules = sizeof(processModules) / sizeof(HMODULE);
+	}
+
+	for (size_t moduleIndex = 0; moduleIndex < numberOfModules; ++moduleIndex)
+	{
+		MODULEINFO moduleInfo;
+		char moduleFileName[MAX_PATH];
+
+		if (GetModuleInformation(currentProcess, processModules[moduleIndex], &moduleInfo, sizeof(moduleInfo)) &&
+			GetModuleFileNameExA(currentProcess, processModules[moduleIndex], moduleFileName, MAX_PATH) > 0)
+		{
+			uintptr_t moduleStart = reinterpret_cast<uintptr_t>(moduleInfo.lpBaseOfDll);
+			uintptr_t moduleEnd = moduleStart + moduleInfo.SizeOfImage;
+
+			WriteProfileLine(fileWriter, "%016llx-%016llx r-xp 00000000 00:00 0 %s\n", static_cast<uint64_t>(moduleStart), static_cast<uint64_t>(moduleEnd), moduleFileName);
+		}
+	}
+}
+
+
+
+bool DumpHeapProfile(const char* fileName)
+{
+	const size_t MAXIMUM_NUMBER_OF_PROFILE_ENTRIES = NUMBER_OF_SAMPLE_SHARDS * NUMBER_OF_SAMPLES_PER_SHARD;
+
+	HeapProfileEntry* profileEntries = (HeapProfileEntry*)malloc(sizeof(HeapProfileEntry) * MAXIMUM_NUMBER_OF_PROFILE_ENTRIES);
+	if (profileEntries == nullptr)
+	{
+		return false;
+	}
+
+	size_t numberOfEntries = CollectHeapProfileEntries(profileEntries, MAXIMUM_NUMBER_OF_PROFILE_ENTRIES);
+
+	BinaryFileWriter fileWriter;
+	if (!fileWriter.OpenBinaryFile(fileName))
+	{
+		free(profileEntries);
+
+		return false;
+	}
+
+	size_t totalNumberOfSampledBytes = 0U;
+	for (size_t entryIndex = 0; entryIndex < numberOfEntries; ++entryIndex)
+	{
+		totalNumberOfSampledBytes += profileEntries[entryIndex].m_NumberOfBytes;
+	}
+
+	WriteProfileLine(fileWriter, "heap profile: %llu: %llu [%llu: %llu] @ heap_v2/%llu\n",
+		static_cast<uint64_t>(numberOfEntries),
+		static_cast<uint64_t>(totalNumberOfSampledBytes),
+		static_cast<uint64_t>(numberOfEntries),
+		static_cast<uint64_t>(totalNumberOfSampledBytes),
+		static_cast<uint64_t>(GetAllocationSamplingInterval()));
+
+	for (size_t entryIndex = 0; entryIndex < numberOfEntries; ++entryIndex)
+	{
+		const HeapProfileEntry& currentEntry = profileEntries[entryIndex];
+
+		WriteProfileLine(fileWriter, "1: %llu [1: %llu] @", static_cast<uint64_t>(currentEntry.m_NumberOfBytes), static_cast<uint64_t>(currentEntry.m_NumberOfBytes));
+
+		for (size_t frameIndex = 0; frameIndex < currentEntry.m_NumberOfCallStackFrames; ++frameIndex)
+		{
+			WriteProfileLine(fileWriter, " 0x%016llx", static_cast<uint64_t>(reinterpret_cast<uintptr_t>(currentEntry.m_CallStackFrames[frameIndex])));
+		}
+
+		WriteProfileLine(fileWriter, "\n");
+	}
+
+	WriteMappedLibraries(fileWriter);
+
+	fileWriter.CloseBinaryFile();
+	free(profileEntries);
+
+	return true;
+}
+
+
+
+void DumpHeapProfileCommand(Command& currentCommand)
+{
+	ConsoleLine dumpMessage;
+
+	std::vector<std::string> currentCommandArguments;
+	currentCommand.GetCommandArguments(currentCommandArguments);
+
+	std::string profileFileName = (currentCommandArguments.empty()) ? "Logs/HeapProfile.heap" : currentCommandArguments[0];
+
+	if (DumpHeapProfile(profileFileName.c_str()))
+	{
+		dumpMessage = ConsoleLine("Heap profile dumped to " + profileFileName + ".", RGBA::GREEN);
+	}
+	else
+	{
+		dumpMessage = ConsoleLine("Heap profile could not be dumped.", RGBA::RED);
+	}
+
+	DeveloperConsole::AddNewConsoleLine(dumpMessage);
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Engine/DeveloperConsole/Command.hpp"
+
+#include <atomic>
+#include <stdint.h>
+
+
+
+const size_t DEFAULT_SAMPLING_INTERVAL_IN_BYTES = 512 * 1024;
+const size_t MAXIMUM_SAMPLED_CALLSTACK_DEPTH = 32;
+
+const size_t NUMBER_OF_SAMPLE_SHARDS = 16;
+const size_t NUMBER_OF_SAMPLES_PER_SHARD = 1024;
+const size_t MAXIMUM_SAMPLE_PROBE_LENGTH = 64;
+
+const size_t SAMPLED_ALLOCATION_FLAG = static_cast<size_t>(1) << (sizeof(size_t) * 8 - 1);
+
+
+
+enum AllocationSampleState : uintptr_t
+{
+	EMPTY_SAMPLE_SLOT,
+	RESERVED_SAMPLE_SLOT,
+	REMOVED_SAMPLE_SLOT,
+	NUMBER_OF_SAMPLE_SLOT_STATES
+};
+
+
+
+struct AllocationSample
+{
+	std::atomic<uintptr_t> m_Address;
+	size_t m_NumberOfBytes;
+
+	size_t m_NumberOfCallStackFrames;
+	void* m_CallStackFrames[MAXIMUM_SAMPLED_CALLSTACK_DEPTH];
+};
+
+
+
+struct AllocationSampleShard
+{
+	AllocationSample m_Samples[NUMBER_OF_SAMPLES_PER_SHARD];
+};
+
+
+
+class AllocationSampleTable
+{
+public:
+	bool InsertSample(void* allocationAddress, size_t numberOfBytes, size_t skippedFramesOffset);
+	bool RemoveSample(void* allocationAddress);
+
+	size_t GetNumberOfDroppedSamples() const;
+
+private:
+	static uintptr_t GetAddressHash(uintptr_t allocationAddress);
+
+public:
+	AllocationSampleShard m_Shards[NUMBER_OF_SAMPLE_SHARDS];
+
+private:
+	std::atomic<size_t> m_NumberOfDroppedSamples;
+};
+
+
+
+struct HeapProfileEntry
+{
+	size_t m_NumberOfBytes;
+
+	size_t m_NumberOfCallStackFrames;
+	void* m_CallStackFrames[MAXIMUM_SAMPLED_CALLSTACK_DEPTH];
+};
+
+
+
+extern AllocationSampleTable g_AllocationSampleTable;
+
+
+
+void SetAllocationSamplingInterval(size_t samplingIntervalInBytes);
+size_t GetAllocationSamplingInterval();
+bool ShouldSampleAllocation(size_t numberOfBytes);
+
+size_t CollectHeapProfileEntries(HeapProfileEntry* profileEntries, size_t maximumNumberOfEntries);
+bool DumpHeapProfile(const char* fileName);
+
+
+
+void DumpHeapProfileCommand(Command& currentCommand);
\ No newline at end of file
@@ -94,6 +94,13 @@ CallStack* RetrieveCallStack(size_t skippedFramesOffset)
 
 
 
+size_t CaptureCallStackFrames(size_t skippedFramesOffset, void** callStackFrames, size_t maximumNumberOfFrames)
+{
+	return CaptureStackBackTrace(static_cast<DWORD>(1 + skippedFramesOffset), static_cast<DWORD>(maximumNumberOfFrames), callStackFrames, NULL);
+}
+
+
+
 void DiscardCallStack(CallStack* callStack)
 {
 	free(callStack);
@@ -23,6 +23,7 @@ bool InitializeCallStackSystem();
 void UninitializeCallStackSystem();
 
 CallStack* RetrieveCallStack(size_t skippedFramesOffset);
+size_t CaptureCallStackFrames(size_t skippedFramesOffset, void** callStackFrames, size_t maximumNumberOfFrames);
 void DiscardCallStack(CallStack* callStack);
 
 CallStackLine* GetCallStackLines(CallStack* callStack);
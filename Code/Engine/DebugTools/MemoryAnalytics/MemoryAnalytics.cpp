@@ -1,6 +1,9 @@
 #include "Engine/DebugTools/MemoryAnalytics/MemoryAnalytics.hpp"
 #include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
 #include "Engine/DebugTools/MemoryAnalytics/UntrackedAllocator.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/AllocationSampler.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
 
 #include <map>
 
@@ -17,6 +20,14 @@ std::map<void*, CallStack*, std::less<void*>, UntrackedAllocator<std::pair<void*
 
 
 
+struct AllocationHeader
+{
+	size_t m_NumberOfBytes;
+	size_t m_AllocationInfo;
+};
+
+
+
 void* operator new(size_t numberOfBytes)
 {
 #if (ANALYTICS_MODE == 0)
@@ -27,7 +38,7 @@ void* operator new(size_t numberOfBytes)
 
 #elif (ANALYTICS_MODE == 1)
 	
-	size_t* pointerToObject = (size_t*)malloc(numberOfBytes + sizeof(size_t));
+	AllocationHeader* allocationHeader = (AllocationHeader*)malloc(numberOfBytes + sizeof(AllocationHeader));
 	
 	++g_NumberOfAllocations;
 	if (g_NumberOfAllocations > g_MaximumNumberOfAllocations)
@@ -37,14 +48,15 @@ void* operator new(size_t numberOfBytes)
 
 	g_AllocatedMemoryInBytes += numberOfBytes;
 	
-	*pointerToObject = numberOfBytes;
-	++pointerToObject;
+	allocationHeader->m_NumberOfBytes = numberOfBytes;
+	allocationHeader->m_AllocationInfo = TrackTaggedAllocation(numberOfBytes);
+	void* pointerToObject = (void*)(allocationHeader + 1);
 	
 	return (void*)pointerToObject;
 
 #elif (ANALYTICS_MODE == 2)
 
-	size_t* pointerToObject = (size_t*)malloc(numberOfBytes + sizeof(size_t));
+	AllocationHeader* allocationHeader = (AllocationHeader*)malloc(numberOfBytes + sizeof(AllocationHeader));
 	
 	++g_NumberOfAllocations;
 	if (g_NumberOfAllocations > g_MaximumNumberOfAllocations)
@@ -54,13 +66,29 @@ void* operator new(size_t numberOfBytes)
 
 	g_AllocatedMemoryInBytes += numberOfBytes;
 	
-	*pointerToObject = numberOfBytes;
-	++pointerToObject;
+	allocationHeader->m_NumberOfBytes = numberOfBytes;
+	allocationHeader->m_AllocationInfo = TrackTaggedAllocation(numberOfBytes);
+	void* pointerToObject = (void*)(allocationHeader + 1);
 
 	g_CallStackRegistry[(void*)pointerToObject] = RetrieveCallStack(1);
 	
 	return (void*)pointerToObject;
 
+#elif (ANALYTICS_MODE == 3)
+
+	AllocationHeader* allocationHeader = (AllocationHeader*)malloc(numberOfBytes + sizeof(AllocationHeader));
+	
+	allocationHeader->m_NumberOfBytes = numberOfBytes;
+	allocationHeader->m_AllocationInfo = TrackTaggedAllocation(numberOfBytes);
+	void* pointerToObject = (void*)(allocationHeader + 1);
+
+	if (ShouldSampleAllocation(numberOfBytes) && g_AllocationSampleTable.InsertSample(pointerToObject, numberOfBytes, 1))
+	{
+		allocationHeader->m_AllocationInfo |= SAMPLED_ALLOCATION_FLAG;
+	}
+	
+	return (void*)pointerToObject;
+
 #endif
 }
 
@@ -76,28 +104,45 @@ void* operator new[](size_t numberOfBytes)
 
 #elif (ANALYTICS_MODE == 1)
 
-	size_t* pointerToObject = (size_t*)malloc(numberOfBytes + sizeof(size_t));
+	AllocationHeader* allocationHeader = (AllocationHeader*)malloc(numberOfBytes + sizeof(AllocationHeader));
 	++g_NumberOfAllocations;
 	g_AllocatedMemoryInBytes += numberOfBytes;
 	
-	*pointerToObject = numberOfBytes;
-	++pointerToObject;
+	allocationHeader->m_NumberOfBytes = numberOfBytes;
+	allocationHeader->m_AllocationInfo = TrackTaggedAllocation(numberOfBytes);
+	void* pointerToObject = (void*)(allocationHeader + 1);
 
 	return (void*)pointerToObject;
 
 #elif (ANALYTICS_MODE == 2)
 
-	size_t* pointerToObject = (size_t*)malloc(numberOfBytes + sizeof(size_t));
+	AllocationHeader* allocationHeader = (AllocationHeader*)malloc(numberOfBytes + sizeof(AllocationHeader));
 	++g_NumberOfAllocations;
 	g_AllocatedMemoryInBytes += numberOfBytes;
 	
-	*pointerToObject = numberOfBytes;
-	++pointerToObject;
+	allocationHeader->m_NumberOfBytes = numberOfBytes;
+	allocationHeader->m_AllocationInfo = TrackTaggedAllocation(numberOfBytes);
+	void* pointerToObject = (void*)(allocationHeader + 1);
 	
 	g_CallStackRegistry[(void*)pointerToObject] = RetrieveCallStack(1);
 	
 	return (void*)pointerToObject;
 
+#elif (ANALYTICS_MODE == 3)
+
+	AllocationHeader* allocationHeader = (AllocationHeader*)malloc(numberOfBytes + sizeof(AllocationHeader));
+	
+	allocationHeader->m_NumberOfBytes = numberOfBytes;
+	allocationHeader->m_AllocationInfo = TrackTaggedAllocation(numberOfBytes);
+	void* pointerToObject = (void*)(allocationHeader + 1);
+
+	if (ShouldSampleAllocation(numberOfBytes) && g_AllocationSampleTable.InsertSample(pointerToObject, numberOfBytes, 1))
+	{
+		allocationHeader->m_AllocationInfo |= SAMPLED_ALLOCATION_FLAG;
+	}
+	
+	return (void*)pointerToObject;
+
 #endif
 }
 
@@ -116,25 +161,25 @@ void operator delete(void* pointerToObject)
 
 #elif (ANALYTICS_MODE == 1)
 	
-	size_t* pointerToSize = (size_t*)pointerToObject;
-	--pointerToSize;
+	AllocationHeader* allocationHeader = ((AllocationHeader*)pointerToObject) - 1;
 
-	size_t numberOfBytes = *pointerToSize;
+	size_t numberOfBytes = allocationHeader->m_NumberOfBytes;
+	UntrackTaggedAllocation(allocationHeader->m_AllocationInfo, numberOfBytes);
 	--g_NumberOfAllocations;
 	g_AllocatedMemoryInBytes -= numberOfBytes;
 
-	free(pointerToSize);
+	free(allocationHeader);
 
 #elif (ANALYTICS_MODE == 2)
 
-	size_t* pointerToSize = (size_t*)pointerToObject;
-	--pointerToSize;
+	AllocationHeader* allocationHeader = ((AllocationHeader*)pointerToObject) - 1;
 
-	size_t numberOfBytes = *pointerToSize;
+	size_t numberOfBytes = allocationHeader->m_NumberOfBytes;
+	UntrackTaggedAllocation(allocationHeader->m_AllocationInfo, numberOfBytes);
 	--g_NumberOfAllocations;
 	g_AllocatedMemoryInBytes -= numberOfBytes;
 
-	free(pointerToSize);
+	free(allocationHeader);
 
 	auto callStackIterator = g_CallStackRegistry.find(pointerToObject);
 	if (callStackIterator != g_CallStackRegistry.end())
@@ -143,6 +188,18 @@ void operator delete(void* pointerToObject)
 		g_CallStackRegistry.erase(callStackIterator);
 	}
 
+#elif (ANALYTICS_MODE == 3)
+
+	AllocationHeader* allocationHeader = ((AllocationHeader*)pointerToObject) - 1;
+	UntrackTaggedAllocation(allocationHeader->m_AllocationInfo, allocationHeader->m_NumberOfBytes);
+
+	if ((allocationHeader->m_AllocationInfo & SAMPLED_ALLOCATION_FLAG) != 0U)
+	{
+		g_AllocationSampleTable.RemoveSample(pointerToObject);
+	}
+
+	free(allocationHeader);
+
 #endif
 }
 
@@ -161,25 +218,25 @@ void operator delete[](void* pointerToObject)
 
 #elif (ANALYTICS_MODE == 1)
 
-	size_t* pointerToSize = (size_t*)pointerToObject;
-	--pointerToSize;
+	AllocationHeader* allocationHeader = ((AllocationHeader*)pointerToObject) - 1;
 
-	size_t numberOfBytes = *pointerToSize;
+	size_t numberOfBytes = allocationHeader->m_NumberOfBytes;
+	UntrackTaggedAllocation(allocationHeader->m_AllocationInfo, numberOfBytes);
 	--g_NumberOfAllocations;
 	g_AllocatedMemoryInBytes -= numberOfBytes;
 
-	free(pointerToSize);
+	free(allocationHeader);
 
 #elif (ANALYTICS_MODE == 2)
 
-	size_t* pointerToSize = (size_t*)pointerToObject;
-	--pointerToSize;
+	AllocationHeader* allocationHeader = ((AllocationHeader*)pointerToObject) - 1;
 
-	size_t numberOfBytes = *pointerToSize;
+	size_t numberOfBytes = allocationHeader->m_NumberOfBytes;
+	UntrackTaggedAllocation(allocationHeader->m_AllocationInfo, numberOfBytes);
 	--g_NumberOfAllocations;
 	g_AllocatedMemoryInBytes -= numberOfBytes;
 
-	free(pointerToSize);
+	free(allocationHeader);
 
 	auto callStackIterator = g_CallStackRegistry.find(pointerToObject);
 	if (callStackIterator != g_CallStackRegistry.end())
@@ -188,6 +245,18 @@ void operator delete[](void* pointerToObject)
 		g_CallStackRegistry.erase(callStackIterator);
 	}
 
+#elif (ANALYTICS_MODE == 3)
+
+	AllocationHeader* allocationHeader = ((AllocationHeader*)pointerToObject) - 1;
+	UntrackTaggedAllocation(allocationHeader->m_AllocationInfo, allocationHeader->m_NumberOfBytes);
+
+	if ((allocationHeader->m_AllocationInfo & SAMPLED_ALLOCATION_FLAG) != 0U)
+	{
+		g_AllocationSampleTable.RemoveSample(pointerToObject);
+	}
+
+	free(allocationHeader);
+
 #endif
 }
 
@@ -200,6 +269,29 @@ void MemoryAnalyticsStartup()
 	g_AllocatedMemoryAtStartup = g_AllocatedMemoryInBytes;
 	DebuggerPrintf("\n\n\n\nAllocated Memory at Startup: %u bytes\n\n\n\n\n", g_AllocatedMemoryAtStartup);
 
+#elif (ANALYTICS_MODE == 3)
+
+	DeveloperConsole::RegisterCommands("DumpHeapProfile", "Dumps the sampled heap profile in pprof format. Takes the file name as an optional argument.", DumpHeapProfileCommand);
+	DebuggerPrintf("\n\n\n\nSampling allocations every %u bytes on average.\n\n\n\n\n", GetAllocationSamplingInterval());
+
+#endif
+
+#if (ANALYTICS_MODE != 0)
+
+	DeveloperConsole::RegisterCommands("DumpMemoryTags", "Dumps live, peak and allocation rate of every memory tag.", DumpMemoryTagsCommand);
+	DeveloperConsole::RegisterCommands("SetMemoryBudget", "Sets the budget of a memory tag. Takes the tag name and budget in bytes as arguments.", SetMemoryBudgetCommand);
+
+#endif
+}
+
+
+
+void MemoryAnalyticsUpdate()
+{
+#if (ANALYTICS_MODE != 0)
+
+	UpdateMemoryTagStatistics();
+
 #endif
 }
 
@@ -248,5 +340,10 @@ void MemoryAnalyticsShutdown()
 		DebuggerPrintf("\n");
 	}
 
+#elif (ANALYTICS_MODE == 3)
+
+	DumpHeapProfile("Logs/ShutdownHeapProfile.heap");
+	DebuggerPrintf("\n\n\n\nSampled heap profile at shutdown written to Logs/ShutdownHeapProfile.heap (%u samples dropped).\n\n\n\n\n", g_AllocationSampleTable.GetNumberOfDroppedSamples());
+
 #endif
 }
\ No newline at end of file
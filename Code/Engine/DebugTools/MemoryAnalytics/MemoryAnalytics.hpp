@@ -3,7 +3,7 @@
 #include "Engine/DebugTools/MemoryAnalytics/CallStack.hpp"
 #include "Engine/DeveloperConsole/Command.hpp"
 
-#define ANALYTICS_MODE 0
+#define ANALYTICS_MODE 0 // 0: Off, 1: Counters, 2: Counters and callstacks, 3: Sampled callstacks
 
 
 
@@ -15,4 +15,5 @@ extern size_t g_AllocatedMemoryInBytes;
 extern size_t g_AllocatedMemoryAtShutDown;
 
 void MemoryAnalyticsStartup();
+void MemoryAnalyticsUpdate();
 void MemoryAnalyticsShutdown();
\ No newline at end of file
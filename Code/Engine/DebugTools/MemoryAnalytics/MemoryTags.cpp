@@ -0,0 +1,264 @@
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
+#include "Engine/DebugTools/LoggerSystem/LoggerSystem.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+#include "Engine/ErrorHandling/StringUtils.hpp"
+#include "Engine/Time/Time.hpp"
+
+#include <string.h>
+
+
+
+static MemoryTagStats s_AllMemoryTags[MAXIMUM_NUMBER_OF_MEMORY_TAGS];
+static std::atomic<size_t> s_NumberOfMemoryTags;
+static std::atomic_flag s_MemoryTagRegistryLock = ATOMIC_FLAG_INIT;
+
+thread_local uint32_t t_MemoryTagStack[MAXIMUM_MEMORY_SCOPE_DEPTH];
+thread_local uint32_t t_MemoryTagStackDepth = 0U;
+
+
+
+ScopedMemoryTag::ScopedMemoryTag(uint32_t memoryTag)
+{
+	if (t_MemoryTagStackDepth < MAXIMUM_MEMORY_SCOPE_DEPTH)
+	{
+		t_MemoryTagStack[t_MemoryTagStackDepth] = memoryTag;
+	}
+
+	++t_MemoryTagStackDepth;
+}
+
+
+
+ScopedMemoryTag::~ScopedMemoryTag()
+{
+	--t_MemoryTagStackDepth;
+}
+
+
+
+uint32_t RegisterMemoryTag(const char* tagName)
+{
+	while (s_MemoryTagRegistryLock.test_and_set(std::memory_order_acquire))
+	{
+
+	}
+
+	if (s_NumberOfMemoryTags.load(std::memory_order_relaxed) == 0U)
+	{
+		CopyString(s_AllMemoryTags[UNTAGGED_MEMORY_TAG].m_TagName, "Untagged", MAXIMUM_MEMORY_TAG_NAME_LENGTH);
+		s_NumberOfMemoryTags.store(1U, std::memory_order_release);
+	}
+
+	size_t numberOfMemoryTags = s_NumberOfMemoryTags.load(std::memory_order_relaxed);
+	uint32_t memoryTag = UNTAGGED_MEMORY_TAG;
+	bool tagAlreadyExists = false;
+
+	for (size_t tagIndex = 0; tagIndex < numberOfMemoryTags; ++tagIndex)
+	{
+		if (strcmp(s_AllMemoryTags[tagIndex].m_TagName, tagName) == 0)
+		{
+			memoryTag = static_cast<uint32_t>(tagIndex);
+			tagAlreadyExists = true;
+
+			break;
+		}
+	}
+
+	if (!tagAlreadyExists && numberOfMemoryTags < MAXIMUM_NUMBER_OF_MEMORY_TAGS)
+	{
+		CopyString(s_AllMemoryTags[numberOfMemoryTags].m_TagName, tagName, MAXIMUM_MEMORY_TAG_NAME_LENGTH);
+		memoryTag = static_cast<uint32_t>(numberOfMemoryTags);
+		s_NumberOfMemoryTags.store(numberOfMemoryTags + 1U, std::memory_order_release);
+	}
+
+	s_MemoryTagRegistryLock.clear(std::memory_order_release);
+
+	return memoryTag;
+}
+
+
+
+uint32_t GetCurrentMemoryTag()
+{
+	if (t_MemoryTagStackDepth == 0U)
+	{
+		return UNTAGGED_MEMORY_TAG;
+	}
+
+	uint32_t stackIndex = (t_MemoryTagStackDepth <= MAXIMUM_MEMORY_SCOPE_DEPTH) ? t_MemoryTagStackDepth - 1U : MAXIMUM_MEMORY_SCOPE_DEPTH - 1U;
+
+	return t_MemoryTagStack[stackIndex];
+}
+
+
+
+size_t GetNumberOfMemoryTags()
+{
+	size_t numberOfMemoryTags = s_NumberOfMemoryTags.load(std::memory_order_acquire);
+
+	return (numberOfMemoryTags > 0U) ? numberOfMemoryTags : 1U;
+}
+
+
+
+MemoryTagStats* GetMemoryTagStats(uint32_t memoryTag)
+{
+	if (memoryTag >= MAXIMUM_NUMBER_OF_MEMORY_TAGS)
+	{
+		return nullptr;
+	}
+
+	return &s_AllMemoryTags[memoryTag];
+}
+
+
+
+size_t TrackTaggedAllocation(size_t numberOfBytes)
+{
+	uint32_t memoryTag = GetCurrentMemoryTag();
+	MemoryTagStats& tagStats = s_AllMemoryTags[memoryTag];
+
+	size_t liveBytes = tagStats.m_LiveBytes.fetch_add(numberOfBytes, std::memory_order_relaxed) + numberOfBytes;
+	tagStats.m_NumberOfLiveAllocations.fetch_add(1U, std::memory_order_relaxed);
+	tagStats.m_TotalAllocatedBytes.fetch_add(numberOfBytes, std::memory_order_relaxed);
+
+	size_t peakBytes = tagStats.m_PeakBytes.load(std::memory_order_relaxed);
+	while (liveBytes > peakBytes && !tagStats.m_PeakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed))
+	{
+
+	}
+
+	return static_cast<size_t>(memoryTag);
+}
+
+
+
+void UntrackTaggedAllocation(size_t allocationInfo, size_t numberOfBytes)
+{
+	MemoryTagStats& tagStats = s_AllMemoryTags[allocationInfo & MEMORY_TAG_INDEX_MASK];
+
+	tagStats.m_LiveBytes.fetch_sub(numberOfBytes, std::memory_order_relaxed);
+	tagStats.m_NumberOfLiveAllocations.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+
+
+bool SetMemoryTagBudget(const char* tagName, size_t budgetInBytes)
+{
+	uint32_t memoryTag = RegisterMemoryTag(tagName);
+	if (memoryTag == UNTAGGED_MEMORY_TAG && strcmp(tagName, "Untagged") != 0)
+	{
+		return false;
+	}
+
+	s_AllMemoryTags[memoryTag].m_BudgetInBytes.store(budgetInBytes, std::memory_order_relaxed);
+	s_AllMemoryTags[memoryTag].m_BudgetWarningIssued = false;
+
+	return true;
+}
+
+
+
+void UpdateMemoryTagStatistics()
+{
+	double currentTime = GetCurrentTimeInSeconds();
+	size_t numberOfMemoryTags = GetNumberOfMemoryTags();
+
+	for (size_t tagIndex = 0; tagIndex < numberOfMemoryTags; ++tagIndex)
+	{
+		MemoryTagStats& tagStats = s_AllMemoryTags[tagIndex];
+
+		uint64_t totalAllocatedBytes = tagStats.m_TotalAllocatedBytes.load(std::memory_order_relaxed);
+		double elapsedTime = currentTime - tagStats.m_LastUpdateTime;
+		if (elapsedTime > 0.0 && tagStats.m_LastUpdateTime > 0.0)
+		{
+			tagStats.m_AllocationRateInBytesPerSecond = static_cast<double>(totalAllocatedBytes - tagStats.m_LastTotalAllocatedBytes) / elapsedTime;
+		}
+
+		tagStats.m_LastTotalAllocatedBytes = totalAllocatedBytes;
+		tagStats.m_LastUpdateTime = currentTime;
+
+		size_t budgetInBytes = tagStats.m_BudgetInBytes.load(std::memory_order_relaxed);
+		size_t liveBytes = tagStats.m_LiveBytes.load(std::memory_order_relaxed);
+
+		if (budgetInBytes > 0U && liveBytes > budgetInBytes)
+		{
+			if (!tagStats.m_BudgetWarningIssued && g_LoggerSystem != nullptr)
+			{
+				PrintToLogWithEverything("Memory", LOG_RECOVERABLE, nullptr, "Memory tag %s is over budget: %u of %u bytes in use.", tagStats.m_TagName, liveBytes, budgetInBytes);
+			}
+
+			tagStats.m_BudgetWarningIssued = true;
+		}
+		else
+		{
+			tagStats.m_BudgetWarningIssued = false;
+		}
+	}
+}
+
+
+
+void DumpMemoryTagsCommand(Command& currentCommand)
+{
+	if (!currentCommand.HasNoArguments())
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("DumpMemoryTags takes no arguments.", RGBA::RED));
+
+		return;
+	}
+
+	UpdateMemoryTagStatistics();
+
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine("TAG | LIVE | PEAK | ALLOCATIONS | RATE | BUDGET", RGBA::GREEN));
+
+	size_t numberOfMemoryTags = GetNumberOfMemoryTags();
+	for (size_t tagIndex = 0; tagIndex < numberOfMemoryTags; ++tagIndex)
+	{
+		const MemoryTagStats& tagStats = s_AllMemoryTags[tagIndex];
+
+		size_t liveBytes = tagStats.m_LiveBytes.load(std::memory_order_relaxed);
+		size_t budgetInBytes = tagStats.m_BudgetInBytes.load(std::memory_order_relaxed);
+
+		std::string tagLine = Stringf("%s | %u B | %u B | %u | %.1f KB/s | %u B",
+			tagStats.m_TagName,
+			liveBytes,
+			tagStats.m_PeakBytes.load(std::memory_order_relaxed),
+			tagStats.m_NumberOfLiveAllocations.load(std::memory_order_relaxed),
+			tagStats.m_AllocationRateInBytesPerSecond / 1024.0,
+			budgetInBytes);
+
+		RGBA tagLineColor = (budgetInBytes > 0U && liveBytes > budgetInBytes) ? RGBA::RED : RGBA::WHITE;
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine(tagLine, tagLineColor));
+	}
+}
+
+
+
+void SetMemoryBudgetCommand(Command& currentCommand)
+{
+	ConsoleLine budgetMessage;
+
+	std::vector<std::string> currentCommandArguments;
+	currentCommand.GetCommandArguments(currentCommandArguments);
+
+	if (currentCommandArguments.size() == 2)
+	{
+		size_t budgetInBytes = static_cast<size_t>(strtoull(currentCommandArguments[1].c_str(), nullptr, 10));
+
+		if (SetMemoryTagBudget(currentCommandArguments[0].c_str(), budgetInBytes))
+		{
+			budgetMessage = ConsoleLine("Memory budget set.", RGBA::GREEN);
+		}
+		else
+		{
+			budgetMessage = ConsoleLine("Too many memory tags. Budget could not be set.", RGBA::RED);
+		}
+	}
+	else
+	{
+		budgetMessage = ConsoleLine("SetMemoryBudget takes the tag name and budget in bytes as arguments.", RGBA::RED);
+	}
+
+	DeveloperConsole::AddNewConsoleLine(budgetMessage);
+}
\ No newline at end of file
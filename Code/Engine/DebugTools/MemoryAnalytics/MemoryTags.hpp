@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Engine/DebugTools/MemoryAnalytics/MemoryAnalytics.hpp"
+#include "Engine/DeveloperConsole/Command.hpp"
+
+#include <atomic>
+#include <stdint.h>
+
+
+
+const size_t MAXIMUM_NUMBER_OF_MEMORY_TAGS = 64;
+const size_t MAXIMUM_MEMORY_TAG_NAME_LENGTH = 32;
+const size_t MAXIMUM_MEMORY_SCOPE_DEPTH = 32;
+
+const uint32_t UNTAGGED_MEMORY_TAG = 0U;
+const size_t MEMORY_TAG_INDEX_MASK = 0xFFU;
+
+
+
+#define MEMORY_TAG_CONCATENATE_INNER(firstToken, secondToken) firstToken##secondToken
+#define MEMORY_TAG_CONCATENATE(firstToken, secondToken) MEMORY_TAG_CONCATENATE_INNER(firstToken, secondToken)
+
+#if (ANALYTICS_MODE == 0)
+#define MEMORY_SCOPE(tagName)
+#else
+#define MEMORY_SCOPE(tagName) static const uint32_t MEMORY_TAG_CONCATENATE(s_MemoryTag_, __LINE__) = RegisterMemoryTag(tagName); ScopedMemoryTag MEMORY_TAG_CONCATENATE(memoryScope_, __LINE__)(MEMORY_TAG_CONCATENATE(s_MemoryTag_, __LINE__))
+#endif
+
+
+
+class ScopedMemoryTag
+{
+public:
+	ScopedMemoryTag(uint32_t memoryTag);
+	~ScopedMemoryTag();
+};
+
+
+
+struct MemoryTagStats
+{
+	char m_TagName[MAXIMUM_MEMORY_TAG_NAME_LENGTH];
+
+	std::atomic<size_t> m_LiveBytes;
+	std::atomic<size_t> m_PeakBytes;
+	std::atomic<size_t> m_NumberOfLiveAllocations;
+	std::atomic<uint64_t> m_TotalAllocatedBytes;
+
+	std::atomic<size_t> m_BudgetInBytes;
+	bool m_BudgetWarningIssued;
+
+	uint64_t m_LastTotalAllocatedBytes;
+	double m_LastUpdateTime;
+	double m_AllocationRateInBytesPerSecond;
+};
+
+
+
+uint32_t RegisterMemoryTag(const char* tagName);
+uint32_t GetCurrentMemoryTag();
+size_t GetNumberOfMemoryTags();
+MemoryTagStats* GetMemoryTagStats(uint32_t memoryTag);
+
+size_t TrackTaggedAllocation(size_t numberOfBytes);
+void UntrackTaggedAllocation(size_t allocationInfo, size_t numberOfBytes);
+
+bool SetMemoryTagBudget(const char* tagName, size_t budgetInBytes);
+void UpdateMemoryTagStatistics();
+
+
+
+void DumpMemoryTagsCommand(Command& currentCommand);
+void SetMemoryBudgetCommand(Command& currentCommand);
\ No newline at end of file
@@ -291,7 +291,12 @@ void DeveloperConsole::PrintAllConsoleLines() const
 
 	for (auto consoleLineReverseIterator = s_AllConsoleLines.rbegin(); consoleLineReverseIterator != s_AllConsoleLines.rend(); ++consoleLineReverseIterator)
 	{
-		ConsoleLine consoleLine = *consoleLineReverseIterator;
+		if (startingLetterMinimums.Y > m_ScreenBounds.maximums.Y)
+		{
+			break;
+		}
+
+		const ConsoleLine& consoleLine = *consoleLineReverseIterator;
 		PrintLineToConsole(startingLetterMinimums, m_CellHeight, consoleLine);
 
 		startingLetterMinimums.Y += lineSpacing;
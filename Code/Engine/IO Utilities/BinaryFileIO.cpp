@@ -36,6 +36,18 @@ bool BinaryFileWriter::FlushBinaryFile()
 
 
 
+size_t BinaryFileWriter::GetBinaryFileSize() const
+{
+	if (m_File != nullptr)
+	{
+		return static_cast<size_t>(ftell(m_File));
+	}
+
+	return 0U;
+}
+
+
+
 void BinaryFileWriter::CloseBinaryFile()
 {
 	if (m_File != nullptr)
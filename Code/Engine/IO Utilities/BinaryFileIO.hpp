@@ -11,6 +11,7 @@ public:
 
 	bool OpenBinaryFile(const char* fileName, bool appendToExistingFile = false);
 	bool FlushBinaryFile();
+	size_t GetBinaryFileSize() const;
 	void CloseBinaryFile();
 
 	virtual size_t WriteBytes(const void* byteData, const size_t numberOfBytes) const override;
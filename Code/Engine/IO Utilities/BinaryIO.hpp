@@ -17,8 +17,17 @@ enum EndianMode
 
 
 
+#if defined(_M_IX86) || defined(_M_X64) || defined(_M_ARM) || defined(_M_ARM64) || defined(__i386__) || defined(__x86_64__)
+#define LITTLE_ENDIAN_TARGET 1
+#endif
+
+
+
 inline EndianMode GetLocalEndianness()
 {
+#if defined(LITTLE_ENDIAN_TARGET)
+	return LITTLE_ENDIAN;
+#else
 	union
 	{
 		unsigned char byteData[4];
@@ -28,6 +37,7 @@ inline EndianMode GetLocalEndianness()
 	data.integerData = 0x04030201;
 
 	return (data.byteData[0] == 0x01) ? LITTLE_ENDIAN : BIG_ENDIAN;
+#endif
 }
 
 
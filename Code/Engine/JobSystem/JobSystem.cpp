@@ -7,7 +7,7 @@
 
 
 
-const size_t MAXIMUM_NUMBER_OF_JOBS = 1024;
+const size_t NUMBER_OF_JOBS_PER_POOL_CHUNK = 1024;
 
 JobSystem* g_JobSystem = nullptr;
 bool g_JobSystemIsRunning = false;
@@ -216,7 +216,7 @@ void JobSystem::InitializeJobThreads()
 
 void JobSystem::InitializeJobPool()
 {
-	m_JobPool.InitializeObjectPool(MAXIMUM_NUMBER_OF_JOBS);
+	m_JobPool.InitializeObjectPool(NUMBER_OF_JOBS_PER_POOL_CHUNK);
 }
 
 
@@ -3,7 +3,7 @@
 #include <vector>
 #include "Engine/Threading/Thread.hpp"
 #include "Engine/DataStructures/ThreadSafeQueue.hpp"
-#include "Engine/DataStructures/ObjectPool.hpp"
+#include "Engine/DataStructures/ConcurrentObjectPool.hpp"
 
 
 
@@ -114,7 +114,7 @@ public:
 
 	JobQueue** m_JobQueues;
 	Thread** m_JobThreads;
-	ObjectPool<Job> m_JobPool;
+	ConcurrentObjectPool<Job> m_JobPool;
 
 private:
 	JobConsumer* m_GenericJobConsumer;
@@ -1,5 +1,6 @@
 #include "Engine/Networking/TCP-IP/RemoteCommandService.hpp"
 #include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
 
 
 
@@ -15,17 +16,63 @@ m_Connection(newConnection)
 
 
 
-void RemoteServiceConnection::SendMessageOnConnection(const unsigned char messageID, const char* messageData)
+bool RemoteServiceConnection::SendMessageOnConnection(const unsigned char messageID, const char* messageData)
 {
-	messageID; // TODO: Define this function.
-	messageData; // TODO: Define this function.
+	if (!IsServiceConnected())
+	{
+		return false;
+	}
+
+	size_t dataSize = strlen(messageData) + 1U;
+	size_t payloadSize = sizeof(messageID) + dataSize;
+	if (payloadSize > MAXIMUM_REMOTE_MESSAGE_SIZE || !m_Connection->CanQueueSend(REMOTE_MESSAGE_HEADER_SIZE + payloadSize))
+	{
+		return false;
+	}
+
+	unsigned char frameHeader[REMOTE_MESSAGE_HEADER_SIZE + 1];
+	frameHeader[0] = (unsigned char)(payloadSize >> 8);
+	frameHeader[1] = (unsigned char)(payloadSize & 0xFF);
+	frameHeader[2] = messageID;
+
+	m_Connection->QueueSend(frameHeader, sizeof(frameHeader));
+	m_Connection->QueueSend(messageData, dataSize);
+
+	return true;
 }
 
 
 
 void RemoteServiceConnection::ReceiveMessageOnConnection()
 {
+	const unsigned char* receivedData = m_Connection->m_ReceiveBuffer.data();
+	size_t receivedSize = m_Connection->m_ReceivedSize;
+	size_t readOffset = 0U;
 
+	while (receivedSize - readOffset >= REMOTE_MESSAGE_HEADER_SIZE)
+	{
+		size_t payloadSize = ((size_t)receivedData[readOffset] << 8) | (size_t)receivedData[readOffset + 1];
+		if (payloadSize == 0U)
+		{
+			m_Connection->DisconnectTCP();
+			return;
+		}
+
+		if (receivedSize - readOffset < REMOTE_MESSAGE_HEADER_SIZE + payloadSize)
+		{
+			break;
+		}
+
+		unsigned char messageID = receivedData[readOffset + REMOTE_MESSAGE_HEADER_SIZE];
+		const char* messageData = (const char*)(receivedData + readOffset + REMOTE_MESSAGE_HEADER_SIZE + 1);
+		m_NextMessage.assign(messageData, messageData + (payloadSize - 1U));
+		m_NextMessage.push_back('\0');
+		readOffset += REMOTE_MESSAGE_HEADER_SIZE + payloadSize;
+
+		m_OnMessage.TriggerEvent(this, messageID, m_NextMessage.data());
+	}
+
+	m_Connection->ConsumeReceivedData(readOffset);
 }
 
 
@@ -49,6 +96,9 @@ RemoteCommandService::RemoteCommandService() :
 m_Listener(nullptr)
 {
 	m_OnJoiningConnection.RegisterMethod(this, &RemoteCommandService::AddTCPConnection);
+	m_Reactor.m_OnAccept.RegisterMethod(this, &RemoteCommandService::OnConnectionAccepted);
+	m_Reactor.m_OnReadable.RegisterMethod(this, &RemoteCommandService::OnConnectionReadable);
+	m_Reactor.m_OnDisconnect.RegisterMethod(this, &RemoteCommandService::OnConnectionDisconnected);
 	NetworkSystem::SingletonInstance()->m_OnUpdate.RegisterMethod(this, &RemoteCommandService::Update);
 
 	DeveloperConsole::RegisterCommands("ListTCPAddresses", "List all the addresses available for a given port number. Takes port number as argument.", ListTCPAddressesCommand);
@@ -57,7 +107,7 @@ m_Listener(nullptr)
 	DeveloperConsole::RegisterCommands("JoinService", "Joins a hosted TCP Service. Takes the host name and port number as arguments.", ServerJoinCommand);
 	DeveloperConsole::RegisterCommands("LeaveService", "Leaves the currently joined TCP Service.", ServerLeaveCommand);
 	DeveloperConsole::RegisterCommands("ListServiceInfo", "Lists the current TCP Service information.", ServerInfoCommand);
-	DeveloperConsole::RegisterCommands("SendCommand", "Unavailable as of now.", SendCommandCommand); // TODO: Refactor this.
+	DeveloperConsole::RegisterCommands("SendCommand", "Sends a console command to every connected service. Takes the command and its arguments.", SendCommandCommand);
 }
 
 
@@ -74,10 +124,17 @@ void RemoteCommandService::CreateRemoteCommandService()
 
 bool RemoteCommandService::HostService(const char* hostName, const char* servicePort)
 {
+	if (m_Listener != nullptr)
+	{
+		m_Reactor.RemoveListener(m_Listener);
+		delete m_Listener;
+	}
+
 	m_Listener = new TCPListener(hostName, servicePort);
 
 	if (m_Listener->IsListening())
 	{
+		m_Reactor.AddListener(m_Listener);
 		return true;
 	}
 
@@ -92,6 +149,7 @@ bool RemoteCommandService::StopService()
 	{
 		if (m_Listener->IsListening())
 		{
+			m_Reactor.RemoveListener(m_Listener);
 			m_Listener->StopListener();
 			if (!m_Listener->IsListening())
 			{
@@ -125,33 +183,35 @@ bool RemoteCommandService::JoinService(const char* hostName, const char* service
 
 bool RemoteCommandService::LeaveService()
 {
-	bool leaveSuccessful = false;
-	if(IsServiceConnected())
+	if (!IsServiceConnected())
 	{
-		leaveSuccessful = true;
-		for (RemoteServiceConnection* currentConnection : m_Connections)
-		{
-			if (currentConnection->IsServiceConnected())
-			{
-				currentConnection->m_Connection->DisconnectTCP();
-				if (currentConnection->IsServiceConnected())
-				{
-					leaveSuccessful &= false;
-				}
-			}
-		}
+		return false;
 	}
 
-	return leaveSuccessful;
+	while (!m_Connections.empty())
+	{
+		RemoteServiceConnection* currentConnection = m_Connections.back();
+		currentConnection->m_Connection->DisconnectTCP();
+		RemoveServiceConnection(currentConnection);
+	}
+
+	return true;
 }
 
 
 
 void RemoteCommandService::Update()
 {
-	CheckForConnection();
-	CheckForMessages();
-	CheckForDisconnection();
+	MEMORY_SCOPE("Networking");
+
+	m_Reactor.Poll();
+
+	std::vector<std::string> pendingCommands;
+	pendingCommands.swap(m_PendingCommands);
+	for (const std::string& currentCommand : pendingCommands)
+	{
+		g_DeveloperConsole->RunConsoleCommand(currentCommand.c_str());
+	}
 }
 
 
@@ -288,49 +348,71 @@ uint32_t RemoteCommandService::GetServiceState()
 
 
 
-void RemoteCommandService::CheckForConnection()
+size_t RemoteCommandService::SendMessageToAllConnections(const unsigned char messageID, const char* messageData)
 {
-	if (m_Listener != nullptr)
+	size_t numberOfMessagesSent = 0U;
+	for (RemoteServiceConnection* currentConnection : m_Connections)
 	{
-		if (m_Listener->IsListening())
+		if (currentConnection->SendMessageOnConnection(messageID, messageData))
 		{
-			TCPConnection* newConnection = m_Listener->AcceptConnection();
-			if (newConnection != nullptr)
-			{
-				RemoteServiceConnection* remoteServiceConnection = new RemoteServiceConnection(newConnection);
-				m_OnJoiningConnection.TriggerEvent(remoteServiceConnection);
-			}
+			++numberOfMessagesSent;
 		}
 	}
+
+	return numberOfMessagesSent;
 }
 
 
 
-void RemoteCommandService::CheckForMessages()
+void RemoteCommandService::OnConnectionAccepted(TCPListener* acceptingListener, TCPConnection* newConnection)
 {
+	acceptingListener;
 
+	RemoteServiceConnection* remoteServiceConnection = new RemoteServiceConnection(newConnection);
+	m_OnJoiningConnection.TriggerEvent(remoteServiceConnection);
 }
 
 
 
-void RemoteCommandService::CheckForDisconnection()
+void RemoteCommandService::OnConnectionReadable(TCPConnection* readyConnection)
 {
-	for (auto connectionIterator = m_Connections.begin(); connectionIterator != m_Connections.end();)
+	auto lookupIterator = m_ConnectionLookup.find(readyConnection);
+	if (lookupIterator != m_ConnectionLookup.end())
 	{
-		RemoteServiceConnection* currentConnection = *connectionIterator;
-		if (currentConnection != nullptr)
+		lookupIterator->second->ReceiveMessageOnConnection();
+	}
+}
+
+
+
+void RemoteCommandService::OnConnectionDisconnected(TCPConnection* closedConnection)
+{
+	auto lookupIterator = m_ConnectionLookup.find(closedConnection);
+	if (lookupIterator != m_ConnectionLookup.end())
+	{
+		RemoveServiceConnection(lookupIterator->second);
+	}
+}
+
+
+
+void RemoteCommandService::RemoveServiceConnection(RemoteServiceConnection* remoteServiceConnection)
+{
+	m_OnLeavingConnection.TriggerEvent(remoteServiceConnection);
+
+	m_Reactor.RemoveConnection(remoteServiceConnection->m_Connection);
+	m_ConnectionLookup.erase(remoteServiceConnection->m_Connection);
+	for (auto connectionIterator = m_Connections.begin(); connectionIterator != m_Connections.end(); ++connectionIterator)
+	{
+		if (*connectionIterator == remoteServiceConnection)
 		{
-			if (!currentConnection->IsServiceConnected())
-			{
-				connectionIterator = m_Connections.erase(connectionIterator);
-				delete currentConnection;
-				
-				continue;
-			}
+			m_Connections.erase(connectionIterator);
+			break;
 		}
-
-		++connectionIterator;
 	}
+
+	delete remoteServiceConnection->m_Connection;
+	delete remoteServiceConnection;
 }
 
 
@@ -339,12 +421,24 @@ void RemoteCommandService::AddTCPConnection(RemoteServiceConnection* remoteServi
 {
 	remoteServiceConnection->m_OnMessage.RegisterMethod(this, &RemoteCommandService::ConnectedMessage);
 	m_Connections.push_back(remoteServiceConnection);
+	m_ConnectionLookup[remoteServiceConnection->m_Connection] = remoteServiceConnection;
+	m_Reactor.AddConnection(remoteServiceConnection->m_Connection);
 }
 
 
 
 void RemoteCommandService::ConnectedMessage(RemoteServiceConnection* remoteServiceConnection, const unsigned char messageID, const char* messageData)
 {
+	if (messageID == REMOTE_COMMAND_MESSAGE)
+	{
+		remoteServiceConnection->SendMessageOnConnection(REMOTE_ECHO_MESSAGE, Stringf("Running remote command: %s", messageData).c_str());
+		m_PendingCommands.push_back(messageData);
+	}
+	else if (messageID == REMOTE_ECHO_MESSAGE)
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine(messageData, RGBA::YELLOW));
+	}
+
 	m_OnMessage.TriggerEvent(remoteServiceConnection, messageID, messageData);
 }
 
@@ -607,7 +701,7 @@ void ServerInfoCommand(Command& currentCommand)
 
 
 
-void SendCommandCommand(Command& currentCommand) // TODO: Finish this command.
+void SendCommandCommand(Command& currentCommand)
 {
 	ConsoleLine sendMessage;
 
@@ -615,9 +709,31 @@ void SendCommandCommand(Command& currentCommand) // TODO: Finish this command.
 	{
 		sendMessage = ConsoleLine("Cannot send command. No command given.", RGBA::RED);
 	}
+	else if (!g_RemoteCommandService->IsServiceConnected())
+	{
+		sendMessage = ConsoleLine("Cannot send command. No service connected currently.", RGBA::RED);
+	}
 	else
 	{
+		std::vector<std::string> currentCommandArguments;
+		currentCommand.GetCommandArguments(currentCommandArguments);
+
+		std::string remoteCommand = currentCommandArguments[0];
+		for (size_t argumentIndex = 1; argumentIndex < currentCommandArguments.size(); ++argumentIndex)
+		{
+			remoteCommand += " " + currentCommandArguments[argumentIndex];
+		}
 
+		size_t numberOfConnections = g_RemoteCommandService->m_Connections.size();
+		size_t numberOfMessagesSent = g_RemoteCommandService->SendMessageToAllConnections(REMOTE_COMMAND_MESSAGE, remoteCommand.c_str());
+		if (numberOfMessagesSent == numberOfConnections)
+		{
+			sendMessage = ConsoleLine(Stringf("Command sent to %u connections.", numberOfMessagesSent), RGBA::GREEN);
+		}
+		else
+		{
+			sendMessage = ConsoleLine(Stringf("Command sent to %u of %u connections. The rest are backed up.", numberOfMessagesSent, numberOfConnections), RGBA::YELLOW);
+		}
 	}
 
 	DeveloperConsole::AddNewConsoleLine(sendMessage);
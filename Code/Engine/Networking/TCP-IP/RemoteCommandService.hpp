@@ -1,11 +1,14 @@
 #pragma once
 
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Engine/EventSystem/EventSystem.hpp"
 #include "Engine/DeveloperConsole/Command.hpp"
 #include "Engine/Networking/TCP-IP/TCPListener.hpp"
 #include "Engine/Networking/TCP-IP/TCPConnection.hpp"
+#include "Engine/Networking/TCP-IP/TCPReactor.hpp"
 
 
 
@@ -15,12 +18,25 @@
 
 
 
+const size_t REMOTE_MESSAGE_HEADER_SIZE = 2;
+const size_t MAXIMUM_REMOTE_MESSAGE_SIZE = 0xFFFF;
+
+
+
+enum RemoteMessageID : unsigned char
+{
+	REMOTE_COMMAND_MESSAGE,
+	REMOTE_ECHO_MESSAGE
+};
+
+
+
 class RemoteServiceConnection
 {
 public:
 	RemoteServiceConnection(TCPConnection* newConnection);
 
-	void SendMessageOnConnection(const unsigned char messageID, const char* messageData);
+	bool SendMessageOnConnection(const unsigned char messageID, const char* messageData);
 	void ReceiveMessageOnConnection();
 
 	bool IsServiceConnected();
@@ -61,17 +77,23 @@ public:
 
 	uint32_t GetServiceState();
 
+	size_t SendMessageToAllConnections(const unsigned char messageID, const char* messageData);
+
 private:
-	void CheckForConnection();
-	void CheckForMessages();
-	void CheckForDisconnection();
+	void OnConnectionAccepted(TCPListener* acceptingListener, TCPConnection* newConnection);
+	void OnConnectionReadable(TCPConnection* readyConnection);
+	void OnConnectionDisconnected(TCPConnection* closedConnection);
+	void RemoveServiceConnection(RemoteServiceConnection* remoteServiceConnection);
 
 	void AddTCPConnection(RemoteServiceConnection* remoteServiceConnection);
 	void ConnectedMessage(RemoteServiceConnection* remoteServiceConnection, const unsigned char messageID, const char* messageData);
 
 public:
 	TCPListener* m_Listener;
+	TCPReactor m_Reactor;
 	std::vector<RemoteServiceConnection*> m_Connections;
+	std::unordered_map<TCPConnection*, RemoteServiceConnection*> m_ConnectionLookup;
+	std::vector<std::string> m_PendingCommands;
 
 	EventSystem<RemoteServiceConnection*> m_OnJoiningConnection;
 	EventSystem<RemoteServiceConnection*> m_OnLeavingConnection;
@@ -5,14 +5,18 @@
 
 TCPConnection::TCPConnection(const SOCKET& newSocket, const sockaddr_in& newAddress) :
 m_Socket(newSocket),
-m_Address(newAddress)
+m_Address(newAddress),
+m_ReceivedSize(0U),
+m_SendOffset(0U)
 {
 	
 }
 
 
 
-TCPConnection::TCPConnection(const char* hostName, const char* servicePort)
+TCPConnection::TCPConnection(const char* hostName, const char* servicePort) :
+m_ReceivedSize(0U),
+m_SendOffset(0U)
 {
 	addrinfo* infoList = NetworkSystem::SingletonInstance()->AllocateAddressesForHost(hostName, servicePort, AF_INET, SOCK_STREAM, 0);
 
@@ -107,6 +111,134 @@ size_t TCPConnection::ReceiveOnSocket(void* dataBuffer, size_t bufferSize, bool&
 
 
 
+bool TCPConnection::CanQueueSend(size_t dataSize) const
+{
+	return (GetPendingSendSize() + dataSize <= MAXIMUM_TCP_SEND_BUFFER_SIZE);
+}
+
+
+
+bool TCPConnection::QueueSend(const void* sendData, size_t dataSize)
+{
+	if (m_Socket == INVALID_SOCKET || !CanQueueSend(dataSize))
+	{
+		return false;
+	}
+
+	if (m_SendOffset > 0U)
+	{
+		m_SendBuffer.erase(m_SendBuffer.begin(), m_SendBuffer.begin() + m_SendOffset);
+		m_SendOffset = 0U;
+	}
+
+	const unsigned char* sendBytes = (const unsigned char*)sendData;
+	m_SendBuffer.insert(m_SendBuffer.end(), sendBytes, sendBytes + dataSize);
+
+	return true;
+}
+
+
+
+size_t TCPConnection::FlushSendBuffer(bool& shouldDisconnect)
+{
+	shouldDisconnect = false;
+	size_t flushedSize = 0U;
+
+	while (m_Socket != INVALID_SOCKET && HasPendingSends())
+	{
+		int sentSize = send(m_Socket, (const char*)(m_SendBuffer.data() + m_SendOffset), (int)GetPendingSendSize(), 0);
+		if (sentSize <= 0)
+		{
+			int32_t socketError = WSAGetLastError();
+			if (sentSize < 0 && NetworkSystem::SingletonInstance()->SocketShouldDisconnect(socketError))
+			{
+				shouldDisconnect = true;
+			}
+
+			break;
+		}
+
+		m_SendOffset += (size_t)sentSize;
+		flushedSize += (size_t)sentSize;
+	}
+
+	if (!HasPendingSends())
+	{
+		m_SendBuffer.clear();
+		m_SendOffset = 0U;
+	}
+
+	return flushedSize;
+}
+
+
+
+bool TCPConnection::HasPendingSends() const
+{
+	return (m_SendOffset < m_SendBuffer.size());
+}
+
+
+
+size_t TCPConnection::GetPendingSendSize() const
+{
+	return (m_SendBuffer.size() - m_SendOffset);
+}
+
+
+
+size_t TCPConnection::ReceiveIntoBuffer(bool& shouldDisconnect)
+{
+	shouldDisconnect = false;
+	size_t totalReceivedSize = 0U;
+
+	while (m_Socket != INVALID_SOCKET && m_ReceivedSize < MAXIMUM_TCP_RECEIVE_BUFFER_SIZE)
+	{
+		if (m_ReceiveBuffer.size() < m_ReceivedSize + TCP_RECEIVE_CHUNK_SIZE)
+		{
+			m_ReceiveBuffer.resize(m_ReceivedSize + TCP_RECEIVE_CHUNK_SIZE);
+		}
+
+		int receivedSize = recv(m_Socket, (char*)(m_ReceiveBuffer.data() + m_ReceivedSize), (int)TCP_RECEIVE_CHUNK_SIZE, 0);
+		if (receivedSize == 0)
+		{
+			shouldDisconnect = true;
+			break;
+		}
+		else if (receivedSize < 0)
+		{
+			int32_t socketError = WSAGetLastError();
+			if (NetworkSystem::SingletonInstance()->SocketShouldDisconnect(socketError))
+			{
+				shouldDisconnect = true;
+			}
+
+			break;
+		}
+
+		m_ReceivedSize += (size_t)receivedSize;
+		totalReceivedSize += (size_t)receivedSize;
+	}
+
+	return totalReceivedSize;
+}
+
+
+
+void TCPConnection::ConsumeReceivedData(size_t dataSize)
+{
+	if (dataSize >= m_ReceivedSize)
+	{
+		m_ReceivedSize = 0U;
+		return;
+	}
+
+	memmove(m_ReceiveBuffer.data(), m_ReceiveBuffer.data() + dataSize, m_ReceivedSize - dataSize);
+	m_ReceivedSize -= dataSize;
+}
+
+
+
 bool TCPConnection::IsTCPConnected()
 {
 	return (m_Socket != INVALID_SOCKET);
@@ -1,9 +1,17 @@
 #pragma once
 
+#include <vector>
+
 #include "Engine/Networking/NetworkSystem.hpp"
 
 
 
+const size_t TCP_RECEIVE_CHUNK_SIZE = 4096;
+const size_t MAXIMUM_TCP_RECEIVE_BUFFER_SIZE = 256 * 1024;
+const size_t MAXIMUM_TCP_SEND_BUFFER_SIZE = 256 * 1024;
+
+
+
 class TCPConnection
 {
 public:
@@ -15,9 +23,24 @@ public:
 	size_t SendOnSocket(const void* sendData, size_t dataSize, bool& shouldDisconnect);
 	size_t ReceiveOnSocket(void* dataBuffer, size_t bufferSize, bool& shouldDisconnect);
 
+	bool CanQueueSend(size_t dataSize) const;
+	bool QueueSend(const void* sendData, size_t dataSize);
+	size_t FlushSendBuffer(bool& shouldDisconnect);
+	bool HasPendingSends() const;
+	size_t GetPendingSendSize() const;
+
+	size_t ReceiveIntoBuffer(bool& shouldDisconnect);
+	void ConsumeReceivedData(size_t dataSize);
+
 	bool IsTCPConnected();
 
 public:
 	SOCKET m_Socket;
 	sockaddr_in m_Address;
+
+	std::vector<unsigned char> m_ReceiveBuffer;
+	size_t m_ReceivedSize;
+
+	std::vector<unsigned char> m_SendBuffer;
+	size_t m_SendOffset;
 };
\ No newline at end of file
@@ -0,0 +1,205 @@
+#include "Engine/Networking/TCP-IP/TCPReactor.hpp"
+#include "Engine/Networking/TCP-IP/TCPListener.hpp"
+#include "Engine/Networking/TCP-IP/TCPConnection.hpp"
+
+
+
+TCPReactor::TCPReactor() :
+m_HasRemovedEntries(false)
+{
+
+}
+
+
+
+void TCPReactor::AddListener(TCPListener* newListener)
+{
+	TCPReactorEntry newEntry;
+	newEntry.m_Listener = newListener;
+	newEntry.m_Connection = nullptr;
+	m_Entries.push_back(newEntry);
+}
+
+
+
+void TCPReactor::RemoveListener(TCPListener* oldListener)
+{
+	for (TCPReactorEntry& currentEntry : m_Entries)
+	{
+		if (currentEntry.m_Listener == oldListener)
+		{
+			currentEntry.m_Listener = nullptr;
+			m_HasRemovedEntries = true;
+		}
+	}
+}
+
+
+
+void TCPReactor::AddConnection(TCPConnection* newConnection)
+{
+	TCPReactorEntry newEntry;
+	newEntry.m_Listener = nullptr;
+	newEntry.m_Connection = newConnection;
+	m_Entries.push_back(newEntry);
+}
+
+
+
+void TCPReactor::RemoveConnection(TCPConnection* oldConnection)
+{
+	for (TCPReactorEntry& currentEntry : m_Entries)
+	{
+		if (currentEntry.m_Connection == oldConnection)
+		{
+			currentEntry.m_Connection = nullptr;
+			m_HasRemovedEntries = true;
+		}
+	}
+}
+
+
+
+size_t TCPReactor::Poll(int timeoutInMilliseconds /*= 0*/)
+{
+	RebuildPollDescriptors();
+	if (m_PollDescriptors.empty())
+	{
+		return 0U;
+	}
+
+	int numberOfReadySockets = WSAPoll(m_PollDescriptors.data(), (ULONG)m_PollDescriptors.size(), timeoutInMilliseconds);
+	if (numberOfReadySockets <= 0)
+	{
+		return 0U;
+	}
+
+	size_t numberOfEntries = m_PollDescriptors.size();
+	for (size_t entryIndex = 0; entryIndex < numberOfEntries; ++entryIndex)
+	{
+		short returnedEvents = m_PollDescriptors[entryIndex].revents;
+		if (returnedEvents == 0)
+		{
+			continue;
+		}
+
+		const TCPReactorEntry& currentEntry = m_Entries[entryIndex];
+		if (currentEntry.m_Listener != nullptr)
+		{
+			HandleListenerReady(currentEntry.m_Listener);
+		}
+		else if (currentEntry.m_Connection != nullptr)
+		{
+			HandleConnectionReady(currentEntry.m_Connection, returnedEvents);
+		}
+	}
+
+	return (size_t)numberOfReadySockets;
+}
+
+
+
+size_t TCPReactor::GetNumberOfRegisteredSockets() const
+{
+	return m_Entries.size();
+}
+
+
+
+void TCPReactor::RebuildPollDescriptors()
+{
+	for (size_t entryIndex = 0; entryIndex < m_Entries.size(); ++entryIndex)
+	{
+		TCPReactorEntry& currentEntry = m_Entries[entryIndex];
+		if (currentEntry.m_Listener != nullptr && !currentEntry.m_Listener->IsListening())
+		{
+			currentEntry.m_Listener = nullptr;
+			m_HasRemovedEntries = true;
+		}
+		else if (currentEntry.m_Connection != nullptr && !currentEntry.m_Connection->IsTCPConnected())
+		{
+			TCPConnection* closedConnection = currentEntry.m_Connection;
+			currentEntry.m_Connection = nullptr;
+			m_HasRemovedEntries = true;
+			m_OnDisconnect.TriggerEvent(closedConnection);
+		}
+	}
+
+	if (m_HasRemovedEntries)
+	{
+		size_t writeIndex = 0U;
+		for (size_t readIndex = 0; readIndex < m_Entries.size(); ++readIndex)
+		{
+			if (m_Entries[readIndex].m_Listener != nullptr || m_Entries[readIndex].m_Connection != nullptr)
+			{
+				m_Entries[writeIndex++] = m_Entries[readIndex];
+			}
+		}
+
+		m_Entries.resize(writeIndex);
+		m_HasRemovedEntries = false;
+	}
+
+	m_PollDescriptors.resize(m_Entries.size());
+	for (size_t entryIndex = 0; entryIndex < m_Entries.size(); ++entryIndex)
+	{
+		const TCPReactorEntry& currentEntry = m_Entries[entryIndex];
+		WSAPOLLFD& pollDescriptor = m_PollDescriptors[entryIndex];
+		pollDescriptor.revents = 0;
+
+		if (currentEntry.m_Listener != nullptr)
+		{
+			pollDescriptor.fd = currentEntry.m_Listener->m_Socket;
+			pollDescriptor.events = POLLRDNORM;
+		}
+		else
+		{
+			pollDescriptor.fd = currentEntry.m_Connection->m_Socket;
+			pollDescriptor.events = currentEntry.m_Connection->HasPendingSends() ? (POLLRDNORM | POLLWRNORM) : POLLRDNORM;
+		}
+	}
+}
+
+
+
+void TCPReactor::HandleListenerReady(TCPListener* readyListener)
+{
+	for (size_t acceptIndex = 0; acceptIndex < MAXIMUM_ACCEPTS_PER_POLL; ++acceptIndex)
+	{
+		TCPConnection* newConnection = readyListener->AcceptConnection();
+		if (newConnection == nullptr)
+		{
+			break;
+		}
+
+		m_OnAccept.TriggerEvent(readyListener, newConnection);
+	}
+}
+
+
+
+void TCPReactor::HandleConnectionReady(TCPConnection* readyConnection, short returnedEvents)
+{
+	bool shouldDisconnect = (returnedEvents & (POLLERR | POLLNVAL)) != 0;
+
+	if (!shouldDisconnect && (returnedEvents & POLLWRNORM) != 0)
+	{
+		readyConnection->FlushSendBuffer(shouldDisconnect);
+	}
+
+	if (!shouldDisconnect && (returnedEvents & (POLLRDNORM | POLLHUP)) != 0)
+	{
+		size_t receivedSize = readyConnection->ReceiveIntoBuffer(shouldDisconnect);
+		if (receivedSize > 0U || readyConnection->m_ReceivedSize > 0U)
+		{
+			m_OnReadable.TriggerEvent(readyConnection);
+		}
+	}
+
+	if (shouldDisconnect)
+	{
+		readyConnection->DisconnectTCP();
+		RemoveConnection(readyConnection);
+		m_OnDisconnect.TriggerEvent(readyConnection);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+
+#include "Engine/Networking/NetworkSystem.hpp"
+#include "Engine/EventSystem/EventSystem.hpp"
+
+
+
+const size_t MAXIMUM_ACCEPTS_PER_POLL = 64;
+
+
+
+class TCPListener;
+class TCPConnection;
+
+
+
+struct TCPReactorEntry
+{
+	TCPListener* m_Listener;
+	TCPConnection* m_Connection;
+};
+
+
+
+class TCPReactor
+{
+public:
+	TCPReactor();
+
+	void AddListener(TCPListener* newListener);
+	void RemoveListener(TCPListener* oldListener);
+	void AddConnection(TCPConnection* newConnection);
+	void RemoveConnection(TCPConnection* oldConnection);
+
+	size_t Poll(int timeoutInMilliseconds = 0);
+	size_t GetNumberOfRegisteredSockets() const;
+
+private:
+	void RebuildPollDescriptors();
+	void HandleListenerReady(TCPListener* readyListener);
+	void HandleConnectionReady(TCPConnection* readyConnection, short returnedEvents);
+
+public:
+	std::vector<TCPReactorEntry> m_Entries;
+	std::vector<WSAPOLLFD> m_PollDescriptors;
+	bool m_HasRemovedEntries;
+
+	EventSystem<TCPListener*, TCPConnection*> m_OnAccept;
+	EventSystem<TCPConnection*> m_OnReadable;
+	EventSystem<TCPConnection*> m_OnDisconnect;
+};
\ No newline at end of file
@@ -0,0 +1,427 @@
+#include <math.h>
+
+#include "Engine/Networking/UDP/NetBitStream.hpp"
+#include "Engine/Networking/UDP/NetMessage.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+#include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
+#include "Engine/ErrorHandling/StringUtils.hpp"
+#include "Engine/Math/MathUtilities/MathUtilities.hpp"
+
+
+
+NetBitWriter::NetBitWriter(NetBytePacker* bytePacker) :
+m_BytePacker(bytePacker),
+m_Data((unsigned char*)bytePacker->GetBufferHead()),
+m_MaximumNumberOfBits(bytePacker->GetWritableSize() * 8U),
+m_Scratch(0U),
+m_NumberOfScratchBits(0U),
+m_NumberOfBitsWritten(0U),
+m_IsFlushed(false)
+{
+
+}
+
+
+
+bool NetBitWriter::WriteBits(uint32_t bitData, uint32_t numberOfBits)
+{
+	ASSERT_OR_DIE(numberOfBits <= MAXIMUM_BITS_PER_WRITE, "Too many bits in a single write.");
+	ASSERT_OR_DIE(!m_IsFlushed, "Bit writer has already been flushed.");
+
+	if (m_NumberOfBitsWritten + numberOfBits > m_MaximumNumberOfBits)
+	{
+		return false;
+	}
+
+	uint64_t bitMask = (static_cast<uint64_t>(1U) << numberOfBits) - 1U;
+	m_Scratch |= (static_cast<uint64_t>(bitData) & bitMask) << m_NumberOfScratchBits;
+	m_NumberOfScratchBits += numberOfBits;
+
+	size_t byteIndex = (m_NumberOfBitsWritten - (m_NumberOfScratchBits - numberOfBits)) / 8U;
+	while (m_NumberOfScratchBits >= 8U)
+	{
+		m_Data[byteIndex] = static_cast<unsigned char>(m_Scratch);
+		m_Scratch >>= 8U;
+		m_NumberOfScratchBits -= 8U;
+		++byteIndex;
+	}
+
+	m_NumberOfBitsWritten += numberOfBits;
+
+	return true;
+}
+
+
+
+bool NetBitWriter::WriteBool(bool boolData)
+{
+	return WriteBits(boolData ? 1U : 0U, 1U);
+}
+
+
+
+bool NetBitWriter::WriteVariableLengthInteger(uint32_t integerData)
+{
+	const uint32_t GROUP_MASK = (1U << VARIABLE_LENGTH_GROUP_BITS) - 1U;
+
+	do
+	{
+		uint32_t currentGroup = integerData & GROUP_MASK;
+		integerData >>= VARIABLE_LENGTH_GROUP_BITS;
+
+		bool hasMoreGroups = (integerData != 0U);
+		if (!WriteBits(currentGroup, VARIABLE_LENGTH_GROUP_BITS) || !WriteBool(hasMoreGroups))
+		{
+			return false;
+		}
+	} while (integerData != 0U);
+
+	return true;
+}
+
+
+
+bool NetBitWriter::WriteVariableLengthSignedInteger(int32_t integerData)
+{
+	uint32_t zigZagData = (static_cast<uint32_t>(integerData) << 1) ^ static_cast<uint32_t>(integerData >> 31);
+
+	return WriteVariableLengthInteger(zigZagData);
+}
+
+
+
+bool NetBitWriter::WriteQuantizedFloat(float floatData, float minimumValue, float maximumValue, uint32_t numberOfBits)
+{
+	return WriteBits(QuantizeFloat(floatData, minimumValue, maximumValue, numberOfBits), numberOfBits);
+}
+
+
+
+bool NetBitWriter::WriteQuantizedVector2(const Vector2& vectorData, const Vector2& minimumValues, const Vector2& maximumValues, uint32_t numberOfBitsPerAxis)
+{
+	return (WriteQuantizedFloat(vectorData.X, minimumValues.X, maximumValues.X, numberOfBitsPerAxis) && WriteQuantizedFloat(vectorData.Y, minimumValues.Y, maximumValues.Y, numberOfBitsPerAxis));
+}
+
+
+
+bool NetBitWriter::WriteQuantizedAngle(float angleInDegrees, uint32_t numberOfBits)
+{
+	uint64_t numberOfSteps = static_cast<uint64_t>(1U) << numberOfBits;
+
+	double wrappedAngle = static_cast<double>(CalculateModulus(angleInDegrees, 360.0f));
+	if (wrappedAngle < 0.0)
+	{
+		wrappedAngle += 360.0;
+	}
+
+	uint64_t quantizedAngle = static_cast<uint64_t>((wrappedAngle / 360.0) * static_cast<double>(numberOfSteps) + 0.5) % numberOfSteps;
+
+	return WriteBits(static_cast<uint32_t>(quantizedAngle), numberOfBits);
+}
+
+
+
+size_t NetBitWriter::FlushBits()
+{
+	if (m_IsFlushed)
+	{
+		return 0U;
+	}
+
+	size_t numberOfBytes = (m_NumberOfBitsWritten + 7U) / 8U;
+	if (m_NumberOfScratchBits > 0U)
+	{
+		m_Data[numberOfBytes - 1U] = static_cast<unsigned char>(m_Scratch);
+		m_Scratch = 0U;
+		m_NumberOfScratchBits = 0U;
+	}
+
+	m_BytePacker->AdvanceWriteOffset(numberOfBytes);
+	m_IsFlushed = true;
+
+	return numberOfBytes;
+}
+
+
+
+size_t NetBitWriter::GetNumberOfBitsWritten() const
+{
+	return m_NumberOfBitsWritten;
+}
+
+
+
+NetBitReader::NetBitReader(const NetBytePacker* bytePacker) :
+m_BytePacker(bytePacker),
+m_Data((const unsigned char*)bytePacker->GetBufferHead()),
+m_MaximumNumberOfBits(bytePacker->GetReadableSize() * 8U),
+m_Scratch(0U),
+m_NumberOfScratchBits(0U),
+m_NumberOfBytesLoaded(0U),
+m_NumberOfBitsRead(0U),
+m_IsFinished(false)
+{
+
+}
+
+
+
+bool NetBitReader::ReadBits(uint32_t* bitData, uint32_t numberOfBits)
+{
+	ASSERT_OR_DIE(numberOfBits <= MAXIMUM_BITS_PER_WRITE, "Too many bits in a single read.");
+	ASSERT_OR_DIE(!m_IsFinished, "Bit reader has already finished.");
+
+	if (m_NumberOfBitsRead + numberOfBits > m_MaximumNumberOfBits)
+	{
+		return false;
+	}
+
+	while (m_NumberOfScratchBits < numberOfBits)
+	{
+		m_Scratch |= static_cast<uint64_t>(m_Data[m_NumberOfBytesLoaded]) << m_NumberOfScratchBits;
+		m_NumberOfScratchBits += 8U;
+		++m_NumberOfBytesLoaded;
+	}
+
+	uint64_t bitMask = (static_cast<uint64_t>(1U) << numberOfBits) - 1U;
+	*bitData = static_cast<uint32_t>(m_Scratch & bitMask);
+	m_Scratch >>= numberOfBits;
+	m_NumberOfScratchBits -= numberOfBits;
+	m_NumberOfBitsRead += numberOfBits;
+
+	return true;
+}
+
+
+
+bool NetBitReader::ReadBool(bool* boolData)
+{
+	uint32_t bitData = 0U;
+	if (!ReadBits(&bitData, 1U))
+	{
+		return false;
+	}
+
+	*boolData = (bitData != 0U);
+
+	return true;
+}
+
+
+
+bool NetBitReader::ReadVariableLengthInteger(uint32_t* integerData)
+{
+	uint32_t decodedData = 0U;
+	uint32_t groupShift = 0U;
+	bool hasMoreGroups = true;
+
+	while (hasMoreGroups)
+	{
+		uint32_t currentGroup = 0U;
+		if ((groupShift >= 32U) || !ReadBits(&currentGroup, VARIABLE_LENGTH_GROUP_BITS) || !ReadBool(&hasMoreGroups))
+		{
+			return false;
+		}
+
+		decodedData |= currentGroup << groupShift;
+		groupShift += VARIABLE_LENGTH_GROUP_BITS;
+	}
+
+	*integerData = decodedData;
+
+	return true;
+}
+
+
+
+bool NetBitReader::ReadVariableLengthSignedInteger(int32_t* integerData)
+{
+	uint32_t zigZagData = 0U;
+	if (!ReadVariableLengthInteger(&zigZagData))
+	{
+		return false;
+	}
+
+	*integerData = static_cast<int32_t>((zigZagData >> 1) ^ (~(zigZagData & 1U) + 1U));
+
+	return true;
+}
+
+
+
+bool NetBitReader::ReadQuantizedFloat(float* floatData, float minimumValue, float maximumValue, uint32_t numberOfBits)
+{
+	uint32_t quantizedData = 0U;
+	if (!ReadBits(&quantizedData, numberOfBits))
+	{
+		return false;
+	}
+
+	*floatData = DequantizeFloat(quantizedData, minimumValue, maximumValue, numberOfBits);
+
+	return true;
+}
+
+
+
+bool NetBitReader::ReadQuantizedVector2(Vector2* vectorData, const Vector2& minimumValues, const Vector2& maximumValues, uint32_t numberOfBitsPerAxis)
+{
+	return (ReadQuantizedFloat(&vectorData->X, minimumValues.X, maximumValues.X, numberOfBitsPerAxis) && ReadQuantizedFloat(&vectorData->Y, minimumValues.Y, maximumValues.Y, numberOfBitsPerAxis));
+}
+
+
+
+bool NetBitReader::ReadQuantizedAngle(float* angleInDegrees, uint32_t numberOfBits)
+{
+	uint32_t quantizedAngle = 0U;
+	if (!ReadBits(&quantizedAngle, numberOfBits))
+	{
+		return false;
+	}
+
+	uint64_t numberOfSteps = static_cast<uint64_t>(1U) << numberOfBits;
+	*angleInDegrees = static_cast<float>((static_cast<double>(quantizedAngle) * 360.0) / static_cast<double>(numberOfSteps));
+
+	return true;
+}
+
+
+
+size_t NetBitReader::FinishReading()
+{
+	if (m_IsFinished)
+	{
+		return 0U;
+	}
+
+	size_t numberOfBytes = (m_NumberOfBitsRead + 7U) / 8U;
+	m_BytePacker->AdvanceReadOffset(numberOfBytes);
+	m_IsFinished = true;
+
+	return numberOfBytes;
+}
+
+
+
+size_t NetBitReader::GetNumberOfBitsRead() const
+{
+	return m_NumberOfBitsRead;
+}
+
+
+
+uint32_t QuantizeFloat(float floatData, float minimumValue, float maximumValue, uint32_t numberOfBits)
+{
+	double maximumQuantizedValue = static_cast<double>((static_cast<uint64_t>(1U) << numberOfBits) - 1U);
+	double normalizedValue = static_cast<double>(ClampFloat(floatData, minimumValue, maximumValue) - minimumValue) / static_cast<double>(maximumValue - minimumValue);
+
+	return static_cast<uint32_t>(normalizedValue * maximumQuantizedValue + 0.5);
+}
+
+
+
+float DequantizeFloat(uint32_t quantizedData, float minimumValue, float maximumValue, uint32_t numberOfBits)
+{
+	double maximumQuantizedValue = static_cast<double>((static_cast<uint64_t>(1U) << numberOfBits) - 1U);
+	double normalizedValue = static_cast<double>(quantizedData) / maximumQuantizedValue;
+
+	return static_cast<float>(static_cast<double>(minimumValue) + normalizedValue * static_cast<double>(maximumValue - minimumValue));
+}
+
+
+
+void NetBitPackingCommand(Command& currentCommand)
+{
+	const uint32_t POSITION_BITS_PER_AXIS = 16;
+	const uint32_t ANGLE_BITS = 10;
+	const Vector2 WORLD_MINIMUMS = Vector2(-512.0f, -512.0f);
+	const Vector2 WORLD_MAXIMUMS = Vector2(512.0f, 512.0f);
+
+	size_t numberOfEntities = 64;
+
+	std::vector<std::string> currentCommandArguments;
+	currentCommand.GetCommandArguments(currentCommandArguments);
+
+	if (currentCommandArguments.size() > 1)
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("Too many arguments. NetBitPacking takes the number of entities as an optional argument.", RGBA::RED));
+		return;
+	}
+
+	if (currentCommandArguments.size() > 0)
+	{
+		numberOfEntities = static_cast<size_t>(stoul(currentCommandArguments[0]));
+	}
+
+	std::vector<Vector2> entityPositions;
+	std::vector<float> entityAngles;
+	for (size_t entityIndex = 0; entityIndex < numberOfEntities; ++entityIndex)
+	{
+		entityPositions.push_back(GetRandomVector2WithinRange(WORLD_MINIMUMS, WORLD_MAXIMUMS));
+		entityAngles.push_back(GetRandomFloatWithinRange(0.0f, 360.0f));
+	}
+
+	size_t bytePackedSize = 0U;
+	size_t bitPackedSize = 0U;
+	float largestPositionError = 0.0f;
+	float largestAngleError = 0.0f;
+
+	unsigned char byteBuffer[MESSAGE_MTU];
+	unsigned char bitBuffer[MESSAGE_MTU];
+	size_t entityIndex = 0;
+	while (entityIndex < numberOfEntities)
+	{
+		NetBytePacker bytePacker(byteBuffer, 0U, MESSAGE_MTU, BIG_ENDIAN);
+		NetBytePacker bitPacker(bitBuffer, 0U, MESSAGE_MTU, BIG_ENDIAN);
+		NetBitWriter bitWriter(&bitPacker);
+
+		size_t firstEntityIndex = entityIndex;
+		while (entityIndex < numberOfEntities)
+		{
+			if (bytePacker.GetWritableSize() < sizeof(uint16_t) + sizeof(float) * 3U)
+			{
+				break;
+			}
+
+			bytePacker.Write<uint16_t>(static_cast<uint16_t>(entityIndex));
+			bytePacker.WriteVector2(entityPositions[entityIndex]);
+			bytePacker.Write<float>(entityAngles[entityIndex]);
+
+			bitWriter.WriteVariableLengthInteger(static_cast<uint32_t>(entityIndex));
+			bitWriter.WriteQuantizedVector2(entityPositions[entityIndex], WORLD_MINIMUMS, WORLD_MAXIMUMS, POSITION_BITS_PER_AXIS);
+			bitWriter.WriteQuantizedAngle(entityAngles[entityIndex], ANGLE_BITS);
+			++entityIndex;
+		}
+
+		bitWriter.FlushBits();
+		bytePackedSize += bytePacker.GetTotalReadableSize();
+		bitPackedSize += bitPacker.GetTotalReadableSize();
+
+		bitPacker.SetReadableSize(bitPacker.GetTotalReadableSize());
+		bitPacker.ResetOffset();
+		NetBitReader bitReader(&bitPacker);
+		for (size_t readIndex = firstEntityIndex; readIndex < entityIndex; ++readIndex)
+		{
+			uint32_t readEntityIndex = 0U;
+			Vector2 readPosition;
+			float readAngle = 0.0f;
+
+			bitReader.ReadVariableLengthInteger(&readEntityIndex);
+			bitReader.ReadQuantizedVector2(&readPosition, WORLD_MINIMUMS, WORLD_MAXIMUMS, POSITION_BITS_PER_AXIS);
+			bitReader.ReadQuantizedAngle(&readAngle, ANGLE_BITS);
+
+			float positionError = GetMaximumOfTwoFloats(fabsf(readPosition.X - entityPositions[readIndex].X), fabsf(readPosition.Y - entityPositions[readIndex].Y));
+			float angleError = fabsf(readAngle - entityAngles[readIndex]);
+			angleError = GetMinimumOfTwoFloats(angleError, 360.0f - angleError);
+
+			largestPositionError = GetMaximumOfTwoFloats(largestPositionError, positionError);
+			largestAngleError = GetMaximumOfTwoFloats(largestAngleError, angleError);
+		}
+		bitReader.FinishReading();
+	}
+
+	float sizeRatio = (bytePackedSize > 0U) ? (static_cast<float>(bitPackedSize) / static_cast<float>(bytePackedSize)) : 0.0f;
+
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Entities: %u. Byte packed: %u bytes. Bit packed: %u bytes (%.0f%%).", numberOfEntities, bytePackedSize, bitPackedSize, sizeRatio * 100.0f), RGBA::GREEN));
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Largest error: %.4f units of position, %.3f degrees of rotation.", largestPositionError, largestAngleError), RGBA::GREEN));
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Engine/Networking/UDP/NetBytePacker.hpp"
+#include "Engine/Math/VectorMath/2D/Vector2.hpp"
+#include "Engine/DeveloperConsole/Command.hpp"
+
+
+
+const uint32_t MAXIMUM_BITS_PER_WRITE = 32;
+const uint32_t VARIABLE_LENGTH_GROUP_BITS = 7;
+
+
+
+class NetBitWriter
+{
+public:
+	NetBitWriter(NetBytePacker* bytePacker);
+
+	bool WriteBits(uint32_t bitData, uint32_t numberOfBits);
+	bool WriteBool(bool boolData);
+
+	bool WriteVariableLengthInteger(uint32_t integerData);
+	bool WriteVariableLengthSignedInteger(int32_t integerData);
+
+	bool WriteQuantizedFloat(float floatData, float minimumValue, float maximumValue, uint32_t numberOfBits);
+	bool WriteQuantizedVector2(const Vector2& vectorData, const Vector2& minimumValues, const Vector2& maximumValues, uint32_t numberOfBitsPerAxis);
+	bool WriteQuantizedAngle(float angleInDegrees, uint32_t numberOfBits);
+
+	size_t FlushBits();
+	size_t GetNumberOfBitsWritten() const;
+
+private:
+	NetBytePacker* m_BytePacker;
+	unsigned char* m_Data;
+	size_t m_MaximumNumberOfBits;
+
+	uint64_t m_Scratch;
+	uint32_t m_NumberOfScratchBits;
+	size_t m_NumberOfBitsWritten;
+	bool m_IsFlushed;
+};
+
+
+
+class NetBitReader
+{
+public:
+	NetBitReader(const NetBytePacker* bytePacker);
+
+	bool ReadBits(uint32_t* bitData, uint32_t numberOfBits);
+	bool ReadBool(bool* boolData);
+
+	bool ReadVariableLengthInteger(uint32_t* integerData);
+	bool ReadVariableLengthSignedInteger(int32_t* integerData);
+
+	bool ReadQuantizedFloat(float* floatData, float minimumValue, float maximumValue, uint32_t numberOfBits);
+	bool ReadQuantizedVector2(Vector2* vectorData, const Vector2& minimumValues, const Vector2& maximumValues, uint32_t numberOfBitsPerAxis);
+	bool ReadQuantizedAngle(float* angleInDegrees, uint32_t numberOfBits);
+
+	size_t FinishReading();
+	size_t GetNumberOfBitsRead() const;
+
+private:
+	const NetBytePacker* m_BytePacker;
+	const unsigned char* m_Data;
+	size_t m_MaximumNumberOfBits;
+
+	uint64_t m_Scratch;
+	uint32_t m_NumberOfScratchBits;
+	size_t m_NumberOfBytesLoaded;
+	size_t m_NumberOfBitsRead;
+	bool m_IsFinished;
+};
+
+
+
+uint32_t QuantizeFloat(float floatData, float minimumValue, float maximumValue, uint32_t numberOfBits);
+float DequantizeFloat(uint32_t quantizedData, float minimumValue, float maximumValue, uint32_t numberOfBits);
+
+void NetBitPackingCommand(Command& currentCommand);
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "Engine/Networking/UDP/NetBytePacker.hpp"
 #include "Engine/Math/MathUtilities/MathUtilities.hpp"
+#include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
 
 
 
@@ -117,13 +118,13 @@ bool NetBytePacker::WriteForward(const void* dataBuffer, size_t dataSize)
 
 bool NetBytePacker::WriteBackward(const void* dataBuffer, size_t dataSize)
 {
-	void* bufferCopy = new void*;
-	memcpy_s(bufferCopy, dataSize, dataBuffer, dataSize);
+	ASSERT_OR_DIE(dataSize <= MAXIMUM_SWAPPED_DATA_SIZE, "Data is too large to swap endianness.");
+
+	unsigned char bufferCopy[MAXIMUM_SWAPPED_DATA_SIZE];
+	memcpy_s(bufferCopy, MAXIMUM_SWAPPED_DATA_SIZE, dataBuffer, dataSize);
 	ConvertByteDataToOppositeEndianMode(bufferCopy, dataSize);
-	bool writeSuccess = WriteForward(bufferCopy, dataSize);
-	delete bufferCopy;
-	
-	return writeSuccess;
+
+	return WriteForward(bufferCopy, dataSize);
 }
 
 
@@ -248,4 +249,11 @@ bool NetBytePacker::WriteRGBA(const RGBA& writableRGBA)
 bool NetBytePacker::ReadRGBA(RGBA& readableRGBA) const
 {
 	return (Read<uint8_t>(&readableRGBA.m_Red) && Read<uint8_t>(&readableRGBA.m_Green) && Read<uint8_t>(&readableRGBA.m_Blue) && Read<uint8_t>(&readableRGBA.m_Alpha));
+}
+
+
+
+void NetBytePacker::RebindBuffer(void* buffer)
+{
+	m_Buffer = buffer;
 }
\ No newline at end of file
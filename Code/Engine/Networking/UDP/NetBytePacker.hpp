@@ -7,6 +7,7 @@
 
 
 const unsigned char INVALID_STRING = 0xff;
+const size_t MAXIMUM_SWAPPED_DATA_SIZE = 16;
 
 
 
@@ -84,6 +85,9 @@ public:
 	bool WriteRGBA(const RGBA& writableRGBA);
 	bool ReadRGBA(RGBA& readableRGBA) const;
 
+protected:
+	void RebindBuffer(void* buffer);
+
 private:
 	void* m_Buffer;
 	size_t m_MaximumReadSize;
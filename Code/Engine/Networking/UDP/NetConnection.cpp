@@ -1,35 +1,50 @@
 #include "Engine/Networking/UDP/NetConnection.hpp"
+#include "Engine/Networking/UDP/NetSimulator.hpp"
 #include "Engine/Networking/NetworkSystem.hpp"
 #include "Engine/ErrorHandling/StringUtils.hpp"
+#include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
 #include "Engine/Math/MathUtilities/MathUtilities.hpp"
 #include "Engine/Time/Time.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+
+#include <deque>
+#include <math.h>
 
 
 
 AckBundle::AckBundle() :
-m_AckID(INVALID_PACKET_ACK)
+m_AckID(INVALID_PACKET_ACK),
+m_AckTag(INVALID_ACK_TAG),
+m_NumberOfSentReliableIDs(0U),
+m_FirstSentReliableIndex(0U),
+m_SentTimeInMilliseconds(0U),
+m_WasSent(false)
 {
 
 }
 
 
 
-void AckBundle::AddReliableID(uint16_t reliableID)
+void AckBundle::ResetAckBundle(uint16_t ackID, uint32_t firstSentReliableIndex)
 {
-	for (const uint16_t& currentID : m_SentReliableIDs)
-	{
-		if (currentID == reliableID)
-		{
-			return;
-		}
-	}
+	m_AckID = ackID;
+	m_AckTag = INVALID_ACK_TAG;
+	m_NumberOfSentReliableIDs = 0U;
+	m_FirstSentReliableIndex = firstSentReliableIndex;
+	m_SentTimeInMilliseconds = 0U;
+	m_WasSent = false;
+}
 
-	m_SentReliableIDs.push_back(reliableID);
+
+
+bool AckBundle::IsAckBundleFull() const
+{
+	return (m_NumberOfSentReliableIDs >= MAXIMUM_RELIABLES_PER_ACK_BUNDLE);
 }
 
 
 
-NetConnection::NetConnection(NetSession* parentSession, uint8_t connectionIndex, const sockaddr_in& connectionAddress, const char* globalUniqueID) :
+NetConnection::NetConnection(NetSession* parentSession, uint16_t connectionIndex, const sockaddr_in& connectionAddress, const char* globalUniqueID) :
 m_ParentSession(parentSession),
 m_ConnectionIndex(connectionIndex),
 m_ConnectionState(UNCONFIRMED_CONNECTION),
@@ -42,7 +57,24 @@ m_NextSentReliableID(0U),
 m_OldestUnconfirmedReliableID(0U),
 m_NextExpectedReliableID(0U),
 m_NextSentSequenceID(0U),
-m_NextExpectedSequenceID(0U)
+m_NextExpectedSequenceID(0U),
+m_NextSentReliableRingIndex(0U),
+m_HighestConfirmedAck(INVALID_PACKET_ACK),
+m_NextSentTransferID(0U),
+m_FragmentBytesPerSecond(DEFAULT_FRAGMENT_BYTES_PER_SECOND),
+m_FragmentSendCredit(0.0),
+m_LastFragmentCreditTime(GetNetworkTimeInMilliseconds()),
+m_SmoothedRoundTripTime(0.0),
+m_RoundTripTimeVariance(0.0),
+m_RetransmissionTimeout(MAXIMUM_MESSAGE_AGE),
+m_HasRoundTripSample(false),
+m_CongestionWindow(INITIAL_CONGESTION_WINDOW),
+m_SlowStartThreshold(MAXIMUM_CONGESTION_WINDOW),
+m_LastCongestionEventTime(0.0),
+m_LastSendTime(0.0),
+m_NumberOfPacketsLost(0U),
+m_AckHistory(nullptr),
+m_NumberOfReassemblyBytes(0U)
 {
 	CopyString(m_GlobalUniqueID, globalUniqueID, MAXIMUM_GUID_LENGTH);
 }
@@ -51,12 +83,13 @@ m_NextExpectedSequenceID(0U)
 
 NetConnection::~NetConnection()
 {
-
+	RemoveAllOutgoingMessages();
+	delete m_AckHistory;
 }
 
 
 
-NetConnection* NetConnection::CreateNetConnection(NetSession* parentSession, uint8_t connectionIndex, const sockaddr_in& connectionAddress, const char* globalUniqueID)
+NetConnection* NetConnection::CreateNetConnection(NetSession* parentSession, uint16_t connectionIndex, const sockaddr_in& connectionAddress, const char* globalUniqueID)
 {
 	return new NetConnection(parentSession, connectionIndex, connectionAddress, globalUniqueID);
 }
@@ -74,6 +107,294 @@ void NetConnection::DestroyNetConnection(NetConnection*& currentNetConnection)
 
 
 
+ReliabilityBenchmarkResults NetConnection::RunReliabilityBenchmark(size_t numberOfPackets, float lossPercentage)
+{
+	const size_t NEW_RELIABLES_PER_PACKET = 16;
+	const size_t RESEND_AGE_IN_PACKETS = 4;
+
+	struct SentReliable
+	{
+		uint16_t m_ReliableID;
+		size_t m_LastSentPacketIndex;
+	};
+
+	ReliabilityBenchmarkResults benchmarkResults;
+	memset(&benchmarkResults, 0, sizeof(benchmarkResults));
+
+	sockaddr_in benchmarkAddress;
+	memset(&benchmarkAddress, 0, sizeof(benchmarkAddress));
+
+	NetConnection* senderConnection = new NetConnection(nullptr, 0U, benchmarkAddress, "BenchmarkSender");
+	NetConnection* receiverConnection = new NetConnection(nullptr, 1U, benchmarkAddress, "BenchmarkReceiver");
+	std::queue<SentReliable> sentReliables;
+	std::vector<uint16_t> packetReliableIDs;
+	packetReliableIDs.reserve(MAXIMUM_RELIABLES_PER_ACK_BUNDLE);
+
+	double startTime = GetCurrentTimeInMilliseconds();
+
+	for (size_t packetIndex = 0; packetIndex < numberOfPackets; ++packetIndex)
+	{
+		uint16_t packetAck = senderConnection->GetNextAck();
+		AckBundle* ackBundle = senderConnection->CreateAndGetAckBundle(packetAck);
+		packetReliableIDs.clear();
+
+		while (!sentReliables.empty() && !ackBundle->IsAckBundleFull())
+		{
+			SentReliable currentReliable = sentReliables.front();
+			if (senderConnection->IsReliableIDConfirmed(currentReliable.m_ReliableID))
+			{
+				sentReliables.pop();
+				continue;
+			}
+
+			if (packetIndex - currentReliable.m_LastSentPacketIndex < RESEND_AGE_IN_PACKETS)
+			{
+				break;
+			}
+
+			sentReliables.pop();
+			currentReliable.m_LastSentPacketIndex = packetIndex;
+			senderConnection->AddReliableIDToAckBundle(ackBundle, currentReliable.m_ReliableID);
+			packetReliableIDs.push_back(currentReliable.m_ReliableID);
+			sentReliables.push(currentReliable);
+			++benchmarkResults.m_NumberOfReliablesResent;
+		}
+
+		for (size_t newIndex = 0; newIndex < NEW_RELIABLES_PER_PACKET && senderConnection->CanSendNewReliableMessage() && !ackBundle->IsAckBundleFull(); ++newIndex)
+		{
+			SentReliable newReliable;
+			newReliable.m_ReliableID = senderConnection->GetNextReliableID();
+			newReliable.m_LastSentPacketIndex = packetIndex;
+			senderConnection->AddReliableIDToAckBundle(ackBundle, newReliable.m_ReliableID);
+			packetReliableIDs.push_back(newReliable.m_ReliableID);
+			sentReliables.push(newReliable);
+			++benchmarkResults.m_NumberOfReliablesSent;
+		}
+
+		++benchmarkResults.m_NumberOfPacketsSent;
+		if (GetRandomFloatWithinRange(0.0f, 1.0f) < lossPercentage)
+		{
+			++benchmarkResults.m_NumberOfPacketsDropped;
+			continue;
+		}
+
+		receiverConnection->UpdateHighestAckAndPreviousAckBitfield(packetAck);
+		for (const uint16_t& currentID : packetReliableIDs)
+		{
+			if (receiverConnection->HasReceivedReliableID(currentID))
+			{
+				++benchmarkResults.m_NumberOfDuplicatesRejected;
+				continue;
+			}
+
+			receiverConnection->MarkReliableIDReceived(currentID);
+			++benchmarkResults.m_NumberOfReliablesDelivered;
+		}
+
+		++benchmarkResults.m_NumberOfPacketsSent;
+		if (GetRandomFloatWithinRange(0.0f, 1.0f) < lossPercentage)
+		{
+			++benchmarkResults.m_NumberOfPacketsDropped;
+			continue;
+		}
+
+		PacketHeader replyHeader;
+		replyHeader.m_SenderConnectionIndex = receiverConnection->m_ConnectionIndex;
+		replyHeader.m_PacketAck = receiverConnection->GetNextAck();
+		replyHeader.m_MostRecentAck = receiverConnection->m_HighestReceivedAck;
+		replyHeader.m_PreviouslyReceivedAcksBitfield = receiverConnection->m_PreviousReceivedAcks;
+		senderConnection->MarkPacketReceived(replyHeader);
+	}
+
+	benchmarkResults.m_ElapsedTimeInMilliseconds = GetCurrentTimeInMilliseconds() - startTime;
+
+	delete receiverConnection;
+	delete senderConnection;
+
+	return benchmarkResults;
+}
+
+
+
+SimulationBenchmarkResults NetConnection::RunSimulationBenchmark(const NetSimulationSettings& simulationSettings, size_t numberOfClients, double durationInSeconds, uint64_t randomSeed)
+{
+	const size_t NEW_RELIABLES_PER_PACKET = 8;
+	const double SIMULATION_STEP = 1.0;
+
+	struct SentReliable
+	{
+		uint16_t m_ReliableID;
+		uint32_t m_LastSentTime;
+	};
+
+	struct SimulatedEndpoint
+	{
+		NetConnection* m_Connection;
+		NetSimulator m_OutgoingLink;
+		std::deque<SentReliable> m_SentReliables;
+		std::vector<double> m_FirstSentTimes;
+	};
+
+	SimulationBenchmarkResults benchmarkResults;
+	memset(&benchmarkResults, 0, sizeof(benchmarkResults));
+
+	sockaddr_in benchmarkAddress;
+	memset(&benchmarkAddress, 0, sizeof(benchmarkAddress));
+
+	EnableVirtualNetworkClock(0.0);
+
+	size_t numberOfEndpoints = numberOfClients * 2U;
+	std::vector<SimulatedEndpoint> simulatedEndpoints(numberOfEndpoints);
+	for (size_t endpointIndex = 0; endpointIndex < numberOfEndpoints; ++endpointIndex)
+	{
+		SimulatedEndpoint& currentEndpoint = simulatedEndpoints[endpointIndex];
+		currentEndpoint.m_Connection = new NetConnection(nullptr, static_cast<uint16_t>(endpointIndex % 2U), benchmarkAddress, "BenchmarkEndpoint");
+		currentEndpoint.m_OutgoingLink.m_Settings = simulationSettings;
+		currentEndpoint.m_OutgoingLink.SetSeed(randomSeed + endpointIndex);
+		currentEndpoint.m_FirstSentTimes.resize(MAXIMUM_RELIABLE_RANGE, 0.0);
+	}
+
+	unsigned char packetBuffer[PACKET_MTU];
+	double totalLatency = 0.0;
+	double durationInMilliseconds = durationInSeconds * 1000.0;
+	double startTime = GetCurrentTimeInMilliseconds();
+
+	while (GetNetworkTimeInMilliseconds() < durationInMilliseconds)
+	{
+		AdvanceVirtualNetworkClock(SIMULATION_STEP);
+		double currentTime = GetNetworkTimeInMilliseconds();
+		uint32_t currentTimeInMilliseconds = static_cast<uint32_t>(currentTime);
+
+		for (size_t endpointIndex = 0; endpointIndex < numberOfEndpoints; ++endpointIndex)
+		{
+			SimulatedEndpoint& currentEndpoint = simulatedEndpoints[endpointIndex];
+			SimulatedEndpoint& remoteEndpoint = simulatedEndpoints[endpointIndex ^ 1U];
+			NetConnection* currentConnection = currentEndpoint.m_Connection;
+
+			sockaddr_in fromAddress;
+			size_t receivedSize = remoteEndpoint.m_OutgoingLink.ReleasePacket(packetBuffer, PACKET_MTU, &fromAddress);
+			while (receivedSize > 0U)
+			{
+				PacketHeader packetHeader;
+				memcpy(&packetHeader, packetBuffer, sizeof(packetHeader));
+				currentConnection->MarkPacketReceived(packetHeader);
+
+				uint8_t numberOfReliables = packetBuffer[sizeof(packetHeader)];
+				const unsigned char* readPointer = packetBuffer + sizeof(packetHeader) + 1U;
+				for (uint8_t reliableIndex = 0; reliableIndex < numberOfReliables; ++reliableIndex)
+				{
+					uint16_t currentID;
+					memcpy(&currentID, readPointer, sizeof(currentID));
+					readPointer += sizeof(currentID);
+
+					if (currentConnection->HasReceivedReliableID(currentID))
+					{
+						++benchmarkResults.m_NumberOfDuplicatesRejected;
+						continue;
+					}
+
+					currentConnection->MarkReliableIDReceived(currentID);
+					++benchmarkResults.m_NumberOfReliablesDelivered;
+
+					double reliableLatency = currentTime - remoteEndpoint.m_FirstSentTimes[currentID % MAXIMUM_RELIABLE_RANGE];
+					totalLatency += reliableLatency;
+					benchmarkResults.m_MaximumLatencyInMilliseconds = (reliableLatency > benchmarkResults.m_MaximumLatencyInMilliseconds) ? reliableLatency : benchmarkResults.m_MaximumLatencyInMilliseconds;
+				}
+
+				receivedSize = remoteEndpoint.m_OutgoingLink.ReleasePacket(packetBuffer, PACKET_MTU, &fromAddress);
+			}
+
+			if (!currentConnection->IsReadyToSend(currentTime / 1000.0))
+			{
+				continue;
+			}
+
+			PacketHeader packetHeader;
+			packetHeader.m_SenderConnectionIndex = currentConnection->m_ConnectionIndex;
+			packetHeader.m_PacketAck = currentConnection->GetNextAck();
+			packetHeader.m_MostRecentAck = currentConnection->m_HighestReceivedAck;
+			packetHeader.m_PreviouslyReceivedAcksBitfield = currentConnection->m_PreviousReceivedAcks;
+			AckBundle* ackBundle = currentConnection->CreateAndGetAckBundle(packetHeader.m_PacketAck);
+
+			std::deque<SentReliable>& sentReliables = currentEndpoint.m_SentReliables;
+			unsigned char* writePointer = packetBuffer + sizeof(packetHeader) + 1U;
+			uint8_t numberOfReliables = 0U;
+
+			while (!sentReliables.empty() && !ackBundle->IsAckBundleFull())
+			{
+				SentReliable currentReliable = sentReliables.front();
+				if (currentConnection->IsReliableIDConfirmed(currentReliable.m_ReliableID))
+				{
+					sentReliables.pop_front();
+					continue;
+				}
+
+				if (currentTimeInMilliseconds - currentReliable.m_LastSentTime <= currentConnection->m_RetransmissionTimeout)
+				{
+					break;
+				}
+
+				sentReliables.pop_front();
+				currentReliable.m_LastSentTime = currentTimeInMilliseconds;
+				currentConnection->AddReliableIDToAckBundle(ackBundle, currentReliable.m_ReliableID);
+				memcpy(writePointer, &currentReliable.m_ReliableID, sizeof(currentReliable.m_ReliableID));
+				writePointer += sizeof(currentReliable.m_ReliableID);
+				++numberOfReliables;
+				sentReliables.push_back(currentReliable);
+				++benchmarkResults.m_NumberOfReliablesResent;
+			}
+
+			for (size_t newIndex = 0; newIndex < NEW_RELIABLES_PER_PACKET && currentConnection->CanSendNewReliableMessage() && !ackBundle->IsAckBundleFull(); ++newIndex)
+			{
+				SentReliable newReliable;
+				newReliable.m_ReliableID = currentConnection->GetNextReliableID();
+				newReliable.m_LastSentTime = currentTimeInMilliseconds;
+				currentEndpoint.m_FirstSentTimes[newReliable.m_ReliableID % MAXIMUM_RELIABLE_RANGE] = currentTime;
+
+				currentConnection->AddReliableIDToAckBundle(ackBundle, newReliable.m_ReliableID);
+				memcpy(writePointer, &newReliable.m_ReliableID, sizeof(newReliable.m_ReliableID));
+				writePointer += sizeof(newReliable.m_ReliableID);
+				++numberOfReliables;
+				sentReliables.push_back(newReliable);
+				++benchmarkResults.m_NumberOfReliablesSent;
+			}
+
+			memcpy(packetBuffer, &packetHeader, sizeof(packetHeader));
+			packetBuffer[sizeof(packetHeader)] = numberOfReliables;
+
+			ackBundle->m_SentTimeInMilliseconds = currentTimeInMilliseconds;
+			ackBundle->m_WasSent = true;
+			currentConnection->m_LastSendTime = currentTime / 1000.0;
+
+			currentEndpoint.m_OutgoingLink.SubmitPacket(packetBuffer, static_cast<size_t>(writePointer - packetBuffer), benchmarkAddress);
+			++benchmarkResults.m_NumberOfPacketsSent;
+		}
+	}
+
+	benchmarkResults.m_SimulatedTimeInMilliseconds = GetNetworkTimeInMilliseconds();
+	benchmarkResults.m_ElapsedTimeInMilliseconds = GetCurrentTimeInMilliseconds() - startTime;
+	if (benchmarkResults.m_NumberOfReliablesDelivered > 0U)
+	{
+		benchmarkResults.m_AverageLatencyInMilliseconds = totalLatency / static_cast<double>(benchmarkResults.m_NumberOfReliablesDelivered);
+	}
+
+	for (SimulatedEndpoint& currentEndpoint : simulatedEndpoints)
+	{
+		const NetSimulationStatistics& linkStatistics = currentEndpoint.m_OutgoingLink.m_Statistics;
+		benchmarkResults.m_NumberOfPacketsDropped += linkStatistics.m_NumberOfPacketsDropped + linkStatistics.m_NumberOfPacketsOverflowed;
+		benchmarkResults.m_NumberOfPacketsDuplicated += linkStatistics.m_NumberOfPacketsDuplicated;
+		benchmarkResults.m_NumberOfPacketsReordered += linkStatistics.m_NumberOfPacketsReordered;
+
+		delete currentEndpoint.m_Connection;
+	}
+
+	DisableVirtualNetworkClock();
+
+	return benchmarkResults;
+}
+
+
+
 void NetConnection::UpdateConnectionInfo(const NetConnectionInfo& currentConnectionInfo)
 {
 	m_ConnectionIndex = currentConnectionInfo.m_ConnectionIndex;
@@ -117,31 +438,113 @@ bool NetConnection::IsClientConnection() const // TODO: Verify with Forseth.
 
 
 
-void NetConnection::AddMessageToSendQueue(NetMessage& currentMessage)
+void NetConnection::AddMessageToSendQueue(NetMessage& currentMessage, uint16_t ackTag)
 {
 	currentMessage.m_MessageDefinition = m_ParentSession->FindMessageDefinition(currentMessage.m_MessageID);
 
-	NetMessage* messageCopy = new NetMessage(currentMessage);
-	if (messageCopy->IsReliable())
+	SharedNetPayload* sharedPayload = m_ParentSession->m_OutgoingArena.SerializeMessage(currentMessage);
+	AddPayloadToSendQueue(sharedPayload, ackTag);
+	NetMessageArena::ReleasePayload(sharedPayload);
+}
+
+
+
+void NetConnection::AddPayloadToSendQueue(SharedNetPayload* sharedPayload, uint16_t ackTag)
+{
+	NetMessageArena::AcquirePayload(sharedPayload);
+
+	OutgoingNetMessage outgoingMessage;
+	outgoingMessage.m_Payload = sharedPayload;
+	outgoingMessage.m_LastSentElapsedTime = 0U;
+	outgoingMessage.m_ReliableID = 0U;
+	outgoingMessage.m_SequenceID = 0U;
+	outgoingMessage.m_AckTag = ackTag;
+	if (sharedPayload->IsReliable() && sharedPayload->IsInSequence())
+	{
+		outgoingMessage.m_SequenceID = GetNextSequenceID();
+	}
+
+	if (m_ParentSession->IsNetworkThreadRunning())
 	{
-		if (messageCopy->IsInSequence())
-		{
-			messageCopy->m_SequenceID = GetNextSequenceID();
-		}
-		
-		m_UnsentReliableMessages.push(messageCopy);
+		m_ParentSession->EnqueueOutboundMessage(m_ConnectionIndex, outgoingMessage);
 	}
 	else
 	{
-		m_UnreliableMessages.push(messageCopy);
+		QueueMessageForSending(outgoingMessage);
+	}
+}
+
+
+
+void NetConnection::QueueMessageForSending(const OutgoingNetMessage& outgoingMessage)
+{
+	if (outgoingMessage.m_Payload->IsReliable())
+	{
+		m_UnsentReliableMessages.push(outgoingMessage);
+	}
+	else
+	{
+		m_UnreliableMessages.push_back(outgoingMessage);
+	}
+}
+
+
+
+void NetConnection::AddLargeMessageToSendQueue(uint8_t messageID, const void* messageData, size_t dataSize)
+{
+	ASSERT_OR_DIE(dataSize <= MAXIMUM_LARGE_MESSAGE_SIZE, "Large message exceeds the maximum transfer size.");
+
+	if (dataSize <= FRAGMENT_DATA_SIZE)
+	{
+		NetMessage singleMessage(messageID);
+		singleMessage.WriteForward(messageData, dataSize);
+		AddMessageToSendQueue(singleMessage);
+		return;
+	}
+
+	std::lock_guard<std::recursive_mutex> sessionLock(m_ParentSession->m_SessionLock);
+
+	FragmentHeader fragmentHeader;
+	fragmentHeader.m_TransferID = m_NextSentTransferID++;
+	fragmentHeader.m_NumberOfFragments = static_cast<uint16_t>((dataSize + FRAGMENT_DATA_SIZE - 1U) / FRAGMENT_DATA_SIZE);
+	fragmentHeader.m_MessageID = messageID;
+	fragmentHeader.m_TotalSize = static_cast<uint32_t>(dataSize);
+
+	NetMessageDefinition* fragmentDefinition = m_ParentSession->FindMessageDefinition(NET_MESSAGE_FRAGMENT);
+	const unsigned char* fragmentData = static_cast<const unsigned char*>(messageData);
+	for (uint16_t fragmentIndex = 0; fragmentIndex < fragmentHeader.m_NumberOfFragments; ++fragmentIndex)
+	{
+		size_t fragmentOffset = static_cast<size_t>(fragmentIndex) * FRAGMENT_DATA_SIZE;
+		size_t fragmentSize = GetMinimumOfTwoSize_T(FRAGMENT_DATA_SIZE, dataSize - fragmentOffset);
+
+		NetMessage fragmentMessage(NET_MESSAGE_FRAGMENT);
+		fragmentMessage.m_MessageDefinition = fragmentDefinition;
+		fragmentHeader.m_FragmentIndex = fragmentIndex;
+		WriteFragmentHeader(fragmentMessage, fragmentHeader);
+		fragmentMessage.WriteForward(fragmentData + fragmentOffset, fragmentSize);
+
+		OutgoingNetMessage outgoingFragment;
+		outgoingFragment.m_Payload = m_ParentSession->m_OutgoingArena.SerializeMessage(fragmentMessage);
+		outgoingFragment.m_LastSentElapsedTime = 0U;
+		outgoingFragment.m_ReliableID = 0U;
+		outgoingFragment.m_SequenceID = 0U;
+		outgoingFragment.m_AckTag = INVALID_ACK_TAG;
+		m_PendingFragments.push(outgoingFragment);
 	}
 }
 
 
 
+void NetConnection::SetFragmentBandwidth(size_t bytesPerSecond)
+{
+	m_FragmentBytesPerSecond = bytesPerSecond;
+}
+
+
+
 void NetConnection::SendPacketToMyConnection()
 {
-	NetPacket packetToSend;
+	GatheredPacket packetToSend;
 
 	PacketHeader packetHeader;
 	packetHeader.m_SenderConnectionIndex = m_ParentSession->GetLocalConnectionIndex();
@@ -150,26 +553,63 @@ void NetConnection::SendPacketToMyConnection()
 	packetHeader.m_PreviouslyReceivedAcksBitfield = m_PreviousReceivedAcks;
 
 	packetToSend.WritePacketHeader(packetHeader);
-
-	uint8_t* messageCount = packetToSend.ReserveLocation<uint8_t>(0U);
 	AckBundle* ackBundle = CreateAndGetAckBundle(packetHeader.m_PacketAck);
 
+	ReleasePendingFragments();
+
 	uint8_t numberOfMessages = 0;
 	numberOfMessages += ResendSentReliableMessages(packetToSend, ackBundle);
 	numberOfMessages += SendUnsentReliableMessages(packetToSend, ackBundle);
-	numberOfMessages += SendUnreliables(packetToSend);
-	
-	RemoveAllUnreliableMessages();
-	*messageCount = numberOfMessages;
+	numberOfMessages += SendUnreliables(packetToSend, ackBundle);
 
 	if (numberOfMessages > 0)
 	{
-		size_t sentSize = m_ParentSession->m_PacketChannel->SendToAddressOnPacketChannel(packetToSend.m_Buffer, packetToSend.GetTotalReadableSize(), m_Address);
+		size_t sentSize = m_ParentSession->m_PacketChannel->QueueSlicesToAddressOnPacketChannel(packetToSend.m_Slices, packetToSend.m_NumberOfSlices, m_Address);
 		if (sentSize > 0)
 		{
 			m_ParentSession->m_ElapsedTimeSinceLastSent = 0.0f;
 		}
+
+		ackBundle->m_SentTimeInMilliseconds = static_cast<uint32_t>(GetNetworkTimeInMilliseconds());
+		ackBundle->m_WasSent = true;
+	}
+	else
+	{
+		ackBundle->ResetAckBundle(INVALID_PACKET_ACK, m_NextSentReliableRingIndex);
+	}
+
+	m_LastSendTime = GetNetworkTimeInSeconds();
+	RemoveAllUnreliableMessages();
+}
+
+
+
+bool NetConnection::IsReadyToSend(double currentTime) const
+{
+	return ((currentTime - m_LastSendTime) >= GetSendInterval());
+}
+
+
+
+double NetConnection::GetSendInterval() const
+{
+	if (!m_HasRoundTripSample)
+	{
+		return static_cast<double>(UPDATE_RATE);
+	}
+
+	double sendInterval = (m_SmoothedRoundTripTime / 1000.0) / static_cast<double>(m_CongestionWindow);
+	if (sendInterval < static_cast<double>(UPDATE_RATE))
+	{
+		return static_cast<double>(UPDATE_RATE);
+	}
+
+	if (sendInterval > MAXIMUM_SEND_INTERVAL)
+	{
+		return MAXIMUM_SEND_INTERVAL;
 	}
+
+	return sendInterval;
 }
 
 
@@ -209,18 +649,18 @@ bool NetConnection::IsOwnConnection() const
 
 bool NetConnection::HasReceivedReliableID(uint16_t reliableID) const
 {
-	if (reliableID > (m_NextExpectedReliableID - static_cast<uint16_t>(MAXIMUM_RELIABLE_RANGE)) && reliableID < m_NextExpectedReliableID)
+	uint16_t distanceFromNextExpected = m_NextExpectedReliableID - reliableID;
+	if (distanceFromNextExpected == 0U || distanceFromNextExpected > 0x7FFF)
 	{
-		for (const uint16_t& currentID : m_ReceivedReliableIDs)
-		{
-			if (currentID == reliableID)
-			{
-				return true;
-			}
-		}
+		return false;
 	}
 
-	return false;
+	if (distanceFromNextExpected > MAXIMUM_RELIABLE_RANGE)
+	{
+		return true;
+	}
+
+	return m_ReceivedReliableIDs.IsBitSet(reliableID % MAXIMUM_RELIABLE_RANGE);
 }
 
 
@@ -239,12 +679,19 @@ void NetConnection::ProcessMessage(const NetSender& fromSender, const NetMessage
 
 
 
-void NetConnection::MarkMessageReceived(const NetMessage& currentMessage)
+bool NetConnection::MarkMessageReceived(const NetMessage& currentMessage)
 {
 	if (currentMessage.IsReliable())
 	{
+		if (currentMessage.m_MessageID == NET_MESSAGE_FRAGMENT && !ReserveFragmentReassembly(currentMessage))
+		{
+			return false;
+		}
+
 		MarkReliableIDReceived(currentMessage.m_ReliableID);
 	}
+
+	return true;
 }
 
 
@@ -252,8 +699,9 @@ void NetConnection::MarkMessageReceived(const NetMessage& currentMessage)
 void NetConnection::MarkPacketReceived(const PacketHeader& packetHeader)
 {
 	UpdateHighestAckAndPreviousAckBitfield(packetHeader.m_PacketAck);
+	DetectLostPackets(packetHeader.m_MostRecentAck);
 	ConfirmAck(packetHeader.m_MostRecentAck);
-	for (size_t bitIndex = 0; bitIndex < sizeof(packetHeader.m_PreviouslyReceivedAcksBitfield); ++bitIndex)
+	for (size_t bitIndex = 0; bitIndex < sizeof(packetHeader.m_PreviouslyReceivedAcksBitfield) * 8U; ++bitIndex)
 	{
 		if (IsBitSetAtIndex(packetHeader.m_PreviouslyReceivedAcksBitfield, bitIndex))
 		{
@@ -264,27 +712,172 @@ void NetConnection::MarkPacketReceived(const PacketHeader& packetHeader)
 
 
 
-uint8_t NetConnection::ResendSentReliableMessages(NetPacket& currentPacket, AckBundle* ackBundle)
+bool NetConnection::ReserveFragmentReassembly(const NetMessage& fragmentMessage)
+{
+	FragmentHeader fragmentHeader;
+	bool headerIsRead = ReadFragmentHeader(fragmentMessage, fragmentHeader);
+	size_t fragmentSize = fragmentMessage.GetReadableSize();
+	fragmentMessage.ResetOffset();
+	if (!headerIsRead)
+	{
+		return false;
+	}
+
+	size_t fragmentOffset = static_cast<size_t>(fragmentHeader.m_FragmentIndex) * FRAGMENT_DATA_SIZE;
+	bool fragmentIsValid = fragmentHeader.m_TotalSize <= MAXIMUM_LARGE_MESSAGE_SIZE
+		&& fragmentHeader.m_FragmentIndex < fragmentHeader.m_NumberOfFragments
+		&& fragmentOffset + fragmentSize <= fragmentHeader.m_TotalSize;
+	if (!fragmentIsValid)
+	{
+		return false;
+	}
+
+	auto reassemblyIterator = m_FragmentReassemblies.find(fragmentHeader.m_TransferID);
+	if (reassemblyIterator != m_FragmentReassemblies.end())
+	{
+		const FragmentReassembly& fragmentReassembly = reassemblyIterator->second;
+		return fragmentReassembly.m_NumberOfFragments == fragmentHeader.m_NumberOfFragments && fragmentReassembly.m_TotalSize == fragmentHeader.m_TotalSize;
+	}
+
+	bool canStartReassembly = m_FragmentReassemblies.size() < MAXIMUM_CONCURRENT_REASSEMBLIES
+		&& m_NumberOfReassemblyBytes + fragmentHeader.m_TotalSize <= MAXIMUM_REASSEMBLY_BYTES;
+	if (!canStartReassembly)
+	{
+		return false;
+	}
+
+	FragmentReassembly& fragmentReassembly = m_FragmentReassemblies[fragmentHeader.m_TransferID];
+	m_NumberOfReassemblyBytes += fragmentHeader.m_TotalSize;
+
+	fragmentReassembly.m_MessageID = fragmentHeader.m_MessageID;
+	fragmentReassembly.m_NumberOfFragments = fragmentHeader.m_NumberOfFragments;
+	fragmentReassembly.m_TotalSize = fragmentHeader.m_TotalSize;
+	fragmentReassembly.m_Data.resize(fragmentHeader.m_TotalSize);
+	fragmentReassembly.m_ReceivedFragments.assign(fragmentHeader.m_NumberOfFragments, false);
+	return true;
+}
+
+
+
+void NetConnection::ReceiveFragment(const NetSender& fromSender, const NetMessage& fragmentMessage)
+{
+	FragmentHeader fragmentHeader;
+	if (!ReadFragmentHeader(fragmentMessage, fragmentHeader))
+	{
+		return;
+	}
+
+	auto reassemblyIterator = m_FragmentReassemblies.find(fragmentHeader.m_TransferID);
+	if (reassemblyIterator == m_FragmentReassemblies.end())
+	{
+		return;
+	}
+
+	FragmentReassembly& fragmentReassembly = reassemblyIterator->second;
+	if (fragmentReassembly.m_ReceivedFragments[fragmentHeader.m_FragmentIndex])
+	{
+		return;
+	}
+
+	size_t fragmentOffset = static_cast<size_t>(fragmentHeader.m_FragmentIndex) * FRAGMENT_DATA_SIZE;
+	memcpy(&fragmentReassembly.m_Data[fragmentOffset], fragmentMessage.GetBufferHead(), fragmentMessage.GetReadableSize());
+	fragmentReassembly.m_ReceivedFragments[fragmentHeader.m_FragmentIndex] = true;
+	++fragmentReassembly.m_NumberOfReceivedFragments;
+
+	if (fragmentReassembly.m_NumberOfReceivedFragments == fragmentReassembly.m_NumberOfFragments)
+	{
+		DeliverReassembledMessage(fromSender, fragmentReassembly);
+		RemoveFragmentReassembly(fragmentHeader.m_TransferID);
+	}
+}
+
+
+
+void NetConnection::RemoveFragmentReassembly(uint16_t transferID)
+{
+	auto reassemblyIterator = m_FragmentReassemblies.find(transferID);
+	if (reassemblyIterator != m_FragmentReassemblies.end())
+	{
+		m_NumberOfReassemblyBytes -= reassemblyIterator->second.m_TotalSize;
+		m_FragmentReassemblies.erase(reassemblyIterator);
+	}
+}
+
+
+
+void NetConnection::ReleasePendingFragments()
+{
+	double currentTime = GetNetworkTimeInMilliseconds();
+	double creditGained = (currentTime - m_LastFragmentCreditTime) * static_cast<double>(m_FragmentBytesPerSecond) / 1000.0;
+	m_FragmentSendCredit += creditGained;
+	if (m_FragmentSendCredit > static_cast<double>(MAXIMUM_FRAGMENT_BURST_SIZE))
+	{
+		m_FragmentSendCredit = static_cast<double>(MAXIMUM_FRAGMENT_BURST_SIZE);
+	}
+	m_LastFragmentCreditTime = currentTime;
+
+	size_t numberOfReleasedFragments = 0U;
+	while (!m_PendingFragments.empty() && numberOfReleasedFragments < MAXIMUM_FRAGMENTS_PER_PACKET)
+	{
+		uint16_t reliablesInFlight = m_NextSentReliableID - m_OldestUnconfirmedReliableID;
+		if (reliablesInFlight >= MAXIMUM_FRAGMENT_RELIABLE_RANGE)
+		{
+			break;
+		}
+
+		const OutgoingNetMessage& pendingFragment = m_PendingFragments.front();
+		double fragmentSize = static_cast<double>(pendingFragment.GetTotalMessageSize());
+		if (m_FragmentSendCredit < fragmentSize)
+		{
+			break;
+		}
+
+		m_FragmentSendCredit -= fragmentSize;
+		m_UnsentReliableMessages.push(pendingFragment);
+		m_PendingFragments.pop();
+		++numberOfReleasedFragments;
+	}
+}
+
+
+
+void NetConnection::DeliverReassembledMessage(const NetSender& fromSender, const FragmentReassembly& fragmentReassembly)
+{
+	NetMessageDefinition* messageDefinition = m_ParentSession->FindMessageDefinition(fragmentReassembly.m_MessageID);
+	if (messageDefinition == nullptr || messageDefinition->m_MessageCallBack == nullptr)
+	{
+		return;
+	}
+
+	NetMessage reassembledMessage(fragmentReassembly.m_MessageID);
+	reassembledMessage.m_MessageDefinition = messageDefinition;
+	reassembledMessage.BindExternalPayload(fragmentReassembly.m_Data.data(), fragmentReassembly.m_Data.size());
+	reassembledMessage.ProcessMessage(fromSender);
+}
+
+
+
+uint8_t NetConnection::ResendSentReliableMessages(GatheredPacket& currentPacket, AckBundle* ackBundle)
 {
 	uint8_t numberOfMessages = 0;
 
 	while (!m_SentReliableMessages.empty())
 	{
-		NetMessage* currentMessage = m_SentReliableMessages.front();
-		if (IsReliableIDConfirmed(currentMessage->m_ReliableID))
+		OutgoingNetMessage currentMessage = m_SentReliableMessages.front();
+		if (IsReliableIDConfirmed(currentMessage.m_ReliableID))
 		{
 			m_SentReliableMessages.pop();
-			delete currentMessage;
+			NetMessageArena::ReleasePayload(currentMessage.m_Payload);
 			continue;
 		}
 
-		if (MessageIsOld(currentMessage) && currentPacket.CanWriteMessage(currentMessage))
+		if (MessageIsOld(currentMessage) && currentPacket.CanWriteMessage(currentMessage) && !ackBundle->IsAckBundleFull())
 		{
 			m_SentReliableMessages.pop();
-			currentMessage->m_LastSentElapsedTime = static_cast<uint32_t>(GetCurrentTimeInMilliseconds());
-			currentPacket.WriteMessage(currentMessage);
+			currentMessage.m_LastSentElapsedTime = static_cast<uint32_t>(GetNetworkTimeInMilliseconds());
+			WriteMessageToPacket(currentPacket, ackBundle, currentMessage);
 			++numberOfMessages;
-			ackBundle->AddReliableID(currentMessage->m_ReliableID);
+			AddReliableIDToAckBundle(ackBundle, currentMessage.m_ReliableID);
 			m_SentReliableMessages.push(currentMessage);
 		}
 		else
@@ -298,22 +891,22 @@ uint8_t NetConnection::ResendSentReliableMessages(NetPacket& currentPacket, AckB
 
 
 
-uint8_t NetConnection::SendUnsentReliableMessages(NetPacket& currentPacket, AckBundle* ackBundle)
+uint8_t NetConnection::SendUnsentReliableMessages(GatheredPacket& currentPacket, AckBundle* ackBundle)
 {
 	uint8_t numberOfMessages = 0;
 
 	while (!m_UnsentReliableMessages.empty() && CanSendNewReliableMessage())
 	{
-		NetMessage* currentMessage = m_UnsentReliableMessages.front();
-		if (currentPacket.CanWriteMessage(currentMessage))
+		OutgoingNetMessage& currentMessage = m_UnsentReliableMessages.front();
+		if (currentPacket.CanWriteMessage(currentMessage) && !ackBundle->IsAckBundleFull())
 		{
-			currentMessage->m_ReliableID = GetNextReliableID();
-			currentMessage->m_LastSentElapsedTime = static_cast<uint32_t>(GetCurrentTimeInMilliseconds());
-			currentPacket.WriteMessage(currentMessage);
+			currentMessage.m_ReliableID = GetNextReliableID();
+			currentMessage.m_LastSentElapsedTime = static_cast<uint32_t>(GetNetworkTimeInMilliseconds());
+			WriteMessageToPacket(currentPacket, ackBundle, currentMessage);
 			++numberOfMessages;
-			ackBundle->AddReliableID(currentMessage->m_ReliableID);
-			m_UnsentReliableMessages.pop();
+			AddReliableIDToAckBundle(ackBundle, currentMessage.m_ReliableID);
 			m_SentReliableMessages.push(currentMessage);
+			m_UnsentReliableMessages.pop();
 		}
 		else
 		{
@@ -326,18 +919,16 @@ uint8_t NetConnection::SendUnsentReliableMessages(NetPacket& currentPacket, AckB
 
 
 
-uint8_t NetConnection::SendUnreliables(NetPacket& currentPacket)
+uint8_t NetConnection::SendUnreliables(GatheredPacket& currentPacket, AckBundle* ackBundle)
 {
 	uint8_t numberOfMessages = 0;
 
-	while (!m_UnreliableMessages.empty())
+	for (const OutgoingNetMessage& currentMessage : m_UnreliableMessages)
 	{
-		NetMessage* currentMessage = m_UnreliableMessages.front();
 		if (currentPacket.CanWriteMessage(currentMessage))
 		{
-			currentPacket.WriteMessage(currentMessage);
+			WriteMessageToPacket(currentPacket, ackBundle, currentMessage);
 			++numberOfMessages;
-			m_UnreliableMessages.pop();
 		}
 		else
 		{
@@ -350,22 +941,34 @@ uint8_t NetConnection::SendUnreliables(NetPacket& currentPacket)
 
 
 
+void NetConnection::WriteMessageToPacket(GatheredPacket& currentPacket, AckBundle* ackBundle, const OutgoingNetMessage& currentMessage)
+{
+	currentPacket.WriteMessage(currentMessage);
+	if (currentMessage.m_AckTag != INVALID_ACK_TAG)
+	{
+		ackBundle->m_AckTag = currentMessage.m_AckTag;
+	}
+}
+
+
+
 void NetConnection::MarkReliableIDReceived(uint16_t reliableID)
 {
-	if (CyclicGreaterThanOrEqual(reliableID, m_NextExpectedReliableID))
+	if (reliableID == m_NextExpectedReliableID || CyclicGreaterThanOrEqual(reliableID, m_NextExpectedReliableID))
 	{
 		uint16_t difference = reliableID - m_NextExpectedReliableID;
 		ASSERT_OR_DIE(difference <= MAXIMUM_RELIABLE_RANGE, "Reliable ID is out of range.");
 
+		ClearReceivedReliableIDs(m_NextExpectedReliableID, reliableID);
 		m_NextExpectedReliableID = reliableID + 1;
-		RemoveAllReceivedReliableIDsLessThan(reliableID - MAXIMUM_RELIABLE_RANGE);
+		m_ReceivedReliableIDs.SetBit(reliableID % MAXIMUM_RELIABLE_RANGE);
 	}
 	else
 	{
 		uint16_t difference = m_NextExpectedReliableID - reliableID;
-		if (difference < MAXIMUM_RELIABLE_RANGE)
+		if (difference <= MAXIMUM_RELIABLE_RANGE)
 		{
-			m_ReceivedReliableIDs.push_back(reliableID);
+			m_ReceivedReliableIDs.SetBit(reliableID % MAXIMUM_RELIABLE_RANGE);
 		}
 	}
 }
@@ -374,35 +977,20 @@ void NetConnection::MarkReliableIDReceived(uint16_t reliableID)
 
 bool NetConnection::IsReliableIDConfirmed(uint16_t reliableID) const
 {
-	for (const uint16_t& currentID : m_ConfirmedReliableIDs)
-	{
-		if (currentID == reliableID)
-		{
-			return true;
-		}
-	}
-
-	if (reliableID < m_OldestUnconfirmedReliableID)
+	uint16_t distanceFromOldest = reliableID - m_OldestUnconfirmedReliableID;
+	if (distanceFromOldest >= MAXIMUM_RELIABLE_RANGE)
 	{
 		return true;
 	}
 
-	return false;
+	return m_ConfirmedReliableIDs.IsBitSet(reliableID % MAXIMUM_RELIABLE_RANGE);
 }
 
 
 
 void NetConnection::RemoveConfirmedReliableID(uint16_t reliableID)
 {
-	for (auto reliableIDIterator = m_ConfirmedReliableIDs.begin(); reliableIDIterator != m_ConfirmedReliableIDs.end(); ++reliableIDIterator)
-	{
-		uint16_t currentID = *reliableIDIterator;
-		if (currentID == reliableID)
-		{
-			m_ConfirmedReliableIDs.erase(reliableIDIterator);
-			break;
-		}
-	}
+	m_ConfirmedReliableIDs.ClearBit(reliableID % MAXIMUM_RELIABLE_RANGE);
 }
 
 
@@ -414,11 +1002,11 @@ bool NetConnection::CanSendNewReliableMessage() const
 
 
 
-bool NetConnection::MessageIsOld(const NetMessage* currentMessage) const
+bool NetConnection::MessageIsOld(const OutgoingNetMessage& currentMessage) const
 {
-	uint32_t currentTime = static_cast<uint32_t>(GetCurrentTimeInMilliseconds());
+	uint32_t currentTime = static_cast<uint32_t>(GetNetworkTimeInMilliseconds());
 	
-	return ((currentTime - currentMessage->m_LastSentElapsedTime) > MAXIMUM_MESSAGE_AGE);
+	return ((currentTime - currentMessage.m_LastSentElapsedTime) > m_RetransmissionTimeout);
 }
 
 
@@ -433,33 +1021,134 @@ void NetConnection::ConfirmAck(uint16_t ackID)
 	AckBundle* ackBundle = FindAckBundle(ackID);
 	if (ackBundle != nullptr)
 	{
-		for (const uint16_t& currentID : ackBundle->m_SentReliableIDs)
+		if (!IsAckBundleOverwritten(ackBundle))
 		{
-			ConfirmReliableID(currentID);
+			for (uint16_t reliableIndex = 0; reliableIndex < ackBundle->m_NumberOfSentReliableIDs; ++reliableIndex)
+			{
+				uint32_t ringIndex = ackBundle->m_FirstSentReliableIndex + reliableIndex;
+				ConfirmReliableID(m_AckHistory->m_SentReliableIDRing[ringIndex % SENT_RELIABLE_ID_RING_SIZE]);
+			}
+
+			if (ackBundle->m_AckTag != INVALID_ACK_TAG && m_ParentSession != nullptr)
+			{
+				m_ParentSession->m_OnAckTagConfirmed.TriggerEvent(this, ackBundle->m_AckTag);
+			}
+
+			if (ackBundle->m_WasSent)
+			{
+				uint32_t currentTime = static_cast<uint32_t>(GetNetworkTimeInMilliseconds());
+				OnPacketAcknowledged(currentTime - ackBundle->m_SentTimeInMilliseconds);
+			}
 		}
+
+		ackBundle->ResetAckBundle(INVALID_PACKET_ACK, m_NextSentReliableRingIndex);
 	}
 }
 
 
 
-void NetConnection::ConfirmReliableID(uint16_t reliableID)
+void NetConnection::DetectLostPackets(uint16_t mostRecentAck)
 {
-	if (reliableID < m_OldestUnconfirmedReliableID)
+	if (mostRecentAck == INVALID_PACKET_ACK)
 	{
 		return;
 	}
-	else if (reliableID == m_OldestUnconfirmedReliableID)
+
+	if (m_HighestConfirmedAck == INVALID_PACKET_ACK)
 	{
-		m_ConfirmedReliableIDs.push_back(reliableID);
-		while (IsReliableIDConfirmed(m_OldestUnconfirmedReliableID))
+		m_HighestConfirmedAck = mostRecentAck;
+		return;
+	}
+
+	uint16_t numberOfNewAcks = mostRecentAck - m_HighestConfirmedAck;
+	if (numberOfNewAcks == 0U || numberOfNewAcks >= 0x8000)
+	{
+		return;
+	}
+
+	numberOfNewAcks = static_cast<uint16_t>(GetMinimumOfTwoSize_T(numberOfNewAcks, MAXIMUM_ACK_BUNDLES));
+	for (uint16_t ackOffset = 0; ackOffset < numberOfNewAcks; ++ackOffset)
+	{
+		uint16_t windowEndAck = mostRecentAck - ackOffset;
+		uint16_t lostAck = windowEndAck - static_cast<uint16_t>(PREVIOUS_ACKS_WINDOW_SIZE + 1);
+
+		AckBundle* ackBundle = FindAckBundle(lostAck);
+		if (ackBundle != nullptr && ackBundle->m_WasSent && !IsAckBundleOverwritten(ackBundle))
 		{
-			RemoveConfirmedReliableID(m_OldestUnconfirmedReliableID);
-			++m_OldestUnconfirmedReliableID;
+			OnPacketLost();
 		}
 	}
+
+	m_HighestConfirmedAck = mostRecentAck;
+}
+
+
+
+void NetConnection::OnPacketAcknowledged(uint32_t roundTripTime)
+{
+	double roundTripSample = static_cast<double>(roundTripTime);
+	if (!m_HasRoundTripSample)
+	{
+		m_SmoothedRoundTripTime = roundTripSample;
+		m_RoundTripTimeVariance = roundTripSample * 0.5;
+		m_HasRoundTripSample = true;
+	}
+	else
+	{
+		double roundTripError = roundTripSample - m_SmoothedRoundTripTime;
+		m_RoundTripTimeVariance += ROUND_TRIP_VARIANCE_GAIN * (fabs(roundTripError) - m_RoundTripTimeVariance);
+		m_SmoothedRoundTripTime += ROUND_TRIP_TIME_GAIN * roundTripError;
+	}
+
+	double retransmissionTimeout = m_SmoothedRoundTripTime + (4.0 * m_RoundTripTimeVariance);
+	m_RetransmissionTimeout = static_cast<uint32_t>(retransmissionTimeout);
+	m_RetransmissionTimeout = (m_RetransmissionTimeout < MINIMUM_RETRANSMISSION_TIMEOUT) ? MINIMUM_RETRANSMISSION_TIMEOUT : m_RetransmissionTimeout;
+	m_RetransmissionTimeout = (m_RetransmissionTimeout > MAXIMUM_RETRANSMISSION_TIMEOUT) ? MAXIMUM_RETRANSMISSION_TIMEOUT : m_RetransmissionTimeout;
+
+	if (m_CongestionWindow < m_SlowStartThreshold)
+	{
+		m_CongestionWindow += 1.0f;
+	}
 	else
 	{
-		m_ConfirmedReliableIDs.push_back(reliableID);
+		m_CongestionWindow += 1.0f / m_CongestionWindow;
+	}
+
+	m_CongestionWindow = GetMinimumOfTwoFloats(m_CongestionWindow, MAXIMUM_CONGESTION_WINDOW);
+}
+
+
+
+void NetConnection::OnPacketLost()
+{
+	++m_NumberOfPacketsLost;
+
+	double currentTime = GetNetworkTimeInMilliseconds();
+	if (currentTime - m_LastCongestionEventTime < m_SmoothedRoundTripTime)
+	{
+		return;
+	}
+
+	m_LastCongestionEventTime = currentTime;
+	m_SlowStartThreshold = GetMaximumOfTwoFloats(m_CongestionWindow * 0.5f, MINIMUM_CONGESTION_WINDOW);
+	m_CongestionWindow = m_SlowStartThreshold;
+}
+
+
+
+void NetConnection::ConfirmReliableID(uint16_t reliableID)
+{
+	uint16_t distanceFromOldest = reliableID - m_OldestUnconfirmedReliableID;
+	if (distanceFromOldest >= MAXIMUM_RELIABLE_RANGE)
+	{
+		return;
+	}
+
+	m_ConfirmedReliableIDs.SetBit(reliableID % MAXIMUM_RELIABLE_RANGE);
+	while (m_OldestUnconfirmedReliableID != m_NextSentReliableID && m_ConfirmedReliableIDs.IsBitSet(m_OldestUnconfirmedReliableID % MAXIMUM_RELIABLE_RANGE))
+	{
+		RemoveConfirmedReliableID(m_OldestUnconfirmedReliableID);
+		++m_OldestUnconfirmedReliableID;
 	}
 }
 
@@ -475,18 +1164,18 @@ uint16_t NetConnection::GetNextReliableID()
 
 
 
-void NetConnection::RemoveAllReceivedReliableIDsLessThan(uint16_t reliableID)
+void NetConnection::ClearReceivedReliableIDs(uint16_t firstReliableID, uint16_t lastReliableID)
 {
-	for (auto reliableIDIterator = m_ReceivedReliableIDs.begin(); reliableIDIterator != m_ReceivedReliableIDs.end();)
+	uint16_t numberOfIDs = lastReliableID - firstReliableID + 1;
+	if (numberOfIDs > MAXIMUM_RELIABLE_RANGE)
 	{
-		uint16_t currentID = *reliableIDIterator;
-		if (currentID < reliableID)
-		{
-			reliableIDIterator = m_ReceivedReliableIDs.erase(reliableIDIterator);
-			continue;
-		}
+		numberOfIDs = static_cast<uint16_t>(MAXIMUM_RELIABLE_RANGE);
+	}
 
-		++reliableIDIterator;
+	for (uint16_t idOffset = 0; idOffset < numberOfIDs; ++idOffset)
+	{
+		uint16_t currentID = firstReliableID + idOffset;
+		m_ReceivedReliableIDs.ClearBit(currentID % MAXIMUM_RELIABLE_RANGE);
 	}
 }
 
@@ -504,18 +1193,29 @@ bool NetConnection::CyclicGreaterThanOrEqual(uint16_t firstValue, uint16_t secon
 
 void NetConnection::UpdateHighestAckAndPreviousAckBitfield(uint16_t ackID)
 {
+	if (ackID == m_HighestReceivedAck)
+	{
+		return;
+	}
+
 	if (CyclicGreaterThanOrEqual(ackID, m_HighestReceivedAck))
 	{
 		uint16_t shiftOffset = ackID - m_HighestReceivedAck;
-		m_PreviousReceivedAcks = m_PreviousReceivedAcks << shiftOffset;
+		m_PreviousReceivedAcks = (shiftOffset < PREVIOUS_ACKS_WINDOW_SIZE) ? static_cast<uint16_t>(m_PreviousReceivedAcks << shiftOffset) : 0U;
 		m_HighestReceivedAck = ackID;
 		m_NextExpectedAck = m_HighestReceivedAck + 1;
-		SetBitAtIndex(m_PreviousReceivedAcks, shiftOffset - 1);
+		if (shiftOffset <= PREVIOUS_ACKS_WINDOW_SIZE)
+		{
+			SetBitAtIndex(m_PreviousReceivedAcks, shiftOffset - 1);
+		}
 	}
 	else
 	{
 		uint16_t shiftOffset = m_HighestReceivedAck - ackID;
-		SetBitAtIndex(m_PreviousReceivedAcks, shiftOffset - 1);
+		if (shiftOffset <= PREVIOUS_ACKS_WINDOW_SIZE)
+		{
+			SetBitAtIndex(m_PreviousReceivedAcks, shiftOffset - 1);
+		}
 	}
 }
 
@@ -592,10 +1292,14 @@ NetMessage* NetConnection::FindAndGetNextSequencedMessage()
 
 AckBundle* NetConnection::CreateAndGetAckBundle(uint16_t ackID)
 {
+	if (m_AckHistory == nullptr)
+	{
+		m_AckHistory = new AckHistory();
+	}
+
 	uint16_t bundleIndex = ackID % MAXIMUM_ACK_BUNDLES;
-	AckBundle* ackBundle = &(m_AckBundles[bundleIndex]);
-	ackBundle->m_AckID = ackID;
-	ackBundle->m_SentReliableIDs.clear();
+	AckBundle* ackBundle = &(m_AckHistory->m_AckBundles[bundleIndex]);
+	ackBundle->ResetAckBundle(ackID, m_NextSentReliableRingIndex);
 
 	return ackBundle;
 }
@@ -604,12 +1308,15 @@ AckBundle* NetConnection::CreateAndGetAckBundle(uint16_t ackID)
 
 AckBundle* NetConnection::FindAckBundle(uint16_t ackID)
 {
-	for (size_t bundleIndex = 0; bundleIndex < MAXIMUM_ACK_BUNDLES; ++bundleIndex)
+	if (m_AckHistory == nullptr)
 	{
-		if (m_AckBundles[bundleIndex].m_AckID == ackID)
-		{
-			return &m_AckBundles[bundleIndex];
-		}
+		return nullptr;
+	}
+
+	AckBundle* ackBundle = &(m_AckHistory->m_AckBundles[ackID % MAXIMUM_ACK_BUNDLES]);
+	if (ackBundle->m_AckID == ackID)
+	{
+		return ackBundle;
 	}
 
 	return nullptr;
@@ -617,6 +1324,25 @@ AckBundle* NetConnection::FindAckBundle(uint16_t ackID)
 
 
 
+void NetConnection::AddReliableIDToAckBundle(AckBundle* ackBundle, uint16_t reliableID)
+{
+	ASSERT_OR_DIE(!ackBundle->IsAckBundleFull(), "Ack bundle is full.");
+	ASSERT_OR_DIE(ackBundle->m_FirstSentReliableIndex + ackBundle->m_NumberOfSentReliableIDs == m_NextSentReliableRingIndex, "Reliable IDs can only be added to the latest ack bundle.");
+
+	m_AckHistory->m_SentReliableIDRing[m_NextSentReliableRingIndex % SENT_RELIABLE_ID_RING_SIZE] = reliableID;
+	++m_NextSentReliableRingIndex;
+	++ackBundle->m_NumberOfSentReliableIDs;
+}
+
+
+
+bool NetConnection::IsAckBundleOverwritten(const AckBundle* ackBundle) const
+{
+	return ((m_NextSentReliableRingIndex - ackBundle->m_FirstSentReliableIndex) > SENT_RELIABLE_ID_RING_SIZE);
+}
+
+
+
 uint16_t NetConnection::GetNextAck()
 {
 	uint16_t currentAck = m_NextSentAck;
@@ -633,10 +1359,132 @@ uint16_t NetConnection::GetNextAck()
 
 void NetConnection::RemoveAllUnreliableMessages()
 {
-	while (!m_UnreliableMessages.empty())
+	for (const OutgoingNetMessage& currentMessage : m_UnreliableMessages)
 	{
-		NetMessage* currentMessage = m_UnreliableMessages.front();
-		delete currentMessage;
-		m_UnreliableMessages.pop();
+		NetMessageArena::ReleasePayload(currentMessage.m_Payload);
 	}
+
+	m_UnreliableMessages.clear();
+}
+
+
+
+void NetConnection::RemoveAllOutgoingMessages()
+{
+	RemoveAllUnreliableMessages();
+
+	while (!m_UnsentReliableMessages.empty())
+	{
+		NetMessageArena::ReleasePayload(m_UnsentReliableMessages.front().m_Payload);
+		m_UnsentReliableMessages.pop();
+	}
+
+	while (!m_SentReliableMessages.empty())
+	{
+		NetMessageArena::ReleasePayload(m_SentReliableMessages.front().m_Payload);
+		m_SentReliableMessages.pop();
+	}
+
+	while (!m_PendingFragments.empty())
+	{
+		NetMessageArena::ReleasePayload(m_PendingFragments.front().m_Payload);
+		m_PendingFragments.pop();
+	}
+}
+
+
+
+void NetReliabilityBenchmarkCommand(Command& currentCommand)
+{
+	size_t numberOfPackets = 100000;
+	float lossPercentage = 0.1f;
+
+	std::vector<std::string> currentCommandArguments;
+	currentCommand.GetCommandArguments(currentCommandArguments);
+
+	if (currentCommandArguments.size() > 2)
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("Too many arguments. NetReliabilityBenchmark takes the number of packets and loss percentage as optional arguments.", RGBA::RED));
+		return;
+	}
+
+	if (currentCommandArguments.size() > 0)
+	{
+		numberOfPackets = static_cast<size_t>(stoul(currentCommandArguments[0]));
+	}
+
+	if (currentCommandArguments.size() > 1)
+	{
+		lossPercentage = stof(currentCommandArguments[1]) * 0.01f;
+	}
+
+	ReliabilityBenchmarkResults benchmarkResults = NetConnection::RunReliabilityBenchmark(numberOfPackets, lossPercentage);
+	double microsecondsPerPacket = (benchmarkResults.m_ElapsedTimeInMilliseconds * 1000.0) / static_cast<double>((benchmarkResults.m_NumberOfPacketsSent > 0) ? benchmarkResults.m_NumberOfPacketsSent : 1);
+
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Packets: %u sent, %u dropped.", benchmarkResults.m_NumberOfPacketsSent, benchmarkResults.m_NumberOfPacketsDropped), RGBA::GREEN));
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Reliables: %u sent, %u resent, %u delivered, %u duplicates rejected.", benchmarkResults.m_NumberOfReliablesSent, benchmarkResults.m_NumberOfReliablesResent, benchmarkResults.m_NumberOfReliablesDelivered, benchmarkResults.m_NumberOfDuplicatesRejected), RGBA::GREEN));
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Elapsed: %.3f ms (%.3f us per packet).", benchmarkResults.m_ElapsedTimeInMilliseconds, microsecondsPerPacket), RGBA::GREEN));
+}
+
+
+void NetSimulationBenchmarkCommand(Command& currentCommand)
+{
+	size_t numberOfClients = 16;
+	double durationInSeconds = 60.0;
+	uint64_t randomSeed = 1U;
+
+	NetSimulationSettings simulationSettings;
+	simulationSettings.m_DropPercentage = 0.05f;
+	simulationSettings.m_MinimumLag = 50.0;
+	simulationSettings.m_MaximumLag = 50.0;
+
+	std::vector<std::string> currentCommandArguments;
+	currentCommand.GetCommandArguments(currentCommandArguments);
+
+	if (currentCommandArguments.size() > 5)
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("Too many arguments. NetSimulationBenchmark takes the number of clients, duration, loss percentage, lag and seed as optional arguments.", RGBA::RED));
+		return;
+	}
+
+	if (IsVirtualNetworkClockEnabled() || (NetSession::LocalNetSession() != nullptr && NetSession::LocalNetSession()->IsSessionRunning()))
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("Cannot run benchmark while a session is running. The benchmark takes over the network clock.", RGBA::RED));
+		return;
+	}
+
+	if (currentCommandArguments.size() > 0)
+	{
+		numberOfClients = static_cast<size_t>(stoul(currentCommandArguments[0]));
+	}
+
+	if (currentCommandArguments.size() > 1)
+	{
+		durationInSeconds = stod(currentCommandArguments[1]);
+	}
+
+	if (currentCommandArguments.size() > 2)
+	{
+		simulationSettings.m_DropPercentage = stof(currentCommandArguments[2]) * 0.01f;
+	}
+
+	if (currentCommandArguments.size() > 3)
+	{
+		simulationSettings.m_MinimumLag = stod(currentCommandArguments[3]);
+		simulationSettings.m_MaximumLag = simulationSettings.m_MinimumLag;
+	}
+
+	if (currentCommandArguments.size() > 4)
+	{
+		randomSeed = static_cast<uint64_t>(stoull(currentCommandArguments[4]));
+	}
+
+	SimulationBenchmarkResults benchmarkResults = NetConnection::RunSimulationBenchmark(simulationSettings, numberOfClients, durationInSeconds, randomSeed);
+	double speedup = benchmarkResults.m_SimulatedTimeInMilliseconds / ((benchmarkResults.m_ElapsedTimeInMilliseconds > 0.0) ? benchmarkResults.m_ElapsedTimeInMilliseconds : 1.0);
+	double reliablesPerSecond = static_cast<double>(benchmarkResults.m_NumberOfReliablesDelivered) * 1000.0 / ((benchmarkResults.m_SimulatedTimeInMilliseconds > 0.0) ? benchmarkResults.m_SimulatedTimeInMilliseconds : 1.0);
+
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Packets: %u sent, %u dropped, %u duplicated, %u reordered.", benchmarkResults.m_NumberOfPacketsSent, benchmarkResults.m_NumberOfPacketsDropped, benchmarkResults.m_NumberOfPacketsDuplicated, benchmarkResults.m_NumberOfPacketsReordered), RGBA::GREEN));
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Reliables: %u sent, %u resent, %u delivered (%.1f per second), %u duplicates rejected.", benchmarkResults.m_NumberOfReliablesSent, benchmarkResults.m_NumberOfReliablesResent, benchmarkResults.m_NumberOfReliablesDelivered, reliablesPerSecond, benchmarkResults.m_NumberOfDuplicatesRejected), RGBA::GREEN));
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Latency: %.2f ms average, %.2f ms maximum.", benchmarkResults.m_AverageLatencyInMilliseconds, benchmarkResults.m_MaximumLatencyInMilliseconds), RGBA::GREEN));
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Simulated %.1f s in %.3f ms (%.1fx real time).", benchmarkResults.m_SimulatedTimeInMilliseconds / 1000.0, benchmarkResults.m_ElapsedTimeInMilliseconds, speedup), RGBA::GREEN));
 }
\ No newline at end of file
@@ -2,13 +2,18 @@
 
 #include <vector>
 #include <queue>
+#include <unordered_map>
 
 #include "Engine/Networking/UDP/NetMessage.hpp"
+#include "Engine/Networking/UDP/NetFragmentation.hpp"
+#include "Engine/Networking/UDP/NetMessageArena.hpp"
 #include "Engine/Networking/UDP/NetPacket.hpp"
+#include "Engine/DataStructures/FixedBitset.hpp"
+#include "Engine/DeveloperConsole/Command.hpp"
 
 
 
-#define INVALID_CONNNECTION_INDEX 0xFF
+#define INVALID_CONNNECTION_INDEX 0xFFFF
 
 
 
@@ -16,6 +21,19 @@ const size_t MAXIMUM_GUID_LENGTH = 32;
 const size_t MAXIMUM_ACK_BUNDLES = 128;
 const size_t MAXIMUM_RELIABLE_RANGE = 1024;
 const size_t MAXIMUM_MESSAGE_AGE = 150;
+const size_t MAXIMUM_RELIABLES_PER_ACK_BUNDLE = 64;
+const size_t SENT_RELIABLE_ID_RING_SIZE = MAXIMUM_RELIABLE_RANGE;
+const size_t PREVIOUS_ACKS_WINDOW_SIZE = 16;
+
+const double ROUND_TRIP_TIME_GAIN = 0.125;
+const double ROUND_TRIP_VARIANCE_GAIN = 0.25;
+const uint32_t MINIMUM_RETRANSMISSION_TIMEOUT = 50;
+const uint32_t MAXIMUM_RETRANSMISSION_TIMEOUT = 2000;
+
+const float INITIAL_CONGESTION_WINDOW = 4.0f;
+const float MINIMUM_CONGESTION_WINDOW = 2.0f;
+const float MAXIMUM_CONGESTION_WINDOW = 256.0f;
+const double MAXIMUM_SEND_INTERVAL = 0.1;
 class NetSession;
 
 
@@ -34,18 +52,62 @@ class AckBundle
 public:
 	AckBundle();
 
-	void AddReliableID(uint16_t reliableID);
+	void ResetAckBundle(uint16_t ackID, uint32_t firstSentReliableIndex);
+	bool IsAckBundleFull() const;
 	
 public:
 	uint16_t m_AckID;
-	std::vector<uint16_t> m_SentReliableIDs;
+	uint16_t m_AckTag;
+	uint16_t m_NumberOfSentReliableIDs;
+	uint32_t m_FirstSentReliableIndex;
+	uint32_t m_SentTimeInMilliseconds;
+	bool m_WasSent;
+};
+
+
+
+struct AckHistory
+{
+	AckBundle m_AckBundles[MAXIMUM_ACK_BUNDLES];
+	uint16_t m_SentReliableIDRing[SENT_RELIABLE_ID_RING_SIZE];
+};
+
+
+
+struct ReliabilityBenchmarkResults
+{
+	size_t m_NumberOfPacketsSent;
+	size_t m_NumberOfPacketsDropped;
+	size_t m_NumberOfReliablesSent;
+	size_t m_NumberOfReliablesResent;
+	size_t m_NumberOfReliablesDelivered;
+	size_t m_NumberOfDuplicatesRejected;
+	double m_ElapsedTimeInMilliseconds;
+};
+
+
+
+struct SimulationBenchmarkResults
+{
+	size_t m_NumberOfPacketsSent;
+	size_t m_NumberOfPacketsDropped;
+	size_t m_NumberOfPacketsDuplicated;
+	size_t m_NumberOfPacketsReordered;
+	size_t m_NumberOfReliablesSent;
+	size_t m_NumberOfReliablesResent;
+	size_t m_NumberOfReliablesDelivered;
+	size_t m_NumberOfDuplicatesRejected;
+	double m_AverageLatencyInMilliseconds;
+	double m_MaximumLatencyInMilliseconds;
+	double m_SimulatedTimeInMilliseconds;
+	double m_ElapsedTimeInMilliseconds;
 };
 
 
 
 struct NetConnectionInfo
 {
-	uint8_t m_ConnectionIndex;
+	uint16_t m_ConnectionIndex;
 	sockaddr_in m_Address;
 	char m_GlobalUniqueID[MAXIMUM_GUID_LENGTH];
 };
@@ -55,12 +117,14 @@ struct NetConnectionInfo
 class NetConnection
 {
 private:
-	NetConnection(NetSession* parentSession, uint8_t connectionIndex, const sockaddr_in& connectionAddress, const char* globalUniqueID);
+	NetConnection(NetSession* parentSession, uint16_t connectionIndex, const sockaddr_in& connectionAddress, const char* globalUniqueID);
 	~NetConnection();
 
 public:
-	static NetConnection* CreateNetConnection(NetSession* parentSession, uint8_t connectionIndex, const sockaddr_in& connectionAddress, const char* globalUniqueID);
+	static NetConnection* CreateNetConnection(NetSession* parentSession, uint16_t connectionIndex, const sockaddr_in& connectionAddress, const char* globalUniqueID);
 	static void DestroyNetConnection(NetConnection*& currentNetConnection);
+	static ReliabilityBenchmarkResults RunReliabilityBenchmark(size_t numberOfPackets, float lossPercentage);
+	static SimulationBenchmarkResults RunSimulationBenchmark(const struct NetSimulationSettings& simulationSettings, size_t numberOfClients, double durationInSeconds, uint64_t randomSeed);
 
 	void UpdateConnectionInfo(const NetConnectionInfo& currentConnectionInfo);
 	NetConnectionInfo GetConnectionInfo() const;
@@ -69,9 +133,16 @@ public:
 	bool IsHostConnection() const;
 	bool IsClientConnection() const;
 
-	void AddMessageToSendQueue(NetMessage& currentMessage);
+	void AddMessageToSendQueue(NetMessage& currentMessage, uint16_t ackTag = INVALID_ACK_TAG);
+	void AddPayloadToSendQueue(SharedNetPayload* sharedPayload, uint16_t ackTag = INVALID_ACK_TAG);
+	void QueueMessageForSending(const OutgoingNetMessage& outgoingMessage);
+	void AddLargeMessageToSendQueue(uint8_t messageID, const void* messageData, size_t dataSize);
+	void SetFragmentBandwidth(size_t bytesPerSecond);
 	void SendPacketToMyConnection();
 
+	bool IsReadyToSend(double currentTime) const;
+	double GetSendInterval() const;
+
 	void MarkAsLocalConnection();
 	void MarkConnectionConfirmed();
 	bool IsConnectionConfirmed() const;
@@ -80,27 +151,37 @@ public:
 	bool HasReceivedReliableID(uint16_t reliableID) const;
 
 	void ProcessMessage(const NetSender& fromSender, const NetMessage& currentMessage);
-	void MarkMessageReceived(const NetMessage& currentMessage);
+	bool MarkMessageReceived(const NetMessage& currentMessage);
 
 	void MarkPacketReceived(const PacketHeader& packetHeader);
+	void ReceiveFragment(const NetSender& fromSender, const NetMessage& fragmentMessage);
 
 private:
-	uint8_t ResendSentReliableMessages(NetPacket& currentPacket, AckBundle* ackBundle);
-	uint8_t SendUnsentReliableMessages(NetPacket& currentPacket, AckBundle* ackBundle);
-	uint8_t SendUnreliables(NetPacket& currentPacket);
+	void ReleasePendingFragments();
+	bool ReserveFragmentReassembly(const NetMessage& fragmentMessage);
+	void RemoveFragmentReassembly(uint16_t transferID);
+	void DeliverReassembledMessage(const NetSender& fromSender, const FragmentReassembly& fragmentReassembly);
+
+	uint8_t ResendSentReliableMessages(GatheredPacket& currentPacket, AckBundle* ackBundle);
+	uint8_t SendUnsentReliableMessages(GatheredPacket& currentPacket, AckBundle* ackBundle);
+	uint8_t SendUnreliables(GatheredPacket& currentPacket, AckBundle* ackBundle);
+	void WriteMessageToPacket(GatheredPacket& currentPacket, AckBundle* ackBundle, const OutgoingNetMessage& currentMessage);
 
 	void MarkReliableIDReceived(uint16_t reliableID);
 
 	bool IsReliableIDConfirmed(uint16_t reliableID) const;
 	void RemoveConfirmedReliableID(uint16_t reliableID);
 	bool CanSendNewReliableMessage() const;
-	bool MessageIsOld(const NetMessage* currentMessage) const;
+	bool MessageIsOld(const OutgoingNetMessage& currentMessage) const;
 
 	void ConfirmAck(uint16_t ackID);
+	void DetectLostPackets(uint16_t mostRecentAck);
+	void OnPacketAcknowledged(uint32_t roundTripTime);
+	void OnPacketLost();
 	void ConfirmReliableID(uint16_t reliableID);
 
 	uint16_t GetNextReliableID();
-	void RemoveAllReceivedReliableIDsLessThan(uint16_t reliableID);
+	void ClearReceivedReliableIDs(uint16_t firstReliableID, uint16_t lastReliableID);
 	bool CyclicGreaterThanOrEqual(uint16_t firstValue, uint16_t secondValue);
 	void UpdateHighestAckAndPreviousAckBitfield(uint16_t ackID);
 
@@ -112,37 +193,67 @@ private:
 
 	AckBundle* CreateAndGetAckBundle(uint16_t ackID);
 	AckBundle* FindAckBundle(uint16_t ackID);
+	void AddReliableIDToAckBundle(AckBundle* ackBundle, uint16_t reliableID);
+	bool IsAckBundleOverwritten(const AckBundle* ackBundle) const;
 	uint16_t GetNextAck();
 
 	void RemoveAllUnreliableMessages();
+	void RemoveAllOutgoingMessages();
 
 public:
 	NetSession* m_ParentSession;
-	uint8_t m_ConnectionIndex;
+	uint16_t m_ConnectionIndex;
 	uint8_t m_ConnectionState;
 	sockaddr_in m_Address;
-	char m_GlobalUniqueID[MAXIMUM_GUID_LENGTH];
 
 	uint16_t m_NextSentAck;
-	AckBundle m_AckBundles[MAXIMUM_ACK_BUNDLES];
-
 	uint16_t m_HighestReceivedAck;
 	uint16_t m_NextExpectedAck;
 	uint16_t m_PreviousReceivedAcks;
 
 	uint16_t m_NextSentReliableID;
 	uint16_t m_OldestUnconfirmedReliableID;
-	std::vector<uint16_t> m_ConfirmedReliableIDs;
-
 	uint16_t m_NextExpectedReliableID;
-	std::vector<uint16_t> m_ReceivedReliableIDs;
 
 	uint16_t m_NextSentSequenceID;
-
 	uint16_t m_NextExpectedSequenceID;
+
+	uint32_t m_NextSentReliableRingIndex;
+	uint16_t m_HighestConfirmedAck;
+	uint16_t m_NextSentTransferID;
+	size_t m_FragmentBytesPerSecond;
+	double m_FragmentSendCredit;
+	double m_LastFragmentCreditTime;
+
+	double m_SmoothedRoundTripTime;
+	double m_RoundTripTimeVariance;
+	uint32_t m_RetransmissionTimeout;
+	bool m_HasRoundTripSample;
+
+	float m_CongestionWindow;
+	float m_SlowStartThreshold;
+	double m_LastCongestionEventTime;
+	double m_LastSendTime;
+	size_t m_NumberOfPacketsLost;
+	char m_GlobalUniqueID[MAXIMUM_GUID_LENGTH];
+
+	FixedBitset<MAXIMUM_RELIABLE_RANGE> m_ConfirmedReliableIDs;
+	FixedBitset<MAXIMUM_RELIABLE_RANGE> m_ReceivedReliableIDs;
+
+	AckHistory* m_AckHistory;
+
 	std::vector<NetMessage*> m_OutOfOrderReceivedSequencedMessages;
 
-	std::queue<NetMessage*> m_UnreliableMessages;
-	std::queue<NetMessage*> m_UnsentReliableMessages;
-	std::queue<NetMessage*> m_SentReliableMessages;
-};
\ No newline at end of file
+	std::vector<OutgoingNetMessage> m_UnreliableMessages;
+	std::queue<OutgoingNetMessage> m_UnsentReliableMessages;
+	std::queue<OutgoingNetMessage> m_SentReliableMessages;
+	std::queue<OutgoingNetMessage> m_PendingFragments;
+
+	std::unordered_map<uint16_t, FragmentReassembly> m_FragmentReassemblies;
+	size_t m_NumberOfReassemblyBytes;
+};
+
+
+
+void NetReliabilityBenchmarkCommand(Command& currentCommand);
+void NetSimulationBenchmarkCommand(Command& currentCommand);
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "Engine/Networking/UDP/NetFragmentation.hpp"
+#include "Engine/Networking/UDP/NetConnection.hpp"
+
+
+
+FragmentReassembly::FragmentReassembly() :
+m_MessageID(INVALID_MESSAGE_TYPE),
+m_NumberOfFragments(0U),
+m_NumberOfReceivedFragments(0U),
+m_TotalSize(0U)
+{
+
+}
+
+
+
+bool WriteFragmentHeader(NetMessage& fragmentMessage, const FragmentHeader& fragmentHeader)
+{
+	return fragmentMessage.Write<uint16_t>(fragmentHeader.m_TransferID)
+		&& fragmentMessage.Write<uint16_t>(fragmentHeader.m_FragmentIndex)
+		&& fragmentMessage.Write<uint16_t>(fragmentHeader.m_NumberOfFragments)
+		&& fragmentMessage.Write<uint8_t>(fragmentHeader.m_MessageID)
+		&& fragmentMessage.Write<uint32_t>(fragmentHeader.m_TotalSize);
+}
+
+
+
+bool ReadFragmentHeader(const NetMessage& fragmentMessage, FragmentHeader& fragmentHeader)
+{
+	return fragmentMessage.Read<uint16_t>(&fragmentHeader.m_TransferID)
+		&& fragmentMessage.Read<uint16_t>(&fragmentHeader.m_FragmentIndex)
+		&& fragmentMessage.Read<uint16_t>(&fragmentHeader.m_NumberOfFragments)
+		&& fragmentMessage.Read<uint8_t>(&fragmentHeader.m_MessageID)
+		&& fragmentMessage.Read<uint32_t>(&fragmentHeader.m_TotalSize);
+}
+
+
+
+void OnFragmentReceived(const NetSender& fragmentSender, const NetMessage& fragmentMessage)
+{
+	NetConnection* senderConnection = fragmentSender.m_Connection;
+	if (senderConnection == nullptr)
+	{
+		return;
+	}
+
+	senderConnection->ReceiveFragment(fragmentSender, fragmentMessage);
+}
\ No newline at end of file
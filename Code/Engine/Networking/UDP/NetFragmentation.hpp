@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "Engine/Networking/UDP/NetMessage.hpp"
+
+
+
+const size_t FRAGMENT_HEADER_SIZE = sizeof(uint16_t) * 3U + sizeof(uint8_t) + sizeof(uint32_t);
+const size_t FRAGMENT_DATA_SIZE = 768;
+const size_t MAXIMUM_LARGE_MESSAGE_SIZE = 4U * 1024U * 1024U;
+const size_t MAXIMUM_FRAGMENTS_PER_PACKET = 1;
+const size_t MAXIMUM_FRAGMENT_RELIABLE_RANGE = 512;
+const size_t DEFAULT_FRAGMENT_BYTES_PER_SECOND = 96U * 1024U;
+const size_t MAXIMUM_FRAGMENT_BURST_SIZE = FRAGMENT_DATA_SIZE * 4U;
+const size_t MAXIMUM_CONCURRENT_REASSEMBLIES = 4;
+const size_t MAXIMUM_REASSEMBLY_BYTES = MAXIMUM_LARGE_MESSAGE_SIZE * 2U;
+
+
+
+struct FragmentHeader
+{
+	uint16_t m_TransferID;
+	uint16_t m_FragmentIndex;
+	uint16_t m_NumberOfFragments;
+	uint8_t m_MessageID;
+	uint32_t m_TotalSize;
+};
+
+
+
+struct FragmentReassembly
+{
+	FragmentReassembly();
+
+	uint8_t m_MessageID;
+	uint16_t m_NumberOfFragments;
+	uint16_t m_NumberOfReceivedFragments;
+	uint32_t m_TotalSize;
+
+	std::vector<unsigned char> m_Data;
+	std::vector<bool> m_ReceivedFragments;
+};
+
+
+
+bool WriteFragmentHeader(NetMessage& fragmentMessage, const FragmentHeader& fragmentHeader);
+bool ReadFragmentHeader(const NetMessage& fragmentMessage, FragmentHeader& fragmentHeader);
+
+void OnFragmentReceived(const NetSender& fragmentSender, const NetMessage& fragmentMessage);
\ No newline at end of file
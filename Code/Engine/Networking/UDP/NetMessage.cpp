@@ -30,6 +30,40 @@ m_SequenceID(0)
 
 
 
+NetMessage::NetMessage(const NetMessage& copyMessage) :
+NetBytePacker(copyMessage),
+m_MessageID(copyMessage.m_MessageID),
+m_MessageDefinition(copyMessage.m_MessageDefinition),
+m_ReliableID(copyMessage.m_ReliableID),
+m_LastSentElapsedTime(copyMessage.m_LastSentElapsedTime),
+m_SequenceID(copyMessage.m_SequenceID)
+{
+	memcpy(m_Buffer, copyMessage.m_Buffer, MESSAGE_MTU);
+	RebindBuffer(m_Buffer);
+}
+
+
+
+NetMessage& NetMessage::operator=(const NetMessage& copyMessage)
+{
+	if (this != &copyMessage)
+	{
+		NetBytePacker::operator=(copyMessage);
+		m_MessageID = copyMessage.m_MessageID;
+		m_MessageDefinition = copyMessage.m_MessageDefinition;
+		m_ReliableID = copyMessage.m_ReliableID;
+		m_LastSentElapsedTime = copyMessage.m_LastSentElapsedTime;
+		m_SequenceID = copyMessage.m_SequenceID;
+
+		memcpy(m_Buffer, copyMessage.m_Buffer, MESSAGE_MTU);
+		RebindBuffer(m_Buffer);
+	}
+
+	return *this;
+}
+
+
+
 size_t NetMessage::GetHeaderSize() const
 {
 	size_t headerSize = sizeof(m_MessageID);
@@ -107,6 +141,16 @@ void NetMessage::ProcessMessage(const NetSender& fromSender) const
 
 
 
+void NetMessage::BindExternalPayload(const void* payloadData, size_t payloadSize)
+{
+	RebindBuffer(const_cast<void*>(payloadData));
+	SetReadableSize(payloadSize);
+	SetWritableSize(0U);
+	ResetOffset();
+}
+
+
+
 NetMessageDefinition::NetMessageDefinition(uint8_t messageID /*= INVALID_MESSAGE_TYPE*/, uint8_t controlFlags /*= INVALID_CONTROL_TYPE*/, uint8_t optionFlags /*= INVALID_OPTION_TYPE*/, NetMessageCallBack* messageCallBack /*= nullptr*/) :
 m_MessageID(messageID),
 m_ControlFlags(controlFlags),
@@ -19,6 +19,8 @@ enum NetworkMessageType : uint8_t
 	NET_MESSAGE_JOIN_ACCEPT,
 	NET_MESSAGE_LEAVE,
 	NET_MESSAGE_NEXT,
+	NET_MESSAGE_SNAPSHOT = 253,
+	NET_MESSAGE_FRAGMENT = 254,
 	INVALID_MESSAGE_TYPE = 255
 };
 
@@ -48,6 +50,7 @@ struct NetSender
 	class NetSession* m_Session;
 	class NetConnection* m_Connection;
 	sockaddr_in m_Address;
+	double m_ReceivedTime;
 };
 
 
@@ -57,6 +60,9 @@ class NetMessage : public NetBytePacker
 public:
 	NetMessage();
 	NetMessage(uint8_t messageID);
+	NetMessage(const NetMessage& copyMessage);
+
+	NetMessage& operator=(const NetMessage& copyMessage);
 
 	size_t GetHeaderSize() const;
 	size_t GetPayloadSize() const;
@@ -67,6 +73,7 @@ public:
 	bool IsInSequence() const;
 
 	void ProcessMessage(const NetSender& fromSender) const;
+	void BindExternalPayload(const void* payloadData, size_t payloadSize);
 
 public:
 	uint8_t m_MessageID;
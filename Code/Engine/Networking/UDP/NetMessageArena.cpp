@@ -0,0 +1,194 @@
+#include <new>
+
+#include "Engine/Networking/UDP/NetMessageArena.hpp"
+#include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
+#include "Engine/Math/MathUtilities/MathUtilities.hpp"
+
+
+
+const unsigned char* SharedNetPayload::GetPayloadData() const
+{
+	return (const unsigned char*)(this + 1);
+}
+
+
+
+bool SharedNetPayload::IsReliable() const
+{
+	ASSERT_OR_DIE(m_MessageDefinition != nullptr, "Payload has no valid definition.");
+
+	return IsBitSet(m_MessageDefinition->m_OptionFlags, NMO_RELIABLE);
+}
+
+
+
+bool SharedNetPayload::IsInSequence() const
+{
+	ASSERT_OR_DIE(m_MessageDefinition != nullptr, "Payload has no valid definition.");
+
+	return IsBitSet(m_MessageDefinition->m_OptionFlags, NMO_SEQUENCED);
+}
+
+
+
+size_t OutgoingNetMessage::GetHeaderSize() const
+{
+	size_t headerSize = sizeof(m_Payload->m_MessageID);
+	if (m_Payload->IsReliable())
+	{
+		headerSize += sizeof(m_ReliableID);
+		if (m_Payload->IsInSequence())
+		{
+			headerSize += sizeof(m_SequenceID);
+		}
+	}
+
+	return headerSize;
+}
+
+
+
+size_t OutgoingNetMessage::GetTotalMessageSize() const
+{
+	return (GetHeaderSize() + m_Payload->m_PayloadSize + sizeof(uint16_t));
+}
+
+
+
+NetMessageArena::NetMessageArena() :
+m_CurrentPage(nullptr),
+m_NumberOfLivePages(0U)
+{
+
+}
+
+
+
+NetMessageArena::~NetMessageArena()
+{
+	if (m_CurrentPage != nullptr)
+	{
+		ReleasePage(m_CurrentPage);
+		m_CurrentPage = nullptr;
+	}
+
+	ASSERT_OR_DIE(GetNumberOfLivePages() == 0U, "Net message arena destroyed while payloads are still queued.");
+
+	for (NetMessageArenaPage* currentPage : m_FreePages)
+	{
+		delete currentPage;
+	}
+
+	m_FreePages.clear();
+}
+
+
+
+SharedNetPayload* NetMessageArena::SerializeMessage(const NetMessage& currentMessage)
+{
+	size_t payloadSize = currentMessage.GetPayloadSize();
+	size_t allocationSize = sizeof(SharedNetPayload) + payloadSize;
+	allocationSize = (allocationSize + NET_MESSAGE_ARENA_ALIGNMENT - 1) & ~(NET_MESSAGE_ARENA_ALIGNMENT - 1);
+	ASSERT_OR_DIE(allocationSize <= NET_MESSAGE_ARENA_PAGE_SIZE, "Message does not fit in an arena page.");
+
+	if ((m_CurrentPage == nullptr) || (m_CurrentPage->m_UsedSize + allocationSize > NET_MESSAGE_ARENA_PAGE_SIZE))
+	{
+		if (m_CurrentPage != nullptr)
+		{
+			ReleasePage(m_CurrentPage);
+		}
+
+		m_CurrentPage = AcquirePage();
+	}
+
+	SharedNetPayload* newPayload = (SharedNetPayload*)(m_CurrentPage->m_Data + m_CurrentPage->m_UsedSize);
+	m_CurrentPage->m_UsedSize += allocationSize;
+	m_CurrentPage->m_ReferenceCount.fetch_add(1U, std::memory_order_relaxed);
+
+	newPayload->m_ParentPage = m_CurrentPage;
+	newPayload->m_MessageDefinition = currentMessage.m_MessageDefinition;
+	new (&newPayload->m_ReferenceCount) std::atomic<uint32_t>(1U);
+	newPayload->m_PayloadSize = static_cast<uint16_t>(payloadSize);
+	newPayload->m_MessageID = currentMessage.m_MessageID;
+	memcpy(newPayload + 1, currentMessage.m_Buffer, payloadSize);
+
+	return newPayload;
+}
+
+
+
+void NetMessageArena::AcquirePayload(SharedNetPayload* currentPayload)
+{
+	currentPayload->m_ReferenceCount.fetch_add(1U, std::memory_order_relaxed);
+}
+
+
+
+void NetMessageArena::ReleasePayload(SharedNetPayload* currentPayload)
+{
+	if (currentPayload->m_ReferenceCount.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+	{
+		ReleasePage(currentPayload->m_ParentPage);
+	}
+}
+
+
+
+size_t NetMessageArena::GetNumberOfLivePages() const
+{
+	return m_NumberOfLivePages.load(std::memory_order_relaxed);
+}
+
+
+
+NetMessageArenaPage* NetMessageArena::AcquirePage()
+{
+	NetMessageArenaPage* newPage = nullptr;
+	{
+		std::lock_guard<std::mutex> freePageLock(m_FreePageLock);
+		if (!m_FreePages.empty())
+		{
+			newPage = m_FreePages.back();
+			m_FreePages.pop_back();
+		}
+	}
+
+	if (newPage == nullptr)
+	{
+		newPage = new NetMessageArenaPage();
+		newPage->m_ParentArena = this;
+	}
+
+	newPage->m_ReferenceCount.store(1U, std::memory_order_relaxed);
+	newPage->m_UsedSize = 0U;
+	m_NumberOfLivePages.fetch_add(1U, std::memory_order_relaxed);
+
+	return newPage;
+}
+
+
+
+void NetMessageArena::RecyclePage(NetMessageArenaPage* currentPage)
+{
+	m_NumberOfLivePages.fetch_sub(1U, std::memory_order_relaxed);
+
+	std::lock_guard<std::mutex> freePageLock(m_FreePageLock);
+	if (m_FreePages.size() < MAXIMUM_FREE_ARENA_PAGES)
+	{
+		m_FreePages.push_back(currentPage);
+	}
+	else
+	{
+		delete currentPage;
+	}
+}
+
+
+
+void NetMessageArena::ReleasePage(NetMessageArenaPage* currentPage)
+{
+	if (currentPage->m_ReferenceCount.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+	{
+		currentPage->m_ParentArena->RecyclePage(currentPage);
+	}
+}
\ No newline at end of file
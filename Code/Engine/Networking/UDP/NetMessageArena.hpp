@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+#include <vector>
+
+#include "Engine/Networking/UDP/NetMessage.hpp"
+
+
+
+const size_t NET_MESSAGE_ARENA_PAGE_SIZE = 8192;
+const size_t MAXIMUM_FREE_ARENA_PAGES = 4;
+const size_t NET_MESSAGE_ARENA_ALIGNMENT = 8;
+const uint16_t INVALID_ACK_TAG = 0xFFFF;
+
+
+
+class NetMessageArena;
+
+
+
+struct NetMessageArenaPage
+{
+	NetMessageArena* m_ParentArena;
+	std::atomic<uint32_t> m_ReferenceCount;
+	size_t m_UsedSize;
+	alignas(NET_MESSAGE_ARENA_ALIGNMENT) unsigned char m_Data[NET_MESSAGE_ARENA_PAGE_SIZE];
+};
+
+
+
+struct SharedNetPayload
+{
+	NetMessageArenaPage* m_ParentPage;
+	NetMessageDefinition* m_MessageDefinition;
+	std::atomic<uint32_t> m_ReferenceCount;
+	uint16_t m_PayloadSize;
+	uint8_t m_MessageID;
+
+	const unsigned char* GetPayloadData() const;
+	bool IsReliable() const;
+	bool IsInSequence() const;
+};
+
+
+
+struct OutgoingNetMessage
+{
+	SharedNetPayload* m_Payload;
+	uint32_t m_LastSentElapsedTime;
+	uint16_t m_ReliableID;
+	uint16_t m_SequenceID;
+	uint16_t m_AckTag;
+
+	size_t GetHeaderSize() const;
+	size_t GetTotalMessageSize() const;
+};
+
+
+
+class NetMessageArena
+{
+public:
+	NetMessageArena();
+	~NetMessageArena();
+
+	SharedNetPayload* SerializeMessage(const NetMessage& currentMessage);
+
+	static void AcquirePayload(SharedNetPayload* currentPayload);
+	static void ReleasePayload(SharedNetPayload* currentPayload);
+
+	size_t GetNumberOfLivePages() const;
+
+private:
+	NetMessageArenaPage* AcquirePage();
+	void RecyclePage(NetMessageArenaPage* currentPage);
+	static void ReleasePage(NetMessageArenaPage* currentPage);
+
+private:
+	NetMessageArenaPage* m_CurrentPage;
+	std::vector<NetMessageArenaPage*> m_FreePages;
+	std::mutex m_FreePageLock;
+	std::atomic<size_t> m_NumberOfLivePages;
+};
\ No newline at end of file
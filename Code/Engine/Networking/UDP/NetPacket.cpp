@@ -1,6 +1,8 @@
 #include "Engine/Networking/UDP/NetPacket.hpp"
 #include "Engine/Networking/UDP/NetMessage.hpp"
+#include "Engine/Networking/UDP/NetMessageArena.hpp"
 #include "Engine/Networking/UDP/NetSession.hpp"
+#include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
 
 
 
@@ -14,7 +16,7 @@ NetBytePacker(m_Buffer, 0, PACKET_MTU, BIG_ENDIAN)
 
 void NetPacket::WritePacketHeader(const PacketHeader& packetHeader)
 {
-	Write<uint8_t>(packetHeader.m_SenderConnectionIndex);
+	Write<uint16_t>(packetHeader.m_SenderConnectionIndex);
 	Write<uint16_t>(packetHeader.m_PacketAck);
 	Write<uint16_t>(packetHeader.m_MostRecentAck);
 	Write<uint16_t>(packetHeader.m_PreviouslyReceivedAcksBitfield);
@@ -24,7 +26,7 @@ void NetPacket::WritePacketHeader(const PacketHeader& packetHeader)
 
 void NetPacket::ReadPacketHeader(PacketHeader& packetHeader) const
 {
-	Read<uint8_t>(&packetHeader.m_SenderConnectionIndex);
+	Read<uint16_t>(&packetHeader.m_SenderConnectionIndex);
 	Read<uint16_t>(&packetHeader.m_PacketAck);
 	Read<uint16_t>(&packetHeader.m_MostRecentAck);
 	Read<uint16_t>(&packetHeader.m_PreviouslyReceivedAcksBitfield);
@@ -73,4 +75,89 @@ void NetPacket::ReadMessage(NetMessage* currentMessage)
 bool NetPacket::CanWriteMessage(const NetMessage* currentMessage) const
 {
 	return (GetWritableSize() >= currentMessage->GetTotalMessageSize());
+}
+
+
+
+GatheredPacket::GatheredPacket() :
+NetBytePacker(m_HeaderBuffer, 0, GATHERED_PACKET_HEADER_SIZE, BIG_ENDIAN),
+m_NumberOfSlices(0U),
+m_TotalPacketSize(0U),
+m_MessageCount(nullptr)
+{
+
+}
+
+
+
+void GatheredPacket::WritePacketHeader(const PacketHeader& packetHeader)
+{
+	Write<uint16_t>(packetHeader.m_SenderConnectionIndex);
+	Write<uint16_t>(packetHeader.m_PacketAck);
+	Write<uint16_t>(packetHeader.m_MostRecentAck);
+	Write<uint16_t>(packetHeader.m_PreviouslyReceivedAcksBitfield);
+	m_MessageCount = ReserveLocation<uint8_t>(0U);
+
+	m_Slices[0].m_Data = m_HeaderBuffer;
+	m_Slices[0].m_DataSize = GetOffset();
+	m_NumberOfSlices = 1U;
+	m_TotalPacketSize = GetOffset();
+}
+
+
+
+void GatheredPacket::WriteMessage(const OutgoingNetMessage& currentMessage)
+{
+	ASSERT_OR_DIE(m_MessageCount != nullptr, "Packet header must be written before messages.");
+
+	const SharedNetPayload* currentPayload = currentMessage.m_Payload;
+	size_t headerStart = GetOffset();
+
+	Write<uint16_t>(static_cast<uint16_t>(currentMessage.GetTotalMessageSize()));
+	Write<uint8_t>(currentPayload->m_MessageID);
+	if (currentPayload->IsReliable())
+	{
+		Write<uint16_t>(currentMessage.m_ReliableID);
+		if (currentPayload->IsInSequence())
+		{
+			Write<uint16_t>(currentMessage.m_SequenceID);
+		}
+	}
+
+	NetPacketSlice& headerSlice = m_Slices[m_NumberOfSlices];
+	headerSlice.m_Data = m_HeaderBuffer + headerStart;
+	headerSlice.m_DataSize = GetOffset() - headerStart;
+	++m_NumberOfSlices;
+
+	if (currentPayload->m_PayloadSize > 0U)
+	{
+		NetPacketSlice& payloadSlice = m_Slices[m_NumberOfSlices];
+		payloadSlice.m_Data = currentPayload->GetPayloadData();
+		payloadSlice.m_DataSize = currentPayload->m_PayloadSize;
+		++m_NumberOfSlices;
+	}
+
+	m_TotalPacketSize += currentMessage.GetTotalMessageSize();
+	++(*m_MessageCount);
+}
+
+
+
+bool GatheredPacket::CanWriteMessage(const OutgoingNetMessage& currentMessage) const
+{
+	return ((GetNumberOfMessages() < MAXIMUM_MESSAGES_PER_GATHERED_PACKET) && (m_TotalPacketSize + currentMessage.GetTotalMessageSize() <= PACKET_MTU));
+}
+
+
+
+uint8_t GatheredPacket::GetNumberOfMessages() const
+{
+	return (m_MessageCount != nullptr) ? *m_MessageCount : 0U;
+}
+
+
+
+size_t GatheredPacket::GetTotalPacketSize() const
+{
+	return m_TotalPacketSize;
 }
\ No newline at end of file
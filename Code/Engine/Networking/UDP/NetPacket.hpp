@@ -9,12 +9,16 @@
 
 
 const size_t PACKET_MTU = 1232;
+const size_t MAXIMUM_MESSAGES_PER_GATHERED_PACKET = 255;
+const size_t MAXIMUM_MESSAGE_HEADER_SIZE = 7;
+const size_t GATHERED_PACKET_HEADER_SIZE = 16 + MAXIMUM_MESSAGES_PER_GATHERED_PACKET * MAXIMUM_MESSAGE_HEADER_SIZE;
+const size_t MAXIMUM_SLICES_PER_PACKET = 1 + MAXIMUM_MESSAGES_PER_GATHERED_PACKET * 2;
 
 
 
 struct PacketHeader
 {
-	uint8_t m_SenderConnectionIndex;
+	uint16_t m_SenderConnectionIndex;
 	uint16_t m_PacketAck;
 	uint16_t m_MostRecentAck;
 	uint16_t m_PreviouslyReceivedAcksBitfield;
@@ -22,7 +26,16 @@ struct PacketHeader
 
 
 
+struct NetPacketSlice
+{
+	const void* m_Data;
+	size_t m_DataSize;
+};
+
+
+
 class NetMessage;
+struct OutgoingNetMessage;
 
 
 
@@ -40,4 +53,26 @@ public:
 
 public:
 	unsigned char m_Buffer[PACKET_MTU];
+};
+
+
+
+class GatheredPacket : public NetBytePacker
+{
+public:
+	GatheredPacket();
+
+	void WritePacketHeader(const PacketHeader& packetHeader);
+	void WriteMessage(const OutgoingNetMessage& currentMessage);
+	bool CanWriteMessage(const OutgoingNetMessage& currentMessage) const;
+
+	uint8_t GetNumberOfMessages() const;
+	size_t GetTotalPacketSize() const;
+
+public:
+	unsigned char m_HeaderBuffer[GATHERED_PACKET_HEADER_SIZE];
+	NetPacketSlice m_Slices[MAXIMUM_SLICES_PER_PACKET];
+	size_t m_NumberOfSlices;
+	size_t m_TotalPacketSize;
+	uint8_t* m_MessageCount;
 };
\ No newline at end of file
@@ -0,0 +1,788 @@
+#include "Engine/Networking/UDP/NetReplication.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+#include "Engine/ErrorHandling/StringUtils.hpp"
+#include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
+#include "Engine/Math/MathUtilities/MathUtilities.hpp"
+#include "Engine/Networking/UDP/NetSimulator.hpp"
+
+#include <algorithm>
+#include <string.h>
+
+
+
+ReplicationSchema::ReplicationSchema() :
+m_NumberOfFields(0U)
+{
+	memset(m_Fields, 0, sizeof(m_Fields));
+}
+
+
+
+void ReplicationSchema::AddIntegerField(uint8_t numberOfBits)
+{
+	ASSERT_OR_DIE(m_NumberOfFields < MAXIMUM_REPLICATED_FIELDS, "Too many fields in replication schema.");
+	ASSERT_OR_DIE(numberOfBits > 0U && numberOfBits <= MAXIMUM_BITS_PER_WRITE, "Invalid number of bits for replicated field.");
+
+	ReplicatedField& newField = m_Fields[m_NumberOfFields];
+	newField.m_NumberOfBits = numberOfBits;
+	newField.m_IsQuantizedFloat = false;
+	newField.m_MinimumValue = 0.0f;
+	newField.m_MaximumValue = 0.0f;
+	++m_NumberOfFields;
+}
+
+
+
+void ReplicationSchema::AddQuantizedFloatField(float minimumValue, float maximumValue, uint8_t numberOfBits)
+{
+	AddIntegerField(numberOfBits);
+
+	ReplicatedField& newField = m_Fields[m_NumberOfFields - 1];
+	newField.m_IsQuantizedFloat = true;
+	newField.m_MinimumValue = minimumValue;
+	newField.m_MaximumValue = maximumValue;
+}
+
+
+
+ReplicatedObjectState::ReplicatedObjectState()
+{
+	memset(m_FieldValues, 0, sizeof(m_FieldValues));
+}
+
+
+
+void ReplicatedObjectState::SetIntegerField(uint8_t fieldIndex, uint32_t fieldValue)
+{
+	m_FieldValues[fieldIndex] = fieldValue;
+}
+
+
+
+void ReplicatedObjectState::SetFloatField(const ReplicationSchema& objectSchema, uint8_t fieldIndex, float fieldValue)
+{
+	const ReplicatedField& currentField = objectSchema.m_Fields[fieldIndex];
+	m_FieldValues[fieldIndex] = QuantizeFloat(fieldValue, currentField.m_MinimumValue, currentField.m_MaximumValue, currentField.m_NumberOfBits);
+}
+
+
+
+uint32_t ReplicatedObjectState::GetIntegerField(uint8_t fieldIndex) const
+{
+	return m_FieldValues[fieldIndex];
+}
+
+
+
+float ReplicatedObjectState::GetFloatField(const ReplicationSchema& objectSchema, uint8_t fieldIndex) const
+{
+	const ReplicatedField& currentField = objectSchema.m_Fields[fieldIndex];
+	return DequantizeFloat(m_FieldValues[fieldIndex], currentField.m_MinimumValue, currentField.m_MaximumValue, currentField.m_NumberOfBits);
+}
+
+
+
+bool ReplicatedObjectState::IsFieldEqual(const ReplicatedObjectState& otherState, uint8_t fieldIndex) const
+{
+	return (m_FieldValues[fieldIndex] == otherState.m_FieldValues[fieldIndex]);
+}
+
+
+
+bool ReplicatedObjectState::IsStateEqual(const ReplicatedObjectState& otherState, uint8_t numberOfFields) const
+{
+	return (memcmp(m_FieldValues, otherState.m_FieldValues, sizeof(uint32_t) * numberOfFields) == 0);
+}
+
+
+
+ConnectionObjectState::ConnectionObjectState() :
+m_HasBaseline(false),
+m_WasSent(false),
+m_BaselineSnapshotID(0U),
+m_LastSentSnapshotID(0U),
+m_PriorityAccumulator(0.0f)
+{
+
+}
+
+
+
+RemoteReplicatedObject::RemoteReplicatedObject() :
+m_SchemaID(0U),
+m_LatestSnapshotID(0U)
+{
+	memset(m_History, 0, sizeof(m_History));
+}
+
+
+
+const ReplicatedObjectState* RemoteReplicatedObject::FindStateAtSnapshot(uint16_t snapshotID) const
+{
+	const ReceivedObjectHistory& currentHistory = m_History[snapshotID % RECEIVED_SNAPSHOT_HISTORY_SIZE];
+	if (currentHistory.m_IsValid && currentHistory.m_SnapshotID == snapshotID)
+	{
+		return &(currentHistory.m_ReceivedState);
+	}
+
+	return nullptr;
+}
+
+
+
+void RemoteReplicatedObject::AddStateAtSnapshot(uint16_t snapshotID, const ReplicatedObjectState& receivedState)
+{
+	ReceivedObjectHistory& currentHistory = m_History[snapshotID % RECEIVED_SNAPSHOT_HISTORY_SIZE];
+	currentHistory.m_SnapshotID = snapshotID;
+	currentHistory.m_IsValid = true;
+	currentHistory.m_ReceivedState = receivedState;
+}
+
+
+
+ReplicationConnectionState::ReplicationConnectionState() :
+m_NextSnapshotID(0U),
+m_LastSnapshotTime(0.0),
+m_LastSnapshotSize(0U),
+m_LastNumberOfObjectsSent(0U)
+{
+	for (size_t recordIndex = 0; recordIndex < SENT_SNAPSHOT_HISTORY_SIZE; ++recordIndex)
+	{
+		m_SentSnapshots[recordIndex].m_SnapshotID = 0U;
+		m_SentSnapshots[recordIndex].m_IsValid = false;
+	}
+}
+
+
+
+NetReplicationSystem::NetReplicationSystem(NetSession* parentSession) :
+m_ParentSession(parentSession),
+m_SnapshotByteBudget(DEFAULT_SNAPSHOT_BYTE_BUDGET),
+m_SnapshotInterval(1.0 / DEFAULT_SNAPSHOT_RATE)
+{
+	ASSERT_OR_DIE(m_ParentSession->m_ReplicationSystem == nullptr, "Net Session already has a replication system.");
+
+	memset(m_IsSchemaRegistered, 0, sizeof(m_IsSchemaRegistered));
+	memset(m_ConnectionStates, 0, sizeof(m_ConnectionStates));
+
+	m_ParentSession->m_ReplicationSystem = this;
+	m_ParentSession->m_OnConnectionUpdated.RegisterMethod(this, &NetReplicationSystem::OnConnectionUpdated);
+	m_ParentSession->m_OnConnectionLeft.RegisterMethod(this, &NetReplicationSystem::OnConnectionLeft);
+	m_ParentSession->m_OnAckTagConfirmed.RegisterMethod(this, &NetReplicationSystem::OnAckTagConfirmed);
+}
+
+
+
+NetReplicationSystem::~NetReplicationSystem()
+{
+	std::lock_guard<std::recursive_mutex> sessionLock(m_ParentSession->m_SessionLock);
+
+	m_ParentSession->m_OnConnectionUpdated.UnregisterMethod(this, &NetReplicationSystem::OnConnectionUpdated);
+	m_ParentSession->m_OnConnectionLeft.UnregisterMethod(this, &NetReplicationSystem::OnConnectionLeft);
+	m_ParentSession->m_OnAckTagConfirmed.UnregisterMethod(this, &NetReplicationSystem::OnAckTagConfirmed);
+	m_ParentSession->m_ReplicationSystem = nullptr;
+
+	for (size_t connectionIndex = 0; connectionIndex < MAXIMUM_NUMBER_OF_CONNECTIONS; ++connectionIndex)
+	{
+		delete m_ConnectionStates[connectionIndex];
+		m_ConnectionStates[connectionIndex] = nullptr;
+	}
+}
+
+
+
+void NetReplicationSystem::RegisterSchema(uint8_t schemaID, const ReplicationSchema& objectSchema)
+{
+	ASSERT_OR_DIE(schemaID < MAXIMUM_REPLICATION_SCHEMAS, "Replication schema ID is out of range.");
+
+	m_Schemas[schemaID] = objectSchema;
+	m_IsSchemaRegistered[schemaID] = true;
+}
+
+
+
+const ReplicationSchema* NetReplicationSystem::FindSchema(uint8_t schemaID) const
+{
+	if (schemaID < MAXIMUM_REPLICATION_SCHEMAS && m_IsSchemaRegistered[schemaID])
+	{
+		return &(m_Schemas[schemaID]);
+	}
+
+	return nullptr;
+}
+
+
+
+void NetReplicationSystem::SetReplicatedObject(uint32_t objectID, uint8_t schemaID, const ReplicatedObjectState& currentState, float currentPriority)
+{
+	ASSERT_OR_DIE(FindSchema(schemaID) != nullptr, "Replicated object uses an unregistered schema.");
+	std::lock_guard<std::recursive_mutex> sessionLock(m_ParentSession->m_SessionLock);
+
+	LocalReplicatedObject& localObject = m_LocalObjects[objectID];
+	localObject.m_SchemaID = schemaID;
+	localObject.m_Priority = currentPriority;
+	localObject.m_CurrentState = currentState;
+}
+
+
+
+void NetReplicationSystem::RemoveReplicatedObject(uint32_t objectID)
+{
+	std::lock_guard<std::recursive_mutex> sessionLock(m_ParentSession->m_SessionLock);
+
+	m_LocalObjects.erase(objectID);
+	for (ReplicationConnectionState* connectionState : m_ConnectionStates)
+	{
+		if (connectionState == nullptr)
+		{
+			continue;
+		}
+
+		std::unordered_map<uint32_t, ConnectionObjectState>::iterator objectIterator = connectionState->m_ObjectStates.find(objectID);
+		if (objectIterator != connectionState->m_ObjectStates.end())
+		{
+			if (objectIterator->second.m_WasSent)
+			{
+				connectionState->m_PendingDestroys.push_back(objectID);
+			}
+
+			connectionState->m_ObjectStates.erase(objectIterator);
+		}
+	}
+}
+
+
+
+const ReplicatedObjectState* NetReplicationSystem::GetRemoteObjectState(uint16_t connectionIndex, uint32_t objectID) const
+{
+	if (connectionIndex >= MAXIMUM_NUMBER_OF_CONNECTIONS || m_ConnectionStates[connectionIndex] == nullptr)
+	{
+		return nullptr;
+	}
+
+	const std::unordered_map<uint32_t, RemoteReplicatedObject>& remoteObjects = m_ConnectionStates[connectionIndex]->m_RemoteObjects;
+	std::unordered_map<uint32_t, RemoteReplicatedObject>::const_iterator objectIterator = remoteObjects.find(objectID);
+	if (objectIterator != remoteObjects.end())
+	{
+		return &(objectIterator->second.m_LatestState);
+	}
+
+	return nullptr;
+}
+
+
+
+void NetReplicationSystem::SetSnapshotByteBudget(size_t snapshotByteBudget)
+{
+	m_SnapshotByteBudget = GetMinimumOfTwoSize_T(snapshotByteBudget, MESSAGE_MTU);
+}
+
+
+
+void NetReplicationSystem::SetSnapshotRate(float snapshotsPerSecond)
+{
+	ASSERT_OR_DIE(snapshotsPerSecond > 0.0f, "Snapshot rate must be positive.");
+	m_SnapshotInterval = 1.0 / static_cast<double>(snapshotsPerSecond);
+}
+
+
+
+void NetReplicationSystem::ReadSnapshot(NetConnection* senderConnection, const NetMessage& snapshotMessage)
+{
+	std::lock_guard<std::recursive_mutex> sessionLock(m_ParentSession->m_SessionLock);
+
+	ReplicationConnectionState* connectionState = GetOrCreateConnectionState(senderConnection->m_ConnectionIndex);
+	NetBitReader bitReader(&snapshotMessage);
+
+	uint32_t snapshotID = 0U;
+	if (!bitReader.ReadBits(&snapshotID, SNAPSHOT_ID_BITS))
+	{
+		return;
+	}
+
+	bool hasNextObject = false;
+	while (bitReader.ReadBool(&hasNextObject) && hasNextObject)
+	{
+		if (!ReadObject(bitReader, senderConnection, connectionState, static_cast<uint16_t>(snapshotID)))
+		{
+			break;
+		}
+	}
+	bitReader.FinishReading();
+
+	std::unordered_map<uint32_t, uint16_t>::iterator destroyedIterator = connectionState->m_DestroyedRemoteObjects.begin();
+	while (destroyedIterator != connectionState->m_DestroyedRemoteObjects.end())
+	{
+		uint16_t destroyedAge = static_cast<uint16_t>(snapshotID) - destroyedIterator->second;
+		if (destroyedAge > SENT_SNAPSHOT_HISTORY_SIZE && destroyedAge < 0x8000)
+		{
+			destroyedIterator = connectionState->m_DestroyedRemoteObjects.erase(destroyedIterator);
+		}
+		else
+		{
+			++destroyedIterator;
+		}
+	}
+}
+
+
+
+void NetReplicationSystem::OnConnectionUpdated(NetConnection* currentConnection)
+{
+	if (currentConnection->IsOwnConnection())
+	{
+		return;
+	}
+
+	ReplicationConnectionState* connectionState = GetOrCreateConnectionState(currentConnection->m_ConnectionIndex);
+	double currentTime = GetNetworkTimeInSeconds();
+	if (currentTime - connectionState->m_LastSnapshotTime < m_SnapshotInterval)
+	{
+		return;
+	}
+
+	connectionState->m_LastSnapshotTime = currentTime;
+	WriteSnapshot(currentConnection, connectionState);
+}
+
+
+
+void NetReplicationSystem::OnConnectionLeft(NetConnection* leftConnection)
+{
+	uint16_t connectionIndex = leftConnection->m_ConnectionIndex;
+	if (connectionIndex < MAXIMUM_NUMBER_OF_CONNECTIONS)
+	{
+		delete m_ConnectionStates[connectionIndex];
+		m_ConnectionStates[connectionIndex] = nullptr;
+	}
+}
+
+
+
+void NetReplicationSystem::OnAckTagConfirmed(NetConnection* currentConnection, uint16_t ackTag)
+{
+	ReplicationConnectionState* connectionState = m_ConnectionStates[currentConnection->m_ConnectionIndex];
+	if (connectionState == nullptr)
+	{
+		return;
+	}
+
+	SentSnapshotRecord& sentSnapshot = connectionState->m_SentSnapshots[ackTag % SENT_SNAPSHOT_HISTORY_SIZE];
+	if (!sentSnapshot.m_IsValid || sentSnapshot.m_SnapshotID != ackTag)
+	{
+		return;
+	}
+
+	for (const SentObjectRecord& sentObject : sentSnapshot.m_SentObjects)
+	{
+		if (sentObject.m_IsDestroyed)
+		{
+			std::vector<uint32_t>& pendingDestroys = connectionState->m_PendingDestroys;
+			pendingDestroys.erase(std::remove(pendingDestroys.begin(), pendingDestroys.end(), sentObject.m_ObjectID), pendingDestroys.end());
+			continue;
+		}
+
+		std::unordered_map<uint32_t, ConnectionObjectState>::iterator objectIterator = connectionState->m_ObjectStates.find(sentObject.m_ObjectID);
+		if (objectIterator == connectionState->m_ObjectStates.end())
+		{
+			continue;
+		}
+
+		ConnectionObjectState& objectState = objectIterator->second;
+		if (!objectState.m_HasBaseline || IsSnapshotIDNewer(ackTag, objectState.m_BaselineSnapshotID))
+		{
+			objectState.m_HasBaseline = true;
+			objectState.m_BaselineSnapshotID = ackTag;
+			objectState.m_BaselineState = sentObject.m_SentState;
+		}
+	}
+
+	sentSnapshot.m_IsValid = false;
+}
+
+
+
+ReplicationConnectionState* NetReplicationSystem::GetOrCreateConnectionState(uint16_t connectionIndex)
+{
+	ASSERT_OR_DIE(connectionIndex < MAXIMUM_NUMBER_OF_CONNECTIONS, "Connection index is out of range.");
+
+	if (m_ConnectionStates[connectionIndex] == nullptr)
+	{
+		m_ConnectionStates[connectionIndex] = new ReplicationConnectionState();
+	}
+
+	return m_ConnectionStates[connectionIndex];
+}
+
+
+
+bool ComparePrioritizedObjects(const PrioritizedObject& firstObject, const PrioritizedObject& secondObject)
+{
+	return (firstObject.m_Priority > secondObject.m_Priority);
+}
+
+
+
+void NetReplicationSystem::WriteSnapshot(NetConnection* currentConnection, ReplicationConnectionState* connectionState)
+{
+	if (m_LocalObjects.empty() && connectionState->m_PendingDestroys.empty())
+	{
+		return;
+	}
+
+	uint16_t snapshotID = connectionState->m_NextSnapshotID;
+	++connectionState->m_NextSnapshotID;
+	if (connectionState->m_NextSnapshotID == INVALID_ACK_TAG)
+	{
+		connectionState->m_NextSnapshotID = 0U;
+	}
+
+	SentSnapshotRecord& sentSnapshot = connectionState->m_SentSnapshots[snapshotID % SENT_SNAPSHOT_HISTORY_SIZE];
+	sentSnapshot.m_SnapshotID = snapshotID;
+	sentSnapshot.m_IsValid = true;
+	sentSnapshot.m_SentObjects.clear();
+
+	NetMessage snapshotMessage(NET_MESSAGE_SNAPSHOT);
+	NetBitWriter bitWriter(&snapshotMessage);
+	bitWriter.WriteBits(snapshotID, SNAPSHOT_ID_BITS);
+
+	size_t remainingBits = (m_SnapshotByteBudget * 8U) - SNAPSHOT_ID_BITS - 1U;
+
+	for (uint32_t destroyedObjectID : connectionState->m_PendingDestroys)
+	{
+		size_t destroyBits = 2U + GetVariableLengthIntegerBits(destroyedObjectID);
+		if (destroyBits > remainingBits)
+		{
+			break;
+		}
+
+		bitWriter.WriteBool(true);
+		bitWriter.WriteVariableLengthInteger(destroyedObjectID);
+		bitWriter.WriteBool(true);
+		remainingBits -= destroyBits;
+
+		SentObjectRecord sentObject;
+		sentObject.m_ObjectID = destroyedObjectID;
+		sentObject.m_IsDestroyed = true;
+		sentSnapshot.m_SentObjects.push_back(sentObject);
+	}
+
+	m_PrioritizedObjects.clear();
+	for (std::unordered_map<uint32_t, LocalReplicatedObject>::iterator localIterator = m_LocalObjects.begin(); localIterator != m_LocalObjects.end(); ++localIterator)
+	{
+		const LocalReplicatedObject& localObject = localIterator->second;
+		ConnectionObjectState& objectState = connectionState->m_ObjectStates[localIterator->first];
+
+		bool receiverIsCurrent = objectState.m_HasBaseline && objectState.m_BaselineSnapshotID == objectState.m_LastSentSnapshotID;
+		if (receiverIsCurrent && localObject.m_CurrentState.IsStateEqual(objectState.m_BaselineState, m_Schemas[localObject.m_SchemaID].m_NumberOfFields))
+		{
+			continue;
+		}
+
+		objectState.m_PriorityAccumulator += localObject.m_Priority;
+
+		PrioritizedObject prioritizedObject;
+		prioritizedObject.m_Priority = objectState.m_PriorityAccumulator;
+		prioritizedObject.m_ObjectID = localIterator->first;
+		m_PrioritizedObjects.push_back(prioritizedObject);
+	}
+
+	std::sort(m_PrioritizedObjects.begin(), m_PrioritizedObjects.end(), ComparePrioritizedObjects);
+
+	size_t numberOfObjectsSent = 0U;
+	for (const PrioritizedObject& prioritizedObject : m_PrioritizedObjects)
+	{
+		const LocalReplicatedObject& localObject = m_LocalObjects[prioritizedObject.m_ObjectID];
+		ConnectionObjectState& objectState = connectionState->m_ObjectStates[prioritizedObject.m_ObjectID];
+
+		uint16_t baselineAge = 0U;
+		if (objectState.m_HasBaseline)
+		{
+			baselineAge = snapshotID - objectState.m_BaselineSnapshotID;
+			if (baselineAge >= RECEIVED_SNAPSHOT_HISTORY_SIZE)
+			{
+				baselineAge = 0U;
+			}
+		}
+
+		size_t objectBits = CalculateObjectBits(prioritizedObject.m_ObjectID, localObject, objectState, baselineAge);
+		if (objectBits > remainingBits)
+		{
+			continue;
+		}
+
+		WriteObject(bitWriter, prioritizedObject.m_ObjectID, localObject, objectState, baselineAge);
+		remainingBits -= objectBits;
+		++numberOfObjectsSent;
+
+		objectState.m_WasSent = true;
+		objectState.m_LastSentSnapshotID = snapshotID;
+		objectState.m_PriorityAccumulator = 0.0f;
+
+		SentObjectRecord sentObject;
+		sentObject.m_ObjectID = prioritizedObject.m_ObjectID;
+		sentObject.m_IsDestroyed = false;
+		sentObject.m_SentState = localObject.m_CurrentState;
+		sentSnapshot.m_SentObjects.push_back(sentObject);
+	}
+
+	bitWriter.WriteBool(false);
+	bitWriter.FlushBits();
+
+	connectionState->m_LastSnapshotSize = snapshotMessage.GetTotalMessageSize();
+	connectionState->m_LastNumberOfObjectsSent = numberOfObjectsSent;
+
+	if (sentSnapshot.m_SentObjects.empty())
+	{
+		sentSnapshot.m_IsValid = false;
+		return;
+	}
+
+	currentConnection->AddMessageToSendQueue(snapshotMessage, snapshotID);
+}
+
+
+
+size_t NetReplicationSystem::CalculateObjectBits(uint32_t objectID, const LocalReplicatedObject& localObject, const ConnectionObjectState& objectState, uint16_t baselineAge) const
+{
+	const ReplicationSchema& objectSchema = m_Schemas[localObject.m_SchemaID];
+	size_t objectBits = 2U + GetVariableLengthIntegerBits(objectID) + GetVariableLengthIntegerBits(baselineAge) + 8U;
+
+	if (baselineAge == 0U)
+	{
+		for (uint8_t fieldIndex = 0; fieldIndex < objectSchema.m_NumberOfFields; ++fieldIndex)
+		{
+			objectBits += objectSchema.m_Fields[fieldIndex].m_NumberOfBits;
+		}
+
+		return objectBits;
+	}
+
+	objectBits += objectSchema.m_NumberOfFields;
+	for (uint8_t fieldIndex = 0; fieldIndex < objectSchema.m_NumberOfFields; ++fieldIndex)
+	{
+		if (!localObject.m_CurrentState.IsFieldEqual(objectState.m_BaselineState, fieldIndex))
+		{
+			objectBits += objectSchema.m_Fields[fieldIndex].m_NumberOfBits;
+		}
+	}
+
+	return objectBits;
+}
+
+
+
+void NetReplicationSystem::WriteObject(NetBitWriter& bitWriter, uint32_t objectID, const LocalReplicatedObject& localObject, const ConnectionObjectState& objectState, uint16_t baselineAge) const
+{
+	const ReplicationSchema& objectSchema = m_Schemas[localObject.m_SchemaID];
+	const ReplicatedObjectState& currentState = localObject.m_CurrentState;
+
+	bitWriter.WriteBool(true);
+	bitWriter.WriteVariableLengthInteger(objectID);
+	bitWriter.WriteBool(false);
+	bitWriter.WriteVariableLengthInteger(baselineAge);
+	bitWriter.WriteBits(localObject.m_SchemaID, 8U);
+
+	if (baselineAge == 0U)
+	{
+		for (uint8_t fieldIndex = 0; fieldIndex < objectSchema.m_NumberOfFields; ++fieldIndex)
+		{
+			bitWriter.WriteBits(currentState.m_FieldValues[fieldIndex], objectSchema.m_Fields[fieldIndex].m_NumberOfBits);
+		}
+
+		return;
+	}
+
+	for (uint8_t fieldIndex = 0; fieldIndex < objectSchema.m_NumberOfFields; ++fieldIndex)
+	{
+		bitWriter.WriteBool(!currentState.IsFieldEqual(objectState.m_BaselineState, fieldIndex));
+	}
+
+	for (uint8_t fieldIndex = 0; fieldIndex < objectSchema.m_NumberOfFields; ++fieldIndex)
+	{
+		if (!currentState.IsFieldEqual(objectState.m_BaselineState, fieldIndex))
+		{
+			bitWriter.WriteBits(currentState.m_FieldValues[fieldIndex], objectSchema.m_Fields[fieldIndex].m_NumberOfBits);
+		}
+	}
+}
+
+
+
+bool NetReplicationSystem::ReadObject(NetBitReader& bitReader, NetConnection* senderConnection, ReplicationConnectionState* connectionState, uint16_t snapshotID)
+{
+	uint32_t objectID = 0U;
+	bool isDestroyed = false;
+	if (!bitReader.ReadVariableLengthInteger(&objectID) || !bitReader.ReadBool(&isDestroyed))
+	{
+		return false;
+	}
+
+	std::unordered_map<uint32_t, RemoteReplicatedObject>::iterator remoteIterator = connectionState->m_RemoteObjects.find(objectID);
+	if (isDestroyed)
+	{
+		if (remoteIterator != connectionState->m_RemoteObjects.end())
+		{
+			connectionState->m_RemoteObjects.erase(remoteIterator);
+			m_OnRemoteObjectDestroyed.TriggerEvent(senderConnection, objectID);
+		}
+
+		connectionState->m_DestroyedRemoteObjects[objectID] = snapshotID;
+		return true;
+	}
+
+	uint32_t baselineAge = 0U;
+	if (!bitReader.ReadVariableLengthInteger(&baselineAge))
+	{
+		return false;
+	}
+
+	uint32_t schemaID = 0U;
+	if (!bitReader.ReadBits(&schemaID, 8U) || FindSchema(static_cast<uint8_t>(schemaID)) == nullptr)
+	{
+		return false;
+	}
+
+	ReplicatedObjectState receivedState;
+	const ReplicatedObjectState* baselineState = nullptr;
+
+	if ((baselineAge != 0U) && (remoteIterator != connectionState->m_RemoteObjects.end()))
+	{
+		baselineState = remoteIterator->second.FindStateAtSnapshot(snapshotID - static_cast<uint16_t>(baselineAge));
+	}
+
+	const ReplicationSchema& objectSchema = m_Schemas[schemaID];
+	bool fieldChanged[MAXIMUM_REPLICATED_FIELDS];
+	for (uint8_t fieldIndex = 0; fieldIndex < objectSchema.m_NumberOfFields; ++fieldIndex)
+	{
+		fieldChanged[fieldIndex] = true;
+		if (baselineAge != 0U && !bitReader.ReadBool(&fieldChanged[fieldIndex]))
+		{
+			return false;
+		}
+	}
+
+	for (uint8_t fieldIndex = 0; fieldIndex < objectSchema.m_NumberOfFields; ++fieldIndex)
+	{
+		if (fieldChanged[fieldIndex])
+		{
+			if (!bitReader.ReadBits(&receivedState.m_FieldValues[fieldIndex], objectSchema.m_Fields[fieldIndex].m_NumberOfBits))
+			{
+				return false;
+			}
+		}
+		else if (baselineState != nullptr)
+		{
+			receivedState.m_FieldValues[fieldIndex] = baselineState->m_FieldValues[fieldIndex];
+		}
+	}
+
+	if (baselineAge != 0U && baselineState == nullptr)
+	{
+		return true;
+	}
+
+	std::unordered_map<uint32_t, uint16_t>::iterator destroyedIterator = connectionState->m_DestroyedRemoteObjects.find(objectID);
+	if (destroyedIterator != connectionState->m_DestroyedRemoteObjects.end())
+	{
+		bool isRecreatedInSameSnapshot = snapshotID == destroyedIterator->second;
+		if (!isRecreatedInSameSnapshot && !IsSnapshotIDNewer(snapshotID, destroyedIterator->second))
+		{
+			return true;
+		}
+
+		connectionState->m_DestroyedRemoteObjects.erase(destroyedIterator);
+	}
+
+	if (remoteIterator == connectionState->m_RemoteObjects.end())
+	{
+		remoteIterator = connectionState->m_RemoteObjects.emplace(objectID, RemoteReplicatedObject()).first;
+		remoteIterator->second.m_LatestSnapshotID = snapshotID - 1U;
+	}
+
+	RemoteReplicatedObject& remoteObject = remoteIterator->second;
+	remoteObject.m_SchemaID = static_cast<uint8_t>(schemaID);
+	remoteObject.AddStateAtSnapshot(snapshotID, receivedState);
+
+	if (IsSnapshotIDNewer(snapshotID, remoteObject.m_LatestSnapshotID))
+	{
+		remoteObject.m_LatestSnapshotID = snapshotID;
+		remoteObject.m_LatestState = receivedState;
+		m_OnRemoteObjectUpdated.TriggerEvent(senderConnection, objectID, &(remoteObject.m_LatestState));
+	}
+
+	return true;
+}
+
+
+
+bool IsSnapshotIDNewer(uint16_t firstSnapshotID, uint16_t secondSnapshotID)
+{
+	uint16_t difference = firstSnapshotID - secondSnapshotID;
+	return (difference != 0U && difference < 0x8000);
+}
+
+
+
+size_t GetVariableLengthIntegerBits(uint32_t integerData)
+{
+	size_t numberOfGroups = 1U;
+	while (integerData >= (1U << VARIABLE_LENGTH_GROUP_BITS))
+	{
+		integerData >>= VARIABLE_LENGTH_GROUP_BITS;
+		++numberOfGroups;
+	}
+
+	return numberOfGroups * (VARIABLE_LENGTH_GROUP_BITS + 1U);
+}
+
+
+
+void OnSnapshotReceived(const NetSender& snapshotSender, const NetMessage& snapshotMessage)
+{
+	NetSession* currentSession = snapshotSender.m_Session;
+	if (currentSession->m_ReplicationSystem == nullptr || snapshotSender.m_Connection == nullptr)
+	{
+		return;
+	}
+
+	currentSession->m_ReplicationSystem->ReadSnapshot(snapshotSender.m_Connection, snapshotMessage);
+}
+
+
+
+void NetReplicationStatsCommand(Command& currentCommand)
+{
+	currentCommand;
+
+	NetSession* currentSession = NetSession::LocalNetSession();
+	if (currentSession == nullptr || currentSession->m_ReplicationSystem == nullptr)
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("No replication system is attached to the Net Session.", RGBA::RED));
+		return;
+	}
+
+	NetReplicationSystem* replicationSystem = currentSession->m_ReplicationSystem;
+	std::lock_guard<std::recursive_mutex> sessionLock(currentSession->m_SessionLock);
+
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Local objects: %u. Snapshot budget: %u bytes.", replicationSystem->m_LocalObjects.size(), replicationSystem->m_SnapshotByteBudget), RGBA::GREEN));
+	for (size_t connectionIndex = 0; connectionIndex < MAXIMUM_NUMBER_OF_CONNECTIONS; ++connectionIndex)
+	{
+		const ReplicationConnectionState* connectionState = replicationSystem->m_ConnectionStates[connectionIndex];
+		if (connectionState == nullptr)
+		{
+			continue;
+		}
+
+		size_t numberOfBaselines = 0U;
+		for (std::unordered_map<uint32_t, ConnectionObjectState>::const_iterator objectIterator = connectionState->m_ObjectStates.begin(); objectIterator != connectionState->m_ObjectStates.end(); ++objectIterator)
+		{
+			if (objectIterator->second.m_HasBaseline)
+			{
+				++numberOfBaselines;
+			}
+		}
+
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Connection %u: %u acked baselines, last snapshot %u bytes with %u objects, %u pending destroys, %u remote objects.", connectionIndex, numberOfBaselines, connectionState->m_LastSnapshotSize, connectionState->m_LastNumberOfObjectsSent, connectionState->m_PendingDestroys.size(), connectionState->m_RemoteObjects.size()), RGBA::GREEN));
+	}
+}
\ No newline at end of file
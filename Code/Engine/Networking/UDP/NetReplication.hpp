@@ -0,0 +1,208 @@
+#pragma once
+
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Networking/UDP/NetSession.hpp"
+#include "Engine/Networking/UDP/NetBitStream.hpp"
+#include "Engine/DeveloperConsole/Command.hpp"
+#include "Engine/EventSystem/EventSystem.hpp"
+
+
+
+const size_t MAXIMUM_REPLICATED_FIELDS = 16;
+const size_t MAXIMUM_REPLICATION_SCHEMAS = 64;
+const size_t SENT_SNAPSHOT_HISTORY_SIZE = 64;
+const size_t RECEIVED_SNAPSHOT_HISTORY_SIZE = 32;
+const size_t DEFAULT_SNAPSHOT_BYTE_BUDGET = 768;
+const size_t SNAPSHOT_ID_BITS = 16;
+const float DEFAULT_SNAPSHOT_RATE = 20.0f;
+
+
+
+struct ReplicatedField
+{
+	uint8_t m_NumberOfBits;
+	bool m_IsQuantizedFloat;
+	float m_MinimumValue;
+	float m_MaximumValue;
+};
+
+
+
+struct ReplicationSchema
+{
+	ReplicationSchema();
+
+	void AddIntegerField(uint8_t numberOfBits);
+	void AddQuantizedFloatField(float minimumValue, float maximumValue, uint8_t numberOfBits);
+
+	uint8_t m_NumberOfFields;
+	ReplicatedField m_Fields[MAXIMUM_REPLICATED_FIELDS];
+};
+
+
+
+struct ReplicatedObjectState
+{
+	ReplicatedObjectState();
+
+	void SetIntegerField(uint8_t fieldIndex, uint32_t fieldValue);
+	void SetFloatField(const ReplicationSchema& objectSchema, uint8_t fieldIndex, float fieldValue);
+	uint32_t GetIntegerField(uint8_t fieldIndex) const;
+	float GetFloatField(const ReplicationSchema& objectSchema, uint8_t fieldIndex) const;
+
+	bool IsFieldEqual(const ReplicatedObjectState& otherState, uint8_t fieldIndex) const;
+	bool IsStateEqual(const ReplicatedObjectState& otherState, uint8_t numberOfFields) const;
+
+	uint32_t m_FieldValues[MAXIMUM_REPLICATED_FIELDS];
+};
+
+
+
+struct LocalReplicatedObject
+{
+	uint8_t m_SchemaID;
+	float m_Priority;
+	ReplicatedObjectState m_CurrentState;
+};
+
+
+
+struct ConnectionObjectState
+{
+	ConnectionObjectState();
+
+	bool m_HasBaseline;
+	bool m_WasSent;
+	uint16_t m_BaselineSnapshotID;
+	uint16_t m_LastSentSnapshotID;
+	float m_PriorityAccumulator;
+	ReplicatedObjectState m_BaselineState;
+};
+
+
+
+struct SentObjectRecord
+{
+	uint32_t m_ObjectID;
+	bool m_IsDestroyed;
+	ReplicatedObjectState m_SentState;
+};
+
+
+
+struct SentSnapshotRecord
+{
+	uint16_t m_SnapshotID;
+	bool m_IsValid;
+	std::vector<SentObjectRecord> m_SentObjects;
+};
+
+
+
+struct ReceivedObjectHistory
+{
+	uint16_t m_SnapshotID;
+	bool m_IsValid;
+	ReplicatedObjectState m_ReceivedState;
+};
+
+
+
+struct RemoteReplicatedObject
+{
+	RemoteReplicatedObject();
+
+	const ReplicatedObjectState* FindStateAtSnapshot(uint16_t snapshotID) const;
+	void AddStateAtSnapshot(uint16_t snapshotID, const ReplicatedObjectState& receivedState);
+
+	uint8_t m_SchemaID;
+	uint16_t m_LatestSnapshotID;
+	ReplicatedObjectState m_LatestState;
+	ReceivedObjectHistory m_History[RECEIVED_SNAPSHOT_HISTORY_SIZE];
+};
+
+
+
+struct ReplicationConnectionState
+{
+	ReplicationConnectionState();
+
+	uint16_t m_NextSnapshotID;
+	double m_LastSnapshotTime;
+	size_t m_LastSnapshotSize;
+	size_t m_LastNumberOfObjectsSent;
+
+	std::unordered_map<uint32_t, ConnectionObjectState> m_ObjectStates;
+	std::vector<uint32_t> m_PendingDestroys;
+	SentSnapshotRecord m_SentSnapshots[SENT_SNAPSHOT_HISTORY_SIZE];
+
+	std::unordered_map<uint32_t, RemoteReplicatedObject> m_RemoteObjects;
+	std::unordered_map<uint32_t, uint16_t> m_DestroyedRemoteObjects;
+};
+
+
+
+struct PrioritizedObject
+{
+	float m_Priority;
+	uint32_t m_ObjectID;
+};
+
+
+
+class NetReplicationSystem
+{
+public:
+	NetReplicationSystem(class NetSession* parentSession);
+	~NetReplicationSystem();
+
+	void RegisterSchema(uint8_t schemaID, const ReplicationSchema& objectSchema);
+	const ReplicationSchema* FindSchema(uint8_t schemaID) const;
+
+	void SetReplicatedObject(uint32_t objectID, uint8_t schemaID, const ReplicatedObjectState& currentState, float currentPriority);
+	void RemoveReplicatedObject(uint32_t objectID);
+	const ReplicatedObjectState* GetRemoteObjectState(uint16_t connectionIndex, uint32_t objectID) const;
+
+	void SetSnapshotByteBudget(size_t snapshotByteBudget);
+	void SetSnapshotRate(float snapshotsPerSecond);
+
+	void ReadSnapshot(NetConnection* senderConnection, const NetMessage& snapshotMessage);
+
+private:
+	void OnConnectionUpdated(NetConnection* currentConnection);
+	void OnConnectionLeft(NetConnection* leftConnection);
+	void OnAckTagConfirmed(NetConnection* currentConnection, uint16_t ackTag);
+
+	ReplicationConnectionState* GetOrCreateConnectionState(uint16_t connectionIndex);
+	void WriteSnapshot(NetConnection* currentConnection, ReplicationConnectionState* connectionState);
+	size_t CalculateObjectBits(uint32_t objectID, const LocalReplicatedObject& localObject, const ConnectionObjectState& objectState, uint16_t baselineAge) const;
+	void WriteObject(NetBitWriter& bitWriter, uint32_t objectID, const LocalReplicatedObject& localObject, const ConnectionObjectState& objectState, uint16_t baselineAge) const;
+	bool ReadObject(NetBitReader& bitReader, NetConnection* senderConnection, ReplicationConnectionState* connectionState, uint16_t snapshotID);
+
+public:
+	class NetSession* m_ParentSession;
+	ReplicationSchema m_Schemas[MAXIMUM_REPLICATION_SCHEMAS];
+	bool m_IsSchemaRegistered[MAXIMUM_REPLICATION_SCHEMAS];
+
+	std::unordered_map<uint32_t, LocalReplicatedObject> m_LocalObjects;
+	ReplicationConnectionState* m_ConnectionStates[MAXIMUM_NUMBER_OF_CONNECTIONS];
+	std::vector<PrioritizedObject> m_PrioritizedObjects;
+
+	size_t m_SnapshotByteBudget;
+	double m_SnapshotInterval;
+
+	EventSystem<NetConnection*, uint32_t, const ReplicatedObjectState*> m_OnRemoteObjectUpdated;
+	EventSystem<NetConnection*, uint32_t> m_OnRemoteObjectDestroyed;
+};
+
+
+
+bool IsSnapshotIDNewer(uint16_t firstSnapshotID, uint16_t secondSnapshotID);
+size_t GetVariableLengthIntegerBits(uint32_t integerData);
+
+void OnSnapshotReceived(const NetSender& snapshotSender, const NetMessage& snapshotMessage);
+
+void NetReplicationStatsCommand(Command& currentCommand);
\ No newline at end of file
@@ -1,9 +1,14 @@
 #include "Engine/Networking/UDP/NetSession.hpp"
+#include "Engine/Networking/UDP/NetSoakTest.hpp"
+#include "Engine/Networking/UDP/NetBitStream.hpp"
+#include "Engine/Networking/UDP/NetReplication.hpp"
 #include "Engine/Networking/NetworkSystem.hpp"
 #include "Engine/DeveloperConsole/DeveloperConsole.hpp"
 #include "Engine/Renderer/RenderUtilities/BasicRenderer.hpp"
 #include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
 #include "Engine/Time/Clock.hpp"
+#include "Engine/Time/Time.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
 
 
 
@@ -21,9 +26,16 @@ m_HostTimeOut(0.0f),
 m_ElapsedTimeSinceLastSent(0.0f),
 m_ElapsedTimeSinceLastReceived(0.0f),
 m_LatestError(NO_ERROR_CODE),
-m_HostListening(false)
+m_HostListening(false),
+m_ReplicationSystem(nullptr),
+m_NetworkThread(nullptr),
+m_NetworkThreadIsRunning(false),
+m_LastNetworkSendTime(0.0),
+m_LastUpdateTimeInMilliseconds(0.0)
 {
 	NetworkSystem::SingletonInstance()->m_OnUpdate.RegisterMethod(this, &NetSession::Update);
+	memset(m_ConnectionsByIndex, 0, sizeof(m_ConnectionsByIndex));
+	m_ReceivedMessagePool.InitializeObjectPool(RECEIVED_MESSAGES_PER_POOL_CHUNK);
 
 	DeveloperConsole::RegisterCommands("StartNetSession", "Starts a new Net Session.", StartSessionCommand);
 	DeveloperConsole::RegisterCommands("StopNetSession", "Stops the currently running Net Session.", StopSessionCommand);
@@ -37,6 +49,14 @@ m_HostListening(false)
 
 	DeveloperConsole::RegisterCommands("SimulateNetLag", "Arbitrarily sets a lag duration for the packets.", SimulateLagCommand);
 	DeveloperConsole::RegisterCommands("SimulateNetLoss", "Arbitrarily sets a loss percentage for the packets.", SimulateLossCommand);
+	DeveloperConsole::RegisterCommands("SimulateNetConditions", "Sets duplicate and reorder percentages, a bandwidth cap and the simulator seed for incoming packets.", SimulateConditionsCommand);
+	DeveloperConsole::RegisterCommands("NetworkThread", "Moves socket I/O, acks and resends onto a dedicated thread. Takes 1 to start or 0 to stop the thread.", NetworkThreadCommand);
+	DeveloperConsole::RegisterCommands("NetLoopbackBenchmark", "Measures batched packet throughput over loopback. Takes the number of packets and batch size as optional arguments.", NetLoopbackBenchmarkCommand);
+	DeveloperConsole::RegisterCommands("NetReliabilityBenchmark", "Pushes reliable traffic between two local connections under simulated loss. Takes the number of packets and loss percentage as optional arguments.", NetReliabilityBenchmarkCommand);
+	DeveloperConsole::RegisterCommands("NetSimulationBenchmark", "Runs headless client connections over the seeded network simulator on a virtual clock. Takes the number of clients, seconds, loss percentage, lag and seed as optional arguments.", NetSimulationBenchmarkCommand);
+	DeveloperConsole::RegisterCommands("NetSoakTest", "Joins simulated clients to the hosted Net Session over loopback. Takes the number of clients and duration in seconds as optional arguments.", NetSoakTestCommand);
+	DeveloperConsole::RegisterCommands("NetBitPacking", "Compares byte packed and bit packed entity snapshots. Takes the number of entities as an optional argument.", NetBitPackingCommand);
+	DeveloperConsole::RegisterCommands("NetReplicationStats", "Lists acked baselines and the latest snapshot size for every connection.", NetReplicationStatsCommand);
 
 	RegisterMessage(NET_MESSAGE_PING, NMC_CONNECTIONLESS, NMO_UNRELIABLE, OnPingReceived);
 	RegisterMessage(NET_MESSAGE_PONG, NMC_CONNECTIONLESS, NMO_UNRELIABLE, OnPongReceived);
@@ -45,12 +65,38 @@ m_HostListening(false)
 	RegisterMessage(NET_MESSAGE_JOIN_DENY, NMC_CONNECTIONLESS, NMO_UNRELIABLE, OnJoinDenied);
 	RegisterMessage(NET_MESSAGE_JOIN_ACCEPT, NMC_CONNECTED, NMO_RELIABLE | NMO_SEQUENCED, OnJoinAccepted);
 	RegisterMessage(NET_MESSAGE_LEAVE, NMC_CONNECTED, NMO_UNRELIABLE, OnSessionLeft);
+	RegisterMessage(NET_MESSAGE_SNAPSHOT, NMC_CONNECTED, NMO_UNRELIABLE, OnSnapshotReceived);
+	RegisterMessage(NET_MESSAGE_FRAGMENT, NMC_CONNECTED, NMO_RELIABLE, OnFragmentReceived);
 }
 
 
 
 NetSession::~NetSession()
 {
+	StopNetworkThread();
+	delete m_ReplicationSystem;
+
+	for (NetConnection* currentConnection : m_AllConnections)
+	{
+		if (currentConnection == m_LocalConnection)
+		{
+			m_LocalConnection = nullptr;
+		}
+
+		NetConnection::DestroyNetConnection(currentConnection);
+	}
+
+	m_AllConnections.clear();
+	NetConnection::DestroyNetConnection(m_LocalConnection);
+
+	ReceivedNetMessage* receivedMessage = nullptr;
+	while (m_InboundMessages.Dequeue(receivedMessage))
+	{
+		m_ReceivedMessagePool.DeallocateObjectToPool(receivedMessage);
+	}
+
+	m_ReceivedMessagePool.UninitializeObjectPool();
+
 	if (IsSessionRunning())
 	{
 		PacketChannel::DestroyPacketChannel(m_PacketChannel);
@@ -105,21 +151,72 @@ void NetSession::StartSessionOnPort(const char* servicePort)
 
 void NetSession::Update()
 {
+	MEMORY_SCOPE("Networking");
+
+	std::lock_guard<std::recursive_mutex> sessionLock(m_SessionLock);
+
+	double updateStartTime = GetCurrentTimeInMilliseconds();
+
 	if (IsSessionRunning())
 	{
 		m_ElapsedTimeSinceLastSent += Clock::MasterClock()->GetDeltaTimeFloat();
 		m_ElapsedTimeSinceLastReceived += Clock::MasterClock()->GetDeltaTimeFloat();
 		
-		ProcessIncomingPackets();
+		if (!IsNetworkThreadRunning())
+		{
+			ProcessIncomingPackets();
+		}
 	}
 
+	DispatchReceivedMessages();
 	UpdateAllSessionStates();
+
+	m_LastUpdateTimeInMilliseconds = GetCurrentTimeInMilliseconds() - updateStartTime;
+}
+
+
+
+void NetSession::UpdateNetworkThread()
+{
+	MEMORY_SCOPE("Networking");
+
+	if (!IsSessionRunning())
+	{
+		return;
+	}
+
+	m_PacketChannel->ReceiveBatchOnPacketChannel();
+	UpdateConnectionsOnNetworkThread();
+	m_PacketChannel->FlushOutboundPackets();
+}
+
+
+
+void NetSession::UpdateConnectionsOnNetworkThread()
+{
+	std::lock_guard<std::recursive_mutex> sessionLock(m_SessionLock);
+
+	DrainOutboundMessages();
+	ReceiveOnNetworkThread();
+
+	double currentTime = GetNetworkTimeInSeconds();
+	if (currentTime - m_LastNetworkSendTime >= UPDATE_RATE)
+	{
+		if (IsCurrentState(UNCONNECTED_STATE) || IsCurrentState(CONNECTED_STATE) || IsCurrentState(JOINING_STATE))
+		{
+			SendPacketsToAllConnections();
+		}
+
+		m_LastNetworkSendTime = currentTime;
+	}
 }
 
 
 
 void NetSession::RenderDebugDisplay(const Vector2& viewDimensions, const class ProportionalFont* displayFont)
 {
+	std::lock_guard<std::recursive_mutex> sessionLock(m_SessionLock);
+
 	g_BasicRenderer->SetOrthographicProjection(Vector2::ZERO, viewDimensions);
 	g_BasicRenderer->EnableDepthTesting(false);
 
@@ -172,10 +269,14 @@ void NetSession::RenderDebugDisplay(const Vector2& viewDimensions, const class P
 
 	if (IsSessionRunning())
 	{
-		g_BasicRenderer->Draw2DProportionalText(lineMinimums, Stringf("Current artificial lag: %.2f~%.2f", m_PacketChannel->m_MinimumLag, m_PacketChannel->m_MaximumLag), cellHeight, displayFont);
+		g_BasicRenderer->Draw2DProportionalText(lineMinimums, Stringf("Current artificial lag: %.2f~%.2f", m_PacketChannel->m_Simulator.m_Settings.m_MinimumLag, m_PacketChannel->m_Simulator.m_Settings.m_MaximumLag), cellHeight, displayFont);
+		lineMinimums.Y -= cellHeight;
+
+		g_BasicRenderer->Draw2DProportionalText(lineMinimums, Stringf("Current artificial drop percentage: %.2f%%", m_PacketChannel->m_Simulator.m_Settings.m_DropPercentage * 100.0), cellHeight, displayFont);
 		lineMinimums.Y -= cellHeight;
 
-		g_BasicRenderer->Draw2DProportionalText(lineMinimums, Stringf("Current artificial drop percentage: %.2f%%", m_PacketChannel->m_DropPercentage * 100.0), cellHeight, displayFont);
+		const NetSimulationStatistics& simulationStatistics = m_PacketChannel->m_Simulator.m_Statistics;
+		g_BasicRenderer->Draw2DProportionalText(lineMinimums, Stringf("Simulated: %u dropped, %u duplicated, %u reordered, %u queued", simulationStatistics.m_NumberOfPacketsDropped, simulationStatistics.m_NumberOfPacketsDuplicated, simulationStatistics.m_NumberOfPacketsReordered, m_PacketChannel->m_Simulator.GetNumberOfQueuedPackets()), cellHeight, displayFont);
 		lineMinimums.Y -= cellHeight;
 
 		lineMinimums.Y -= cellHeight;
@@ -207,7 +308,8 @@ void NetSession::RenderDebugDisplay(const Vector2& viewDimensions, const class P
 		const char* connectionAddressString = NetworkSystem::SingletonInstance()->GetSocketAddressAsString((sockaddr*)&currentConnection->m_Address);
 		connectionString += Stringf(" (%s), Index: %u, ", connectionAddressString, currentConnection->m_ConnectionIndex);
 
-		connectionString += Stringf("Last Sent Ack: %u, Last Received Ack: %u(%u)", currentConnection->m_NextSentAck, currentConnection->m_HighestReceivedAck, currentConnection->m_PreviousReceivedAcks);
+		connectionString += Stringf("Last Sent Ack: %u, Last Received Ack: %u(%u), ", currentConnection->m_NextSentAck, currentConnection->m_HighestReceivedAck, currentConnection->m_PreviousReceivedAcks);
+		connectionString += Stringf("RTT: %.0fms, RTO: %ums, Window: %.1f, Rate: %.0f/s, Lost: %u", currentConnection->m_SmoothedRoundTripTime, currentConnection->m_RetransmissionTimeout, currentConnection->m_CongestionWindow, 1.0 / currentConnection->GetSendInterval(), currentConnection->m_NumberOfPacketsLost);
 
 		g_BasicRenderer->Draw2DProportionalText(lineMinimums, connectionString, cellHeight, displayFont);
 		lineMinimums.Y -= cellHeight;
@@ -218,6 +320,8 @@ void NetSession::RenderDebugDisplay(const Vector2& viewDimensions, const class P
 
 bool NetSession::HostSession(const char* globalUniqueID)
 {
+	std::lock_guard<std::recursive_mutex> sessionLock(m_SessionLock);
+
 	if (IsCurrentState(HOSTING_STATE))
 	{
 		m_HostConnection = CreateConnection(HOST_CONNECTION_INDEX, globalUniqueID, GetSessionAddress());
@@ -230,7 +334,7 @@ bool NetSession::HostSession(const char* globalUniqueID)
 				m_HostListening = true;
 			}
 
-			m_AllConnections.push_back(m_HostConnection);
+			AddConnectionToSession(m_HostConnection);
 			m_OnConnectionJoined.TriggerEvent(m_HostConnection);
 			SetCurrentState(CONNECTED_STATE);
 
@@ -247,6 +351,8 @@ bool NetSession::HostSession(const char* globalUniqueID)
 
 void NetSession::JoinSession(const char* globalUniqueID, const sockaddr_in& hostAddress)
 {
+	std::lock_guard<std::recursive_mutex> sessionLock(m_SessionLock);
+
 	if (!IsCurrentState(JOINING_STATE))
 	{
 		return;
@@ -265,7 +371,7 @@ void NetSession::JoinSession(const char* globalUniqueID, const sockaddr_in& host
 	m_HostConnection = CreateConnection(HOST_CONNECTION_INDEX, "", hostAddress);
 	if (m_HostConnection != nullptr)
 	{
-		m_AllConnections.push_back(m_HostConnection);
+		AddConnectionToSession(m_HostConnection);
 	}
 
 	NetMessage joinRequest(NET_MESSAGE_JOIN_REQUEST);
@@ -278,6 +384,8 @@ void NetSession::JoinSession(const char* globalUniqueID, const sockaddr_in& host
 
 void NetSession::LeaveSession()
 {
+	std::lock_guard<std::recursive_mutex> sessionLock(m_SessionLock);
+
 	FlushToAllConnections();
 	DisconnectConnection(m_LocalConnection);
 	SetCurrentState(UNCONNECTED_STATE);
@@ -285,17 +393,17 @@ void NetSession::LeaveSession()
 
 
 
-bool NetSession::ConnectConnection(NetConnection* newConnection, uint8_t connectionIndex)
+bool NetSession::ConnectConnection(NetConnection* newConnection, uint16_t connectionIndex)
 {
 	ASSERT_OR_DIE(!newConnection->IsConnectionConnected(), "Connection is already connected.");
 
-	if (GetConnectionAtIndex(connectionIndex) != nullptr)
+	if ((connectionIndex >= MAXIMUM_NUMBER_OF_CONNECTIONS) || (GetConnectionAtIndex(connectionIndex) != nullptr))
 	{
 		return false;
 	}
 
 	newConnection->m_ConnectionIndex = connectionIndex;
-	m_AllConnections.push_back(newConnection);
+	AddConnectionToSession(newConnection);
 
 	if (IsOwnConnectionConnected())
 	{
@@ -328,12 +436,14 @@ bool NetSession::ConnectConnection(NetConnection* newConnection, uint8_t connect
 
 void NetSession::DisconnectConnection(NetConnection* correspondingConnection)
 {
+	std::lock_guard<std::recursive_mutex> sessionLock(m_SessionLock);
+
 	if ((correspondingConnection == nullptr) || !correspondingConnection->IsConnectionConnected())
 	{
 		return;
 	}
 
-	uint8_t connectionIndex = correspondingConnection->m_ConnectionIndex;
+	uint16_t connectionIndex = correspondingConnection->m_ConnectionIndex;
 	ASSERT_OR_DIE(GetConnectionAtIndex(connectionIndex) == correspondingConnection, "Connection does not exist in the list.");
 
 	if (!IsOwnConnectionConnected())
@@ -368,7 +478,7 @@ void NetSession::DisconnectConnection(NetConnection* correspondingConnection)
 
 	if (correspondingConnection->IsOwnConnection() && (m_HostConnection != nullptr) && !correspondingConnection->IsHostConnection())
 	{
-		uint8_t hostConnectionIndex = m_HostConnection->m_ConnectionIndex;
+		uint16_t hostConnectionIndex = m_HostConnection->m_ConnectionIndex;
 		DeleteConnection(hostConnectionIndex);
 		m_OnConnectionLeft.TriggerEvent(m_HostConnection);
 		FinalizeDisconnection(m_HostConnection);
@@ -389,14 +499,27 @@ void NetSession::FlushToAllConnections()
 		if (!currentConnection->IsOwnConnection())
 		{
 			currentConnection->AddMessageToSendQueue(leaveMessage);
+		}
+	}
+
+	DrainOutboundMessages();
+	for (NetConnection* currentConnection : m_AllConnections)
+	{
+		if (!currentConnection->IsOwnConnection())
+		{
 			currentConnection->SendPacketToMyConnection();
 		}
 	}
+
+	if (IsSessionRunning())
+	{
+		m_PacketChannel->FlushOutboundPackets();
+	}
 }
 
 
 
-NetConnection* NetSession::CreateConnection(uint8_t connectionIndex, const char* globalUniqueID, const sockaddr_in& connectionAddress)
+NetConnection* NetSession::CreateConnection(uint16_t connectionIndex, const char* globalUniqueID, const sockaddr_in& connectionAddress)
 {
 	if (GetConnectionAtIndex(connectionIndex) != nullptr || GetConnectionWithName(globalUniqueID) != nullptr)
 	{
@@ -410,7 +533,7 @@ NetConnection* NetSession::CreateConnection(uint8_t connectionIndex, const char*
 
 
 
-void NetSession::DeleteConnection(uint8_t connectionIndex)
+void NetSession::DeleteConnection(uint16_t connectionIndex)
 {
 	NetConnection* destroyableConnection = GetConnectionAtIndex(connectionIndex);
 	if (destroyableConnection == nullptr)
@@ -418,17 +541,7 @@ void NetSession::DeleteConnection(uint8_t connectionIndex)
 		return;
 	}
 
-	for (auto connectionIterator = m_AllConnections.begin(); connectionIterator != m_AllConnections.end();)
-	{
-		NetConnection* currentConnection = *connectionIterator;
-		if (currentConnection == destroyableConnection)
-		{
-			m_AllConnections.erase(connectionIterator);
-			break;
-		}
-
-		++connectionIterator;
-	}
+	RemoveConnectionFromSession(destroyableConnection);
 }
 
 
@@ -498,13 +611,74 @@ void NetSession::SendToHostConnection(NetMessage& currentMessage)
 
 void NetSession::SendToAllConnections(NetMessage& currentMessage)
 {
+	currentMessage.m_MessageDefinition = FindMessageDefinition(currentMessage.m_MessageID);
+	SharedNetPayload* sharedPayload = m_OutgoingArena.SerializeMessage(currentMessage);
+
 	for (NetConnection* currentConnection : m_AllConnections)
 	{
 		if (!currentConnection->IsOwnConnection() || currentConnection->IsHostConnection())
 		{
-			currentConnection->AddMessageToSendQueue(currentMessage);
+			currentConnection->AddPayloadToSendQueue(sharedPayload);
 		}
 	}
+
+	NetMessageArena::ReleasePayload(sharedPayload);
+}
+
+
+
+bool NetSession::StartNetworkThread()
+{
+	if (IsNetworkThreadRunning() || !IsSessionRunning())
+	{
+		return false;
+	}
+
+	m_LastNetworkSendTime = GetNetworkTimeInSeconds();
+	m_NetworkThreadIsRunning = true;
+	m_NetworkThread = Thread::CreateNewThread(NetworkSessionThread, this);
+
+	return true;
+}
+
+
+
+void NetSession::StopNetworkThread()
+{
+	if (!IsNetworkThreadRunning())
+	{
+		return;
+	}
+
+	m_NetworkThreadIsRunning = false;
+	m_NetworkThread->JoinThread();
+	Thread::DestroyThread(m_NetworkThread);
+
+	std::lock_guard<std::recursive_mutex> sessionLock(m_SessionLock);
+	DrainOutboundMessages();
+}
+
+
+
+bool NetSession::IsNetworkThreadRunning() const
+{
+	return m_NetworkThreadIsRunning;
+}
+
+
+
+void NetSession::EnqueueOutboundMessage(uint16_t connectionIndex, const OutgoingNetMessage& outgoingMessage)
+{
+	OutboundNetMessage outboundMessage;
+	outboundMessage.m_Message = outgoingMessage;
+	outboundMessage.m_ConnectionIndex = connectionIndex;
+
+	if (!m_OutboundMessages.Enqueue(outboundMessage))
+	{
+		std::lock_guard<std::recursive_mutex> sessionLock(m_SessionLock);
+		DrainOutboundMessages();
+		m_OutboundMessages.Enqueue(outboundMessage);
+	}
 }
 
 
@@ -574,14 +748,14 @@ NetConnection* NetSession::GetLocalConnection() const
 
 
 
-uint8_t NetSession::GetHostConnectionIndex() const
+uint16_t NetSession::GetHostConnectionIndex() const
 {
 	return GetHostConnection()->m_ConnectionIndex;
 }
 
 
 
-uint8_t NetSession::GetLocalConnectionIndex() const
+uint16_t NetSession::GetLocalConnectionIndex() const
 {
 	return GetLocalConnection()->m_ConnectionIndex;
 }
@@ -638,29 +812,24 @@ bool NetSession::IsCurrentState(const NetSessionState& currentState) const
 
 
 
-NetConnection* NetSession::GetConnectionAtIndex(uint8_t connectionIndex) const
+NetConnection* NetSession::GetConnectionAtIndex(uint16_t connectionIndex) const
 {
-	for (NetConnection* currentConnection : m_AllConnections)
+	if (connectionIndex >= MAXIMUM_NUMBER_OF_CONNECTIONS)
 	{
-		if (currentConnection->m_ConnectionIndex == connectionIndex)
-		{
-			return currentConnection;
-		}
+		return nullptr;
 	}
 
-	return nullptr;
+	return m_ConnectionsByIndex[connectionIndex];
 }
 
 
 
 NetConnection* NetSession::GetConnectionWithName(const char* globalUniqueID) const
 {
-	for (NetConnection* currentConnection : m_AllConnections)
+	auto connectionIterator = m_ConnectionsByName.find(globalUniqueID);
+	if (connectionIterator != m_ConnectionsByName.end())
 	{
-		if (strcmp(currentConnection->m_GlobalUniqueID, globalUniqueID) == 0)
-		{
-			return currentConnection;
-		}
+		return connectionIterator->second;
 	}
 
 	return nullptr;
@@ -670,12 +839,10 @@ NetConnection* NetSession::GetConnectionWithName(const char* globalUniqueID) con
 
 NetConnection* NetSession::GetConnectionFromAddress(const sockaddr_in& connectionAddress) const
 {
-	for (NetConnection* currentConnection : m_AllConnections)
+	auto connectionIterator = m_ConnectionsByAddress.find(GetAddressLookupKey(connectionAddress));
+	if (connectionIterator != m_ConnectionsByAddress.end())
 	{
-		if (NetworkSystem::SingletonInstance()->AreAddressesSame(currentConnection->m_Address, connectionAddress))
-		{
-			return currentConnection;
-		}
+		return connectionIterator->second;
 	}
 
 	return nullptr;
@@ -683,6 +850,24 @@ NetConnection* NetSession::GetConnectionFromAddress(const sockaddr_in& connectio
 
 
 
+void NetSession::UpdateConnectionInfo(NetConnection* currentConnection, const NetConnectionInfo& currentConnectionInfo)
+{
+	bool isInSession = (GetConnectionAtIndex(currentConnection->m_ConnectionIndex) == currentConnection);
+	if (isInSession)
+	{
+		RemoveConnectionFromSession(currentConnection);
+	}
+
+	currentConnection->UpdateConnectionInfo(currentConnectionInfo);
+
+	if (isInSession)
+	{
+		AddConnectionToSession(currentConnection);
+	}
+}
+
+
+
 NetMessageDefinition* NetSession::FindMessageDefinition(uint8_t messageID)
 {
 	NetMessageDefinition& messageDefinition = m_AllMessageDefinitions[messageID];
@@ -707,7 +892,7 @@ void NetSession::AddMessageDefinition(uint8_t messageID, const NetMessageDefinit
 
 void NetSession::WriteConnectionInfo(NetMessage& currentMessage, const NetConnectionInfo& currentConnectionInfo)
 {
-	currentMessage.Write<uint8_t>(currentConnectionInfo.m_ConnectionIndex);
+	currentMessage.Write<uint16_t>(currentConnectionInfo.m_ConnectionIndex);
 	currentMessage.Write<USHORT>(currentConnectionInfo.m_Address.sin_port);
 	currentMessage.Write<ULONG>(currentConnectionInfo.m_Address.sin_addr.S_un.S_addr);
 	currentMessage.WriteString(currentConnectionInfo.m_GlobalUniqueID);
@@ -717,7 +902,7 @@ void NetSession::WriteConnectionInfo(NetMessage& currentMessage, const NetConnec
 
 void NetSession::ReadConnectionInfo(const NetMessage& currentMessage, NetConnectionInfo& currentConnectionInfo)
 {
-	currentMessage.Read<uint8_t>(&currentConnectionInfo.m_ConnectionIndex);
+	currentMessage.Read<uint16_t>(&currentConnectionInfo.m_ConnectionIndex);
 	currentMessage.Read<USHORT>(&currentConnectionInfo.m_Address.sin_port);
 	currentMessage.Read<ULONG>(&currentConnectionInfo.m_Address.sin_addr.S_un.S_addr);
 	CopyString(currentConnectionInfo.m_GlobalUniqueID, currentMessage.ReadString(), MAXIMUM_GUID_LENGTH);
@@ -802,12 +987,14 @@ void NetSession::SendDenyMessage(uint8_t errorCode, const sockaddr_in& toAddress
 
 NetConnection* NetSession::AddNewConnection(const char* globalUniqueID, const sockaddr_in& connectionAddress)
 {
-	uint8_t connectionIndex = HOST_CONNECTION_INDEX;
+	uint16_t connectionIndex = HOST_CONNECTION_INDEX;
 	while (GetConnectionAtIndex(connectionIndex) != nullptr)
 	{
 		++connectionIndex;
 	}
 
+	ASSERT_OR_DIE(connectionIndex < MAXIMUM_NUMBER_OF_CONNECTIONS, "No free connection index.");
+
 	NetConnection* newConnection = CreateConnection(INVALID_CONNNECTION_INDEX, globalUniqueID, connectionAddress);
 	ConnectConnection(newConnection, connectionIndex);
 
@@ -823,8 +1010,11 @@ void NetSession::ProcessIncomingPackets()
 	NetSender fromSender;
 	fromSender.m_Session = this;
 
+	m_PacketChannel->ReceiveBatchOnPacketChannel();
 	while (ReadNextPacketFromSocket(receivedPacket, fromSender.m_Address))
 	{
+		fromSender.m_ReceivedTime = GetNetworkTimeInMilliseconds();
+
 		PacketHeader packetHeader;
 		ProcessPacketHeader(packetHeader, receivedPacket, fromSender);
 
@@ -838,7 +1028,7 @@ void NetSession::ProcessIncomingPackets()
 			ProcessNextMessageFromPacket(receivedPacket, currentMessage, fromSender);
 		}
 
-		if (fromSender.m_Connection != nullptr)
+		if ((fromSender.m_Connection != nullptr) && (fromSender.m_Connection == GetConnectionFromAddress(fromSender.m_Address)))
 		{
 			fromSender.m_Connection->MarkPacketReceived(packetHeader);
 		}
@@ -879,15 +1069,24 @@ void NetSession::UpdateAllConnections()
 	m_ElapsedTime += Clock::MasterClock()->GetDeltaTimeFloat();
 	if (m_ElapsedTime >= UPDATE_RATE)
 	{
+		double currentTime = GetNetworkTimeInSeconds();
 		for (NetConnection* currentConnection : m_AllConnections)
 		{
-			if(!currentConnection->IsOwnConnection() || currentConnection->IsHostConnection())
+			if ((!currentConnection->IsOwnConnection() || currentConnection->IsHostConnection()) && currentConnection->IsReadyToSend(currentTime))
 			{
 				m_OnConnectionUpdated.TriggerEvent(currentConnection);
-				currentConnection->SendPacketToMyConnection();
+				if (!IsNetworkThreadRunning())
+				{
+					currentConnection->SendPacketToMyConnection();
+				}
 			}
 		}
 
+		if (IsSessionRunning() && !IsNetworkThreadRunning())
+		{
+			m_PacketChannel->FlushOutboundPackets();
+		}
+
 		m_ElapsedTime = 0.0f;
 	}
 }
@@ -946,7 +1145,10 @@ void NetSession::ProcessNextMessageFromPacket(NetPacket& receivedPacket, NetMess
 	{
 		if (fromSender.m_Connection != nullptr)
 		{
-			fromSender.m_Connection->ProcessMessage(fromSender, currentMessage);
+			if (fromSender.m_Connection->MarkMessageReceived(currentMessage))
+			{
+				fromSender.m_Connection->ProcessMessage(fromSender, currentMessage);
+			}
 		}
 		else
 		{
@@ -954,14 +1156,15 @@ void NetSession::ProcessNextMessageFromPacket(NetPacket& receivedPacket, NetMess
 			if (currentMessage.IsReliable())
 			{
 				fromSender.m_Connection = GetConnectionFromAddress(fromSender.m_Address);
+				if (fromSender.m_Connection != nullptr)
+				{
+					fromSender.m_Connection->MarkMessageReceived(currentMessage);
+				}
 			}
 		}
 
 		if (fromSender.m_Connection != nullptr)
 		{
-
-			fromSender.m_Connection->MarkMessageReceived(currentMessage);
-			
 			if (!fromSender.m_Connection->IsConnectionConfirmed())
 			{
 				fromSender.m_Connection->MarkConnectionConfirmed();
@@ -995,6 +1198,127 @@ bool NetSession::MessageCanBeProcessed(const NetSender& fromSender, const NetMes
 
 
 
+void NetSession::ReceiveOnNetworkThread()
+{
+	NetPacket receivedPacket;
+
+	NetSender fromSender;
+	fromSender.m_Session = this;
+
+	while ((NETWORK_QUEUE_CAPACITY - m_InboundMessages.QueueSize()) >= MAXIMUM_MESSAGES_PER_PACKET && ReadNextPacketFromSocket(receivedPacket, fromSender.m_Address))
+	{
+		fromSender.m_ReceivedTime = GetNetworkTimeInMilliseconds();
+
+		PacketHeader packetHeader;
+		ProcessPacketHeader(packetHeader, receivedPacket, fromSender);
+
+		uint8_t numberOfMessages;
+		receivedPacket.Read<uint8_t>(&numberOfMessages);
+
+		NetMessage currentMessage;
+		while (numberOfMessages > 0)
+		{
+			--numberOfMessages;
+			ProcessNextMessageOnNetworkThread(receivedPacket, currentMessage, fromSender, packetHeader.m_SenderConnectionIndex);
+		}
+
+		if (fromSender.m_Connection != nullptr)
+		{
+			fromSender.m_Connection->MarkPacketReceived(packetHeader);
+		}
+	}
+}
+
+
+
+void NetSession::ProcessNextMessageOnNetworkThread(NetPacket& receivedPacket, NetMessage& currentMessage, NetSender& fromSender, uint16_t senderConnectionIndex)
+{
+	receivedPacket.ReadMessage(&currentMessage);
+	bool messageIsAccepted = MessageCanBeProcessed(fromSender, currentMessage)
+		&& (fromSender.m_Connection == nullptr || fromSender.m_Connection->MarkMessageReceived(currentMessage));
+	if (messageIsAccepted)
+	{
+		ReceivedNetMessage* receivedMessage = m_ReceivedMessagePool.AllocateObjectFromPool();
+		receivedMessage->m_Message = currentMessage;
+		receivedMessage->m_FromAddress = fromSender.m_Address;
+		receivedMessage->m_ReceivedTime = fromSender.m_ReceivedTime;
+		receivedMessage->m_SenderConnectionIndex = senderConnectionIndex;
+		m_InboundMessages.Enqueue(receivedMessage);
+	}
+
+	currentMessage.ResetOffset();
+}
+
+
+
+void NetSession::SendPacketsToAllConnections()
+{
+	double currentTime = GetNetworkTimeInSeconds();
+	for (NetConnection* currentConnection : m_AllConnections)
+	{
+		if ((!currentConnection->IsOwnConnection() || currentConnection->IsHostConnection()) && currentConnection->IsReadyToSend(currentTime))
+		{
+			currentConnection->SendPacketToMyConnection();
+		}
+	}
+}
+
+
+
+void NetSession::DrainOutboundMessages()
+{
+	OutboundNetMessage outboundMessage;
+	while (m_OutboundMessages.Dequeue(outboundMessage))
+	{
+		NetConnection* currentConnection = GetConnectionAtIndex(outboundMessage.m_ConnectionIndex);
+		if (currentConnection != nullptr)
+		{
+			currentConnection->QueueMessageForSending(outboundMessage.m_Message);
+		}
+		else
+		{
+			NetMessageArena::ReleasePayload(outboundMessage.m_Message.m_Payload);
+		}
+	}
+}
+
+
+
+void NetSession::DispatchReceivedMessages()
+{
+	ReceivedNetMessage* receivedMessage = nullptr;
+	while (m_InboundMessages.Dequeue(receivedMessage))
+	{
+		NetSender fromSender;
+		fromSender.m_Session = this;
+		fromSender.m_Connection = GetConnectionAtIndex(receivedMessage->m_SenderConnectionIndex);
+		fromSender.m_Address = receivedMessage->m_FromAddress;
+		fromSender.m_ReceivedTime = receivedMessage->m_ReceivedTime;
+
+		const NetMessage& currentMessage = receivedMessage->m_Message;
+		if (fromSender.m_Connection != nullptr)
+		{
+			fromSender.m_Connection->ProcessMessage(fromSender, currentMessage);
+		}
+		else if (!currentMessage.RequiresConnection())
+		{
+			currentMessage.ProcessMessage(fromSender);
+			if (currentMessage.IsReliable())
+			{
+				NetConnection* newConnection = GetConnectionFromAddress(fromSender.m_Address);
+				if (newConnection != nullptr)
+				{
+					newConnection->MarkMessageReceived(currentMessage);
+				}
+			}
+		}
+
+		m_ReceivedMessagePool.DeallocateObjectToPool(receivedMessage);
+	}
+}
+
+
+
 bool NetSession::IsOwnConnectionConnected() const
 {
 	if (m_LocalConnection != nullptr)
@@ -1018,6 +1342,59 @@ void NetSession::FinalizeDisconnection(NetConnection*& currentConnection)
 
 
 
+void NetSession::AddConnectionToSession(NetConnection* currentConnection)
+{
+	m_AllConnections.push_back(currentConnection);
+
+	if (currentConnection->m_ConnectionIndex < MAXIMUM_NUMBER_OF_CONNECTIONS)
+	{
+		m_ConnectionsByIndex[currentConnection->m_ConnectionIndex] = currentConnection;
+	}
+
+	m_ConnectionsByAddress.emplace(GetAddressLookupKey(currentConnection->m_Address), currentConnection);
+	m_ConnectionsByName.emplace(currentConnection->m_GlobalUniqueID, currentConnection);
+}
+
+
+
+void NetSession::RemoveConnectionFromSession(NetConnection* currentConnection)
+{
+	for (auto connectionIterator = m_AllConnections.begin(); connectionIterator != m_AllConnections.end(); ++connectionIterator)
+	{
+		if (*connectionIterator == currentConnection)
+		{
+			m_AllConnections.erase(connectionIterator);
+			break;
+		}
+	}
+
+	if (GetConnectionAtIndex(currentConnection->m_ConnectionIndex) == currentConnection)
+	{
+		m_ConnectionsByIndex[currentConnection->m_ConnectionIndex] = nullptr;
+	}
+
+	auto addressIterator = m_ConnectionsByAddress.find(GetAddressLookupKey(currentConnection->m_Address));
+	if ((addressIterator != m_ConnectionsByAddress.end()) && (addressIterator->second == currentConnection))
+	{
+		m_ConnectionsByAddress.erase(addressIterator);
+	}
+
+	auto nameIterator = m_ConnectionsByName.find(currentConnection->m_GlobalUniqueID);
+	if ((nameIterator != m_ConnectionsByName.end()) && (nameIterator->second == currentConnection))
+	{
+		m_ConnectionsByName.erase(nameIterator);
+	}
+}
+
+
+
+uint64_t NetSession::GetAddressLookupKey(const sockaddr_in& connectionAddress)
+{
+	return ((static_cast<uint64_t>(connectionAddress.sin_addr.S_un.S_addr) << 16) | static_cast<uint64_t>(connectionAddress.sin_port));
+}
+
+
+
 void OnPingReceived(const NetSender& pingSender, const NetMessage& pingMessage)
 {
 	const char* messageString = pingMessage.ReadString();
@@ -1072,7 +1449,12 @@ void OnJoinRequested(const NetSender& requestSender, const NetMessage& requestMe
 		return;
 	}
 
-	currentSession->AddNewConnection(globalUniqueID, requestSender.m_Address);
+	NetConnection* newConnection = currentSession->AddNewConnection(globalUniqueID, requestSender.m_Address);
+
+	NetMessage acceptMessage(NET_MESSAGE_JOIN_ACCEPT);
+	currentSession->WriteConnectionInfo(acceptMessage, currentSession->GetHostConnection()->GetConnectionInfo());
+	currentSession->WriteConnectionInfo(acceptMessage, newConnection->GetConnectionInfo());
+	newConnection->AddMessageToSendQueue(acceptMessage);
 }
 
 
@@ -1110,7 +1492,7 @@ void OnJoinAccepted(const NetSender& acceptSender, const NetMessage& acceptMessa
 	currentSession->ReadConnectionInfo(acceptMessage, localConnectionInfo);
 
 	NetConnection* hostConnection = currentSession->GetHostConnection();
-	hostConnection->UpdateConnectionInfo(hostConnectionInfo);
+	currentSession->UpdateConnectionInfo(hostConnection, hostConnectionInfo);
 
 	NetConnection* localConnection = currentSession->GetLocalConnection();
 	if (currentSession->ConnectConnection(localConnection, localConnectionInfo.m_ConnectionIndex))
@@ -1229,6 +1611,7 @@ void StopSessionCommand(Command& currentCommand)
 	{
 		if (NetSession::LocalNetSession()->IsSessionRunning() && NetSession::LocalNetSession()->IsCurrentState(UNCONNECTED_STATE))
 		{
+			NetSession::LocalNetSession()->StopNetworkThread();
 			PacketChannel::DestroyPacketChannel(NetSession::LocalNetSession()->m_PacketChannel);
 			if (!NetSession::LocalNetSession()->IsSessionRunning())
 			{
@@ -1474,10 +1857,10 @@ void ListConnectionsCommand(Command& currentCommand)
 			for (NetConnection* currentConnection : NetSession::LocalNetSession()->m_AllConnections)
 			{
 				const char* connectionAddress = NetworkSystem::SingletonInstance()->GetSocketAddressAsString((sockaddr*)&currentConnection->m_Address);
-				uint8_t connectionIndex = currentConnection->m_ConnectionIndex;
+				uint16_t connectionIndex = currentConnection->m_ConnectionIndex;
 				const char* connectionID = currentConnection->m_GlobalUniqueID;
 
-				ConsoleLine connectionMessage = ConsoleLine(Stringf("Connection: %u %s %s", connectionIndex, connectionID, connectionAddress), RGBA::YELLOW);
+				ConsoleLine connectionMessage = ConsoleLine(Stringf("Connection: %u %s %s RTT: %.0fms RTO: %ums Window: %.1f Rate: %.0f/s Lost: %u", connectionIndex, connectionID, connectionAddress, currentConnection->m_SmoothedRoundTripTime, currentConnection->m_RetransmissionTimeout, currentConnection->m_CongestionWindow, 1.0 / currentConnection->GetSendInterval(), currentConnection->m_NumberOfPacketsLost), RGBA::YELLOW);
 				DeveloperConsole::AddNewConsoleLine(connectionMessage);
 			}
 
@@ -1536,8 +1919,8 @@ void SimulateLagCommand(Command& currentCommand)
 				if (currentCommandArguments.size() == 1)
 				{
 					double lagAmount = stod(currentCommandArguments[0]);
-					NetSession::LocalNetSession()->m_PacketChannel->m_MinimumLag = lagAmount;
-					NetSession::LocalNetSession()->m_PacketChannel->m_MaximumLag = lagAmount;
+					NetSession::LocalNetSession()->m_PacketChannel->m_Simulator.m_Settings.m_MinimumLag = lagAmount;
+					NetSession::LocalNetSession()->m_PacketChannel->m_Simulator.m_Settings.m_MaximumLag = lagAmount;
 
 					lagMessage = ConsoleLine("Lag set to constant amount.", RGBA::GREEN);
 				}
@@ -1546,8 +1929,8 @@ void SimulateLagCommand(Command& currentCommand)
 					double lagMinimum = stod(currentCommandArguments[0]);
 					double lagMaximum = stod(currentCommandArguments[1]);
 
-					NetSession::LocalNetSession()->m_PacketChannel->m_MinimumLag = lagMinimum;
-					NetSession::LocalNetSession()->m_PacketChannel->m_MaximumLag = lagMaximum;
+					NetSession::LocalNetSession()->m_PacketChannel->m_Simulator.m_Settings.m_MinimumLag = lagMinimum;
+					NetSession::LocalNetSession()->m_PacketChannel->m_Simulator.m_Settings.m_MaximumLag = lagMaximum;
 
 					lagMessage = ConsoleLine("Lag set to range.", RGBA::GREEN);
 				}
@@ -1593,7 +1976,7 @@ void SimulateLossCommand(Command& currentCommand)
 			else
 			{
 				float lossPercentage = stof(currentCommandArguments[0]) * 0.01f;
-				NetSession::LocalNetSession()->m_PacketChannel->m_DropPercentage = lossPercentage;
+				NetSession::LocalNetSession()->m_PacketChannel->m_Simulator.m_Settings.m_DropPercentage = lossPercentage;
 
 				lossMessage = ConsoleLine("Loss percentage set.", RGBA::GREEN);
 			}
@@ -1605,4 +1988,93 @@ void SimulateLossCommand(Command& currentCommand)
 	}
 
 	DeveloperConsole::AddNewConsoleLine(lossMessage);
+}
+
+
+
+void SimulateConditionsCommand(Command& currentCommand)
+{
+	ConsoleLine conditionsMessage;
+
+	std::vector<std::string> currentCommandArguments;
+	currentCommand.GetCommandArguments(currentCommandArguments);
+
+	if (!NetSession::LocalNetSession()->IsSessionRunning())
+	{
+		conditionsMessage = ConsoleLine("Cannot run command. No session is currently running.", RGBA::RED);
+	}
+	else if (currentCommandArguments.size() < 1 || currentCommandArguments.size() > 4)
+	{
+		conditionsMessage = ConsoleLine("SimulateNetConditions takes the duplicate percentage, and optionally the reorder percentage, bandwidth in bytes per second and seed.", RGBA::RED);
+	}
+	else
+	{
+		NetSimulator& packetSimulator = NetSession::LocalNetSession()->m_PacketChannel->m_Simulator;
+		packetSimulator.m_Settings.m_DuplicatePercentage = stof(currentCommandArguments[0]) * 0.01f;
+
+		if (currentCommandArguments.size() > 1)
+		{
+			packetSimulator.m_Settings.m_ReorderPercentage = stof(currentCommandArguments[1]) * 0.01f;
+		}
+
+		if (currentCommandArguments.size() > 2)
+		{
+			packetSimulator.m_Settings.m_BandwidthBytesPerSecond = static_cast<size_t>(stoul(currentCommandArguments[2]));
+		}
+
+		if (currentCommandArguments.size() > 3)
+		{
+			packetSimulator.SetSeed(static_cast<uint64_t>(stoull(currentCommandArguments[3])));
+		}
+
+		conditionsMessage = ConsoleLine("Network conditions set.", RGBA::GREEN);
+	}
+
+	DeveloperConsole::AddNewConsoleLine(conditionsMessage);
+}
+
+
+
+void NetworkThreadCommand(Command& currentCommand)
+{
+	ConsoleLine threadMessage;
+
+	std::vector<std::string> currentCommandArguments;
+	currentCommand.GetCommandArguments(currentCommandArguments);
+
+	if (currentCommandArguments.size() != 1)
+	{
+		threadMessage = ConsoleLine("NetworkThread takes exactly one argument.", RGBA::RED);
+	}
+	else if (currentCommandArguments[0] == "1")
+	{
+		if (NetSession::LocalNetSession()->StartNetworkThread())
+		{
+			threadMessage = ConsoleLine("Network thread started.", RGBA::GREEN);
+		}
+		else
+		{
+			threadMessage = ConsoleLine("Cannot start network thread. It is already running or no session is running.", RGBA::RED);
+		}
+	}
+	else
+	{
+		NetSession::LocalNetSession()->StopNetworkThread();
+		threadMessage = ConsoleLine("Network thread stopped.", RGBA::GREEN);
+	}
+
+	DeveloperConsole::AddNewConsoleLine(threadMessage);
+}
+
+
+
+void NetworkSessionThread(void* threadArgument)
+{
+	NetSession* currentSession = (NetSession*)threadArgument;
+
+	while (currentSession->IsNetworkThreadRunning())
+	{
+		currentSession->UpdateNetworkThread();
+		Thread::SleepThreadForTime(NETWORK_THREAD_SLEEP_TIME);
+	}
 }
\ No newline at end of file
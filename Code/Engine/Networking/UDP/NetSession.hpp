@@ -1,23 +1,35 @@
 #pragma once
 
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Engine/Networking/UDP/NetConnection.hpp"
 #include "Engine/Networking/UDP/PacketChannel.hpp"
+#include "Engine/DataStructures/ConcurrentObjectPool.hpp"
+#include "Engine/DataStructures/SPSCQueue.hpp"
 #include "Engine/DeveloperConsole/Command.hpp"
 #include "Engine/EventSystem/EventSystem.hpp"
+#include "Engine/Threading/Thread.hpp"
 
 
 
 const size_t NUMBER_OF_MESSAGE_DEFINITIONS = 256;
 const uint16_t STARTING_PORT_NUMBER = 1608;
 const uint16_t PORT_RANGE = 8;
-const uint8_t HOST_CONNECTION_INDEX = 0;
-const size_t MAXIMUM_NUMBER_OF_CONNECTIONS = 8;
+const uint16_t HOST_CONNECTION_INDEX = 0;
+const size_t MAXIMUM_NUMBER_OF_CONNECTIONS = 512;
 
 const float UPDATE_RATE = 1.0f / 120.0f;
 const float TIMEOUT_THRESHOLD = 15.0f;
 
+const size_t NETWORK_QUEUE_CAPACITY = 4096;
+const size_t MAXIMUM_MESSAGES_PER_PACKET = 256;
+const size_t RECEIVED_MESSAGES_PER_POOL_CHUNK = 256;
+const float NETWORK_THREAD_SLEEP_TIME = 0.001f;
+
 
 
 enum NetSessionState
@@ -45,6 +57,24 @@ enum ErrorCode : uint8_t
 
 
 
+struct ReceivedNetMessage
+{
+	NetMessage m_Message;
+	sockaddr_in m_FromAddress;
+	double m_ReceivedTime;
+	uint16_t m_SenderConnectionIndex;
+};
+
+
+
+struct OutboundNetMessage
+{
+	OutgoingNetMessage m_Message;
+	uint16_t m_ConnectionIndex;
+};
+
+
+
 class NetSession
 {
 private:
@@ -60,18 +90,19 @@ public:
 	void StartSessionOnPort(const char* servicePort);
 	
 	void Update();
+	void UpdateNetworkThread();
 	void RenderDebugDisplay(const Vector2& viewDimensions, const class ProportionalFont* displayFont);
 
 	bool HostSession(const char* globalUniqueID);
 	void JoinSession(const char* globalUniqueID, const sockaddr_in& hostAddress);
 	void LeaveSession();
 
-	bool ConnectConnection(NetConnection* newConnection, uint8_t connectionIndex);
+	bool ConnectConnection(NetConnection* newConnection, uint16_t connectionIndex);
 	void DisconnectConnection(NetConnection* correspondingConnection);
 	void FlushToAllConnections();
 
-	NetConnection* CreateConnection(uint8_t connectionIndex, const char* globalUniqueID, const sockaddr_in& connectionAddress);
-	void DeleteConnection(uint8_t connectionIndex);
+	NetConnection* CreateConnection(uint16_t connectionIndex, const char* globalUniqueID, const sockaddr_in& connectionAddress);
+	void DeleteConnection(uint16_t connectionIndex);
 
 	void SendDirectMessage(const sockaddr_in& toAddress, NetMessage& currentMessage);
 	void RegisterMessage(uint8_t messageID, uint8_t controlFlags, uint8_t optionFlags, NetMessageCallBack* messageCallBack);
@@ -79,6 +110,11 @@ public:
 	void SendToHostConnection(NetMessage& currentMessage);
 	void SendToAllConnections(NetMessage& currentMessage);
 
+	bool StartNetworkThread();
+	void StopNetworkThread();
+	bool IsNetworkThreadRunning() const;
+	void EnqueueOutboundMessage(uint16_t connectionIndex, const OutgoingNetMessage& outgoingMessage);
+
 	const sockaddr_in GetSessionAddress() const;
 	const char* GetSessionAddressAsString() const;
 	bool IsSessionRunning() const;
@@ -89,8 +125,8 @@ public:
 	NetConnection* GetHostConnection() const;
 	NetConnection* GetLocalConnection() const;
 
-	uint8_t GetHostConnectionIndex() const;
-	uint8_t GetLocalConnectionIndex() const;
+	uint16_t GetHostConnectionIndex() const;
+	uint16_t GetLocalConnectionIndex() const;
 
 	bool IsOwnConnectionHost() const;
 	bool IsGlobalUniqueIDAvailable(const char* globalUniqueID) const;
@@ -100,9 +136,10 @@ public:
 	NetSessionState GetCurrentState() const;
 	bool IsCurrentState(const NetSessionState& currentState) const;
 
-	NetConnection* GetConnectionAtIndex(uint8_t connectionIndex) const;
+	NetConnection* GetConnectionAtIndex(uint16_t connectionIndex) const;
 	NetConnection* GetConnectionWithName(const char* globalUniqueID) const;
 	NetConnection* GetConnectionFromAddress(const sockaddr_in& connectionAddress) const;
+	void UpdateConnectionInfo(NetConnection* currentConnection, const NetConnectionInfo& currentConnectionInfo);
 
 	NetMessageDefinition* FindMessageDefinition(uint8_t messageID);
 	void AddMessageDefinition(uint8_t messageID, const NetMessageDefinition& messageDefinition);
@@ -128,9 +165,20 @@ private:
 
 	bool MessageCanBeProcessed(const NetSender& fromSender, const NetMessage& currentMessage);
 
+	void UpdateConnectionsOnNetworkThread();
+	void ReceiveOnNetworkThread();
+	void ProcessNextMessageOnNetworkThread(NetPacket& receivedPacket, NetMessage& currentMessage, NetSender& fromSender, uint16_t senderConnectionIndex);
+	void SendPacketsToAllConnections();
+	void DrainOutboundMessages();
+	void DispatchReceivedMessages();
+
 	bool IsOwnConnectionConnected() const;
 	void FinalizeDisconnection(NetConnection*& currentConnection);
 
+	void AddConnectionToSession(NetConnection* currentConnection);
+	void RemoveConnectionFromSession(NetConnection* currentConnection);
+	static uint64_t GetAddressLookupKey(const sockaddr_in& connectionAddress);
+
 private:
 	NetConnection* m_HostConnection;
 	NetConnection* m_LocalConnection;
@@ -138,8 +186,12 @@ private:
 public:
 	PacketChannel* m_PacketChannel;
 	NetMessageDefinition m_AllMessageDefinitions[NUMBER_OF_MESSAGE_DEFINITIONS];
+	NetMessageArena m_OutgoingArena;
 
 	std::vector<NetConnection*> m_AllConnections;
+	NetConnection* m_ConnectionsByIndex[MAXIMUM_NUMBER_OF_CONNECTIONS];
+	std::unordered_map<uint64_t, NetConnection*> m_ConnectionsByAddress;
+	std::unordered_map<std::string, NetConnection*> m_ConnectionsByName;
 
 	NetSessionState m_CurrentState;
 	
@@ -155,6 +207,19 @@ public:
 	EventSystem<NetConnection*> m_OnConnectionJoined;
 	EventSystem<NetConnection*> m_OnConnectionLeft;
 	EventSystem<NetConnection*> m_OnConnectionUpdated;
+	EventSystem<NetConnection*, uint16_t> m_OnAckTagConfirmed;
+
+	class NetReplicationSystem* m_ReplicationSystem;
+
+	Thread* m_NetworkThread;
+	std::atomic<bool> m_NetworkThreadIsRunning;
+	std::recursive_mutex m_SessionLock;
+	double m_LastNetworkSendTime;
+	double m_LastUpdateTimeInMilliseconds;
+
+	SPSC_Queue<ReceivedNetMessage*, NETWORK_QUEUE_CAPACITY> m_InboundMessages;
+	SPSC_Queue<OutboundNetMessage, NETWORK_QUEUE_CAPACITY> m_OutboundMessages;
+	ConcurrentObjectPool<ReceivedNetMessage> m_ReceivedMessagePool;
 };
 
 void OnPingReceived(const NetSender& pingSender, const NetMessage& pingMessage);
@@ -176,4 +241,8 @@ void LeaveSessionCommand(Command& currentCommand);
 void ListConnectionsCommand(Command& currentCommand);
 
 void SimulateLagCommand(Command& currentCommand);
-void SimulateLossCommand(Command& currentCommand);
\ No newline at end of file
+void SimulateLossCommand(Command& currentCommand);
+void SimulateConditionsCommand(Command& currentCommand);
+void NetworkThreadCommand(Command& currentCommand);
+
+void NetworkSessionThread(void* threadArgument);
\ No newline at end of file
@@ -0,0 +1,294 @@
+#include "Engine/Networking/UDP/NetSimulator.hpp"
+#include "Engine/Time/Time.hpp"
+
+#include <string.h>
+#include <atomic>
+
+
+
+const double MAXIMUM_LINK_QUEUE_DELAY = 1000.0;
+
+std::atomic<bool> g_IsVirtualNetworkClockEnabled(false);
+double g_VirtualNetworkTime = 0.0;
+
+
+
+double GetNetworkTimeInMilliseconds()
+{
+	if (g_IsVirtualNetworkClockEnabled)
+	{
+		return g_VirtualNetworkTime;
+	}
+
+	return GetCurrentTimeInMilliseconds();
+}
+
+
+
+double GetNetworkTimeInSeconds()
+{
+	return GetNetworkTimeInMilliseconds() / 1000.0;
+}
+
+
+
+void EnableVirtualNetworkClock(double startTimeInMilliseconds)
+{
+	g_VirtualNetworkTime = startTimeInMilliseconds;
+	g_IsVirtualNetworkClockEnabled = true;
+}
+
+
+
+void DisableVirtualNetworkClock()
+{
+	g_IsVirtualNetworkClockEnabled = false;
+}
+
+
+
+void AdvanceVirtualNetworkClock(double deltaTimeInMilliseconds)
+{
+	g_VirtualNetworkTime += deltaTimeInMilliseconds;
+}
+
+
+
+bool IsVirtualNetworkClockEnabled()
+{
+	return g_IsVirtualNetworkClockEnabled;
+}
+
+
+
+NetSimulationRandom::NetSimulationRandom(uint64_t randomSeed /*= 0U*/)
+{
+	SetSeed(randomSeed);
+}
+
+
+
+void NetSimulationRandom::SetSeed(uint64_t randomSeed)
+{
+	m_State = randomSeed ^ 0x9E3779B97F4A7C15ULL;
+	if (m_State == 0U)
+	{
+		m_State = 0x9E3779B97F4A7C15ULL;
+	}
+}
+
+
+
+uint32_t NetSimulationRandom::GetNextInteger()
+{
+	m_State ^= m_State >> 12;
+	m_State ^= m_State << 25;
+	m_State ^= m_State >> 27;
+
+	return static_cast<uint32_t>((m_State * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+
+
+float NetSimulationRandom::GetNextFloat()
+{
+	return static_cast<float>(GetNextInteger() >> 8) / static_cast<float>(1U << 24);
+}
+
+
+
+double NetSimulationRandom::GetDoubleWithinRange(double rangeMinimum, double rangeMaximum)
+{
+	double unitValue = static_cast<double>(GetNextInteger()) / 4294967296.0;
+	return rangeMinimum + ((rangeMaximum - rangeMinimum) * unitValue);
+}
+
+
+
+NetSimulationSettings::NetSimulationSettings() :
+m_DropPercentage(0.0f),
+m_DuplicatePercentage(0.0f),
+m_ReorderPercentage(0.0f),
+m_MinimumLag(0.0),
+m_MaximumLag(0.0),
+m_ReorderDelay(DEFAULT_REORDER_DELAY),
+m_BandwidthBytesPerSecond(0U)
+{
+
+}
+
+
+
+bool NetSimulationSettings::IsSimulating() const
+{
+	return (m_DropPercentage > 0.0f || m_DuplicatePercentage > 0.0f || m_ReorderPercentage > 0.0f || m_MaximumLag > 0.0 || m_BandwidthBytesPerSecond > 0U);
+}
+
+
+
+bool CompareSimulatedPacketReleases::operator()(const SimulatedPacketRelease& firstRelease, const SimulatedPacketRelease& secondRelease) const
+{
+	if (firstRelease.m_ReleaseTime != secondRelease.m_ReleaseTime)
+	{
+		return (firstRelease.m_ReleaseTime > secondRelease.m_ReleaseTime);
+	}
+
+	return (firstRelease.m_SubmitOrder > secondRelease.m_SubmitOrder);
+}
+
+
+
+NetSimulator::NetSimulator(uint64_t randomSeed /*= 0U*/) :
+m_Random(randomSeed),
+m_LinkAvailableTime(0.0),
+m_NextSubmitOrder(0U)
+{
+	memset(&m_Statistics, 0, sizeof(m_Statistics));
+}
+
+
+
+void NetSimulator::SetSeed(uint64_t randomSeed)
+{
+	m_Random.SetSeed(randomSeed);
+}
+
+
+
+void NetSimulator::Reset()
+{
+	while (!m_ReleaseQueue.empty())
+	{
+		m_FreePacketIndices.push_back(m_ReleaseQueue.top().m_PacketIndex);
+		m_ReleaseQueue.pop();
+	}
+
+	memset(&m_Statistics, 0, sizeof(m_Statistics));
+	m_LinkAvailableTime = 0.0;
+	m_NextSubmitOrder = 0U;
+}
+
+
+
+size_t NetSimulator::SubmitPacket(const void* packetData, size_t dataSize, const sockaddr_in& fromAddress)
+{
+	++m_Statistics.m_NumberOfPacketsSubmitted;
+
+	if (m_Settings.m_DropPercentage > 0.0f && m_Random.GetNextFloat() < m_Settings.m_DropPercentage)
+	{
+		++m_Statistics.m_NumberOfPacketsDropped;
+		return 0U;
+	}
+
+	double currentTime = GetNetworkTimeInMilliseconds();
+	double transmitTime = currentTime;
+	if (m_Settings.m_BandwidthBytesPerSecond > 0U)
+	{
+		double linkStartTime = (m_LinkAvailableTime > currentTime) ? m_LinkAvailableTime : currentTime;
+		if (linkStartTime - currentTime > MAXIMUM_LINK_QUEUE_DELAY)
+		{
+			++m_Statistics.m_NumberOfPacketsOverflowed;
+			return 0U;
+		}
+
+		transmitTime = linkStartTime + (static_cast<double>(dataSize) * 1000.0 / static_cast<double>(m_Settings.m_BandwidthBytesPerSecond));
+		m_LinkAvailableTime = transmitTime;
+	}
+
+	size_t numberOfCopies = 1U;
+	if (m_Settings.m_DuplicatePercentage > 0.0f && m_Random.GetNextFloat() < m_Settings.m_DuplicatePercentage)
+	{
+		++m_Statistics.m_NumberOfPacketsDuplicated;
+		++numberOfCopies;
+	}
+
+	size_t numberOfScheduledPackets = 0U;
+	for (size_t copyIndex = 0; copyIndex < numberOfCopies; ++copyIndex)
+	{
+		double releaseTime = transmitTime + m_Random.GetDoubleWithinRange(m_Settings.m_MinimumLag, m_Settings.m_MaximumLag);
+		if (m_Settings.m_ReorderPercentage > 0.0f && m_Random.GetNextFloat() < m_Settings.m_ReorderPercentage)
+		{
+			++m_Statistics.m_NumberOfPacketsReordered;
+			releaseTime += m_Settings.m_ReorderDelay;
+		}
+
+		if (SchedulePacket(packetData, dataSize, fromAddress, releaseTime))
+		{
+			++numberOfScheduledPackets;
+		}
+	}
+
+	return numberOfScheduledPackets;
+}
+
+
+
+size_t NetSimulator::ReleasePacket(void* dataBuffer, size_t bufferSize, sockaddr_in* fromAddress)
+{
+	if (m_ReleaseQueue.empty() || m_ReleaseQueue.top().m_ReleaseTime > GetNetworkTimeInMilliseconds())
+	{
+		return 0U;
+	}
+
+	uint32_t packetIndex = m_ReleaseQueue.top().m_PacketIndex;
+	m_ReleaseQueue.pop();
+
+	const SimulatedPacket& releasedPacket = m_PacketPool[packetIndex];
+	size_t dataSize = (releasedPacket.m_DataSize > bufferSize) ? bufferSize : releasedPacket.m_DataSize;
+	memcpy(dataBuffer, releasedPacket.m_Buffer, dataSize);
+	*fromAddress = releasedPacket.m_Address;
+
+	m_FreePacketIndices.push_back(packetIndex);
+	++m_Statistics.m_NumberOfPacketsReleased;
+
+	return dataSize;
+}
+
+
+
+bool NetSimulator::HasQueuedPackets() const
+{
+	return !m_ReleaseQueue.empty();
+}
+
+
+
+size_t NetSimulator::GetNumberOfQueuedPackets() const
+{
+	return m_ReleaseQueue.size();
+}
+
+
+
+bool NetSimulator::SchedulePacket(const void* packetData, size_t dataSize, const sockaddr_in& fromAddress, double releaseTime)
+{
+	uint32_t packetIndex = 0U;
+	if (!m_FreePacketIndices.empty())
+	{
+		packetIndex = m_FreePacketIndices.back();
+		m_FreePacketIndices.pop_back();
+	}
+	else if (m_PacketPool.size() < SIMULATED_PACKET_CAPACITY)
+	{
+		packetIndex = static_cast<uint32_t>(m_PacketPool.size());
+		m_PacketPool.emplace_back();
+	}
+	else
+	{
+		++m_Statistics.m_NumberOfPacketsOverflowed;
+		return false;
+	}
+
+	SimulatedPacket& scheduledPacket = m_PacketPool[packetIndex];
+	scheduledPacket.m_Address = fromAddress;
+	scheduledPacket.m_DataSize = (dataSize > PACKET_MTU) ? PACKET_MTU : dataSize;
+	memcpy(scheduledPacket.m_Buffer, packetData, scheduledPacket.m_DataSize);
+
+	SimulatedPacketRelease packetRelease;
+	packetRelease.m_ReleaseTime = releaseTime;
+	packetRelease.m_SubmitOrder = m_NextSubmitOrder++;
+	packetRelease.m_PacketIndex = packetIndex;
+	m_ReleaseQueue.push(packetRelease);
+
+	return true;
+}
\ No newline at end of file
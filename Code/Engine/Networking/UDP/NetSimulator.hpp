@@ -0,0 +1,126 @@
+#pragma once
+
+#include <WinSock2.h>
+#include <queue>
+#include <stdint.h>
+#include <vector>
+
+#include "Engine/Networking/UDP/NetPacket.hpp"
+
+
+
+const size_t SIMULATED_PACKET_CAPACITY = 4096;
+const double DEFAULT_REORDER_DELAY = 20.0;
+
+
+
+double GetNetworkTimeInMilliseconds();
+double GetNetworkTimeInSeconds();
+
+void EnableVirtualNetworkClock(double startTimeInMilliseconds);
+void DisableVirtualNetworkClock();
+void AdvanceVirtualNetworkClock(double deltaTimeInMilliseconds);
+bool IsVirtualNetworkClockEnabled();
+
+
+
+class NetSimulationRandom
+{
+public:
+	NetSimulationRandom(uint64_t randomSeed = 0U);
+
+	void SetSeed(uint64_t randomSeed);
+	uint32_t GetNextInteger();
+	float GetNextFloat();
+	double GetDoubleWithinRange(double rangeMinimum, double rangeMaximum);
+
+private:
+	uint64_t m_State;
+};
+
+
+
+struct NetSimulationSettings
+{
+	NetSimulationSettings();
+
+	bool IsSimulating() const;
+
+	float m_DropPercentage;
+	float m_DuplicatePercentage;
+	float m_ReorderPercentage;
+	double m_MinimumLag;
+	double m_MaximumLag;
+	double m_ReorderDelay;
+	size_t m_BandwidthBytesPerSecond;
+};
+
+
+
+struct SimulatedPacket
+{
+	sockaddr_in m_Address;
+	size_t m_DataSize;
+	unsigned char m_Buffer[PACKET_MTU];
+};
+
+
+
+struct SimulatedPacketRelease
+{
+	double m_ReleaseTime;
+	uint64_t m_SubmitOrder;
+	uint32_t m_PacketIndex;
+};
+
+
+
+struct CompareSimulatedPacketReleases
+{
+	bool operator()(const SimulatedPacketRelease& firstRelease, const SimulatedPacketRelease& secondRelease) const;
+};
+
+
+
+struct NetSimulationStatistics
+{
+	size_t m_NumberOfPacketsSubmitted;
+	size_t m_NumberOfPacketsReleased;
+	size_t m_NumberOfPacketsDropped;
+	size_t m_NumberOfPacketsDuplicated;
+	size_t m_NumberOfPacketsReordered;
+	size_t m_NumberOfPacketsOverflowed;
+};
+
+
+
+class NetSimulator
+{
+public:
+	NetSimulator(uint64_t randomSeed = 0U);
+
+	void SetSeed(uint64_t randomSeed);
+	void Reset();
+
+	size_t SubmitPacket(const void* packetData, size_t dataSize, const sockaddr_in& fromAddress);
+	size_t ReleasePacket(void* dataBuffer, size_t bufferSize, sockaddr_in* fromAddress);
+
+	bool HasQueuedPackets() const;
+	size_t GetNumberOfQueuedPackets() const;
+
+private:
+	bool SchedulePacket(const void* packetData, size_t dataSize, const sockaddr_in& fromAddress, double releaseTime);
+
+public:
+	NetSimulationSettings m_Settings;
+	NetSimulationStatistics m_Statistics;
+
+private:
+	NetSimulationRandom m_Random;
+	std::vector<SimulatedPacket> m_PacketPool;
+	std::vector<uint32_t> m_FreePacketIndices;
+	std::priority_queue<SimulatedPacketRelease, std::vector<SimulatedPacketRelease>, CompareSimulatedPacketReleases> m_ReleaseQueue;
+
+	double m_LinkAvailableTime;
+	uint64_t m_NextSubmitOrder;
+};
\ No newline at end of file
@@ -0,0 +1,365 @@
+#include "Engine/Networking/UDP/NetSoakTest.hpp"
+#include "Engine/Networking/UDP/NetSession.hpp"
+#include "Engine/Networking/NetworkSystem.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+#include "Engine/ErrorHandling/StringUtils.hpp"
+#include "Engine/Time/Time.hpp"
+
+
+
+NetSoakTest* g_NetSoakTest = nullptr;
+bool g_IsSoakTestRegistered = false;
+
+
+
+NetSoakTest::NetSoakTest(size_t numberOfClients, float durationInSeconds) :
+m_NumberOfConnectionsBeforeSoak(0U),
+m_PeakNumberOfConnections(0U),
+m_StartTime(GetCurrentTimeInSeconds()),
+m_EndTime(m_StartTime + static_cast<double>(durationInSeconds)),
+m_LastSendTime(0.0),
+m_NumberOfUpdates(0U),
+m_TotalUpdateTimeInMilliseconds(0.0),
+m_LongestUpdateTimeInMilliseconds(0.0)
+{
+	m_SoakClients.reserve(numberOfClients);
+
+	for (size_t clientIndex = 0; clientIndex < numberOfClients; ++clientIndex)
+	{
+		SoakClient newClient;
+		memset(&newClient, 0, sizeof(newClient));
+
+		newClient.m_UDPSocket = UDPSocket::CreateAndBindUDPSocket(NetworkSystem::SingletonInstance()->GetLocalHostName(), "0");
+		if (!newClient.m_UDPSocket->IsBound())
+		{
+			UDPSocket::UnbindAndDestroyUDPSocket(newClient.m_UDPSocket);
+			continue;
+		}
+
+		CopyString(newClient.m_GlobalUniqueID, Stringf("SoakClient%u", clientIndex).c_str(), MAXIMUM_GUID_LENGTH);
+		newClient.m_ConnectionIndex = INVALID_CONNNECTION_INDEX;
+		newClient.m_HighestReceivedAck = INVALID_PACKET_ACK;
+		newClient.m_LastJoinRequestTime = -static_cast<double>(SOAK_JOIN_RESEND_INTERVAL);
+
+		m_SoakClients.push_back(newClient);
+	}
+
+	m_NumberOfConnectionsBeforeSoak = NetSession::LocalNetSession()->m_AllConnections.size();
+	m_PeakNumberOfConnections = m_NumberOfConnectionsBeforeSoak;
+}
+
+
+
+NetSoakTest::~NetSoakTest()
+{
+	for (SoakClient& currentClient : m_SoakClients)
+	{
+		UDPSocket::UnbindAndDestroyUDPSocket(currentClient.m_UDPSocket);
+	}
+}
+
+
+
+bool NetSoakTest::StartSoakTest(size_t numberOfClients, float durationInSeconds)
+{
+	if (IsSoakTestRunning())
+	{
+		return false;
+	}
+
+	if (!g_IsSoakTestRegistered)
+	{
+		NetworkSystem::SingletonInstance()->m_OnUpdate.RegisterFunction(NetSoakTest::UpdateSoakTest);
+		g_IsSoakTestRegistered = true;
+	}
+
+	g_NetSoakTest = new NetSoakTest(numberOfClients, durationInSeconds);
+
+	return true;
+}
+
+
+
+bool NetSoakTest::IsSoakTestRunning()
+{
+	return (g_NetSoakTest != nullptr);
+}
+
+
+
+void NetSoakTest::UpdateSoakTest()
+{
+	if (g_NetSoakTest != nullptr)
+	{
+		if (!g_NetSoakTest->Update())
+		{
+			g_NetSoakTest->FinishSoakTest();
+
+			delete g_NetSoakTest;
+			g_NetSoakTest = nullptr;
+		}
+	}
+}
+
+
+
+bool NetSoakTest::Update()
+{
+	NetSession* currentSession = NetSession::LocalNetSession();
+	std::lock_guard<std::recursive_mutex> sessionLock(currentSession->m_SessionLock);
+
+	if (!currentSession->IsOwnConnectionHost())
+	{
+		return false;
+	}
+
+	double currentTime = GetCurrentTimeInSeconds();
+	bool sendThisUpdate = ((currentTime - m_LastSendTime) >= static_cast<double>(UPDATE_RATE));
+	sockaddr_in hostAddress = currentSession->GetSessionAddress();
+
+	for (SoakClient& currentClient : m_SoakClients)
+	{
+		ReceiveOnSoakClient(currentClient);
+
+		if (sendThisUpdate)
+		{
+			SendFromSoakClient(currentClient, hostAddress);
+		}
+	}
+
+	if (sendThisUpdate)
+	{
+		m_LastSendTime = currentTime;
+	}
+
+	if (currentSession->m_AllConnections.size() > m_PeakNumberOfConnections)
+	{
+		m_PeakNumberOfConnections = currentSession->m_AllConnections.size();
+	}
+
+	double updateTime = currentSession->m_LastUpdateTimeInMilliseconds;
+	m_TotalUpdateTimeInMilliseconds += updateTime;
+	if (updateTime > m_LongestUpdateTimeInMilliseconds)
+	{
+		m_LongestUpdateTimeInMilliseconds = updateTime;
+	}
+	++m_NumberOfUpdates;
+
+	return (currentTime < m_EndTime);
+}
+
+
+
+void NetSoakTest::FinishSoakTest()
+{
+	NetSession* currentSession = NetSession::LocalNetSession();
+	double elapsedTime = GetCurrentTimeInSeconds() - m_StartTime;
+
+	size_t numberOfJoinedClients = 0U;
+	size_t numberOfPacketsSent = 0U;
+	size_t numberOfPacketsReceived = 0U;
+
+	for (SoakClient& currentClient : m_SoakClients)
+	{
+		numberOfPacketsSent += currentClient.m_NumberOfPacketsSent;
+		numberOfPacketsReceived += currentClient.m_NumberOfPacketsReceived;
+
+		if (currentClient.m_ConnectionIndex != INVALID_CONNNECTION_INDEX)
+		{
+			++numberOfJoinedClients;
+
+			PacketHeader packetHeader;
+			packetHeader.m_SenderConnectionIndex = currentClient.m_ConnectionIndex;
+			packetHeader.m_PacketAck = INVALID_PACKET_ACK;
+			packetHeader.m_MostRecentAck = currentClient.m_HighestReceivedAck;
+			packetHeader.m_PreviouslyReceivedAcksBitfield = currentClient.m_PreviousReceivedAcks;
+
+			NetPacket leavePacket;
+			leavePacket.WritePacketHeader(packetHeader);
+			leavePacket.Write<uint8_t>(1U);
+
+			NetMessage leaveMessage(NET_MESSAGE_LEAVE);
+			leaveMessage.m_MessageDefinition = currentSession->FindMessageDefinition(leaveMessage.m_MessageID);
+			leavePacket.WriteMessage(&leaveMessage);
+
+			currentClient.m_UDPSocket->SendToAddressOnSocket(leavePacket.m_Buffer, leavePacket.GetTotalReadableSize(), currentSession->GetSessionAddress());
+		}
+	}
+
+	double averageUpdateTime = m_TotalUpdateTimeInMilliseconds / static_cast<double>((m_NumberOfUpdates > 0) ? m_NumberOfUpdates : 1);
+	double packetsPerSecond = (elapsedTime > 0.0) ? (static_cast<double>(numberOfPacketsSent + numberOfPacketsReceived) / elapsedTime) : 0.0;
+
+	RGBA resultColor = (numberOfJoinedClients == m_SoakClients.size()) ? RGBA::GREEN : RGBA::RED;
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Soak clients: %u of %u joined, peak of %u session connections.", numberOfJoinedClients, m_SoakClients.size(), m_PeakNumberOfConnections), resultColor));
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Packets: %u sent, %u received by clients (%.0f packets per second).", numberOfPacketsSent, numberOfPacketsReceived, packetsPerSecond), RGBA::GREEN));
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Session update: %.3f ms average, %.3f ms longest over %.2f seconds.", averageUpdateTime, m_LongestUpdateTimeInMilliseconds, elapsedTime), RGBA::GREEN));
+}
+
+
+
+void NetSoakTest::ReceiveOnSoakClient(SoakClient& soakClient)
+{
+	NetPacket receivedPacket;
+	sockaddr_in fromAddress;
+
+	size_t receivedSize = soakClient.m_UDPSocket->ReceiveFromAddressOnSocket(receivedPacket.m_Buffer, PACKET_MTU, &fromAddress);
+	while (receivedSize > 0)
+	{
+		receivedPacket.SetReadableSize(receivedSize);
+		receivedPacket.ResetOffset();
+
+		PacketHeader packetHeader;
+		receivedPacket.ReadPacketHeader(packetHeader);
+		if (packetHeader.m_PacketAck != INVALID_PACKET_ACK)
+		{
+			AckPacketOnSoakClient(soakClient, packetHeader.m_PacketAck);
+		}
+
+		uint8_t numberOfMessages;
+		receivedPacket.Read<uint8_t>(&numberOfMessages);
+
+		while (numberOfMessages > 0)
+		{
+			--numberOfMessages;
+
+			NetMessage currentMessage;
+			receivedPacket.ReadMessage(&currentMessage);
+			if ((currentMessage.m_MessageID == NET_MESSAGE_JOIN_ACCEPT) && (soakClient.m_ConnectionIndex == INVALID_CONNNECTION_INDEX))
+			{
+				NetConnectionInfo hostConnectionInfo;
+				NetConnectionInfo localConnectionInfo;
+				NetSession::LocalNetSession()->ReadConnectionInfo(currentMessage, hostConnectionInfo);
+				NetSession::LocalNetSession()->ReadConnectionInfo(currentMessage, localConnectionInfo);
+
+				soakClient.m_ConnectionIndex = localConnectionInfo.m_ConnectionIndex;
+			}
+		}
+
+		++soakClient.m_NumberOfPacketsReceived;
+		receivedSize = soakClient.m_UDPSocket->ReceiveFromAddressOnSocket(receivedPacket.m_Buffer, PACKET_MTU, &fromAddress);
+	}
+}
+
+
+
+void NetSoakTest::SendFromSoakClient(SoakClient& soakClient, const sockaddr_in& hostAddress)
+{
+	NetSession* currentSession = NetSession::LocalNetSession();
+	bool isJoined = (soakClient.m_ConnectionIndex != INVALID_CONNNECTION_INDEX);
+
+	double currentTime = GetCurrentTimeInSeconds();
+	if (!isJoined && (currentTime - soakClient.m_LastJoinRequestTime) < static_cast<double>(SOAK_JOIN_RESEND_INTERVAL))
+	{
+		return;
+	}
+
+	PacketHeader packetHeader;
+	packetHeader.m_SenderConnectionIndex = soakClient.m_ConnectionIndex;
+	packetHeader.m_PacketAck = soakClient.m_NextSentAck;
+	packetHeader.m_MostRecentAck = soakClient.m_HighestReceivedAck;
+	packetHeader.m_PreviouslyReceivedAcksBitfield = soakClient.m_PreviousReceivedAcks;
+
+	++soakClient.m_NextSentAck;
+	if (soakClient.m_NextSentAck == INVALID_PACKET_ACK)
+	{
+		++soakClient.m_NextSentAck;
+	}
+
+	NetPacket packetToSend;
+	packetToSend.WritePacketHeader(packetHeader);
+	packetToSend.Write<uint8_t>(1U);
+
+	if (isJoined)
+	{
+		NetMessage heartbeatMessage(NET_MESSAGE_PONG);
+		heartbeatMessage.m_MessageDefinition = currentSession->FindMessageDefinition(heartbeatMessage.m_MessageID);
+		packetToSend.WriteMessage(&heartbeatMessage);
+	}
+	else
+	{
+		NetMessage joinRequest(NET_MESSAGE_JOIN_REQUEST);
+		joinRequest.WriteString(soakClient.m_GlobalUniqueID);
+		joinRequest.m_MessageDefinition = currentSession->FindMessageDefinition(joinRequest.m_MessageID);
+		packetToSend.WriteMessage(&joinRequest);
+
+		soakClient.m_LastJoinRequestTime = currentTime;
+	}
+
+	size_t sentSize = soakClient.m_UDPSocket->SendToAddressOnSocket(packetToSend.m_Buffer, packetToSend.GetTotalReadableSize(), hostAddress);
+	if (sentSize > 0)
+	{
+		++soakClient.m_NumberOfPacketsSent;
+	}
+}
+
+
+
+void NetSoakTest::AckPacketOnSoakClient(SoakClient& soakClient, uint16_t packetAck)
+{
+	const uint16_t HALF_RANGE = 0x7FFF;
+	const uint16_t BITFIELD_SIZE = sizeof(soakClient.m_PreviousReceivedAcks) * 8U;
+
+	uint16_t distanceAhead = packetAck - soakClient.m_HighestReceivedAck;
+	if ((distanceAhead > 0) && (distanceAhead <= HALF_RANGE))
+	{
+		uint32_t shiftedAcks = (distanceAhead > BITFIELD_SIZE) ? 0U : ((static_cast<uint32_t>(soakClient.m_PreviousReceivedAcks) << distanceAhead) | (1U << (distanceAhead - 1)));
+		soakClient.m_PreviousReceivedAcks = static_cast<uint16_t>(shiftedAcks);
+		soakClient.m_HighestReceivedAck = packetAck;
+	}
+	else
+	{
+		uint16_t distanceBehind = soakClient.m_HighestReceivedAck - packetAck;
+		if ((distanceBehind > 0) && (distanceBehind <= BITFIELD_SIZE))
+		{
+			soakClient.m_PreviousReceivedAcks |= static_cast<uint16_t>(1U << (distanceBehind - 1));
+		}
+	}
+}
+
+
+
+void NetSoakTestCommand(Command& currentCommand)
+{
+	size_t numberOfClients = DEFAULT_NUMBER_OF_SOAK_CLIENTS;
+	float durationInSeconds = DEFAULT_SOAK_DURATION;
+
+	std::vector<std::string> currentCommandArguments;
+	currentCommand.GetCommandArguments(currentCommandArguments);
+
+	if (currentCommandArguments.size() > 2)
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("Too many arguments. NetSoakTest takes the number of clients and duration in seconds as optional arguments.", RGBA::RED));
+		return;
+	}
+
+	if (currentCommandArguments.size() > 0)
+	{
+		numberOfClients = static_cast<size_t>(stoul(currentCommandArguments[0]));
+	}
+
+	if (currentCommandArguments.size() > 1)
+	{
+		durationInSeconds = stof(currentCommandArguments[1]);
+	}
+
+	NetSession* currentSession = NetSession::LocalNetSession();
+	if (!currentSession->IsOwnConnectionHost() || !currentSession->IsHostListening())
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("Cannot run soak test. Host a listening Net Session first.", RGBA::RED));
+		return;
+	}
+
+	if ((currentSession->m_AllConnections.size() + numberOfClients) > MAXIMUM_NUMBER_OF_CONNECTIONS)
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Cannot run soak test. The session only has room for %u more connections.", MAXIMUM_NUMBER_OF_CONNECTIONS - currentSession->m_AllConnections.size()), RGBA::RED));
+		return;
+	}
+
+	if (!NetSoakTest::StartSoakTest(numberOfClients, durationInSeconds))
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("A soak test is already running.", RGBA::RED));
+		return;
+	}
+
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Soak test started with %u clients for %.1f seconds.", numberOfClients, durationInSeconds), RGBA::GREEN));
+}
\ No newline at end of file
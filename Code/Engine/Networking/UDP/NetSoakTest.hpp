@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+
+#include "Engine/Networking/UDP/NetConnection.hpp"
+#include "Engine/Networking/UDP/UDPSocket.hpp"
+#include "Engine/DeveloperConsole/Command.hpp"
+
+
+
+const size_t DEFAULT_NUMBER_OF_SOAK_CLIENTS = 256;
+const float DEFAULT_SOAK_DURATION = 10.0f;
+const float SOAK_JOIN_RESEND_INTERVAL = 0.25f;
+
+
+
+struct SoakClient
+{
+	UDPSocket* m_UDPSocket;
+	char m_GlobalUniqueID[MAXIMUM_GUID_LENGTH];
+	uint16_t m_ConnectionIndex;
+
+	uint16_t m_NextSentAck;
+	uint16_t m_HighestReceivedAck;
+	uint16_t m_PreviousReceivedAcks;
+	double m_LastJoinRequestTime;
+
+	size_t m_NumberOfPacketsSent;
+	size_t m_NumberOfPacketsReceived;
+};
+
+
+
+class NetSoakTest
+{
+private:
+	NetSoakTest(size_t numberOfClients, float durationInSeconds);
+	~NetSoakTest();
+
+public:
+	static bool StartSoakTest(size_t numberOfClients, float durationInSeconds);
+	static bool IsSoakTestRunning();
+	static void UpdateSoakTest();
+
+private:
+	bool Update();
+	void FinishSoakTest();
+
+	void ReceiveOnSoakClient(SoakClient& soakClient);
+	void SendFromSoakClient(SoakClient& soakClient, const sockaddr_in& hostAddress);
+	void AckPacketOnSoakClient(SoakClient& soakClient, uint16_t packetAck);
+
+public:
+	std::vector<SoakClient> m_SoakClients;
+	size_t m_NumberOfConnectionsBeforeSoak;
+	size_t m_PeakNumberOfConnections;
+
+	double m_StartTime;
+	double m_EndTime;
+	double m_LastSendTime;
+
+	size_t m_NumberOfUpdates;
+	double m_TotalUpdateTimeInMilliseconds;
+	double m_LongestUpdateTimeInMilliseconds;
+};
+
+
+
+void NetSoakTestCommand(Command& currentCommand);
\ No newline at end of file
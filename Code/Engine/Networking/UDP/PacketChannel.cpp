@@ -1,32 +1,40 @@
 #include "Engine/Networking/UDP/PacketChannel.hpp"
 #include "Engine/Math/MathUtilities/MathUtilities.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+#include "Engine/ErrorHandling/StringUtils.hpp"
 #include "Engine/Time/Time.hpp"
 
 
 
-const size_t MAXIMUM_NUMBER_OF_PACKETS = 1024;
-
-
-
 PacketChannel::PacketChannel(const char* hostName, const char* servicePort) :
-m_DropPercentage(0.0f),
-m_MinimumLag(0.0),
-m_MaximumLag(0.0)
+m_InboundReadIndex(0U),
+m_InboundWriteIndex(0U),
+m_NumberOfOutboundPackets(0U)
 {
 	m_UDPSocket = UDPSocket::CreateAndBindUDPSocket(hostName, servicePort);
-	m_PacketPool.InitializeObjectPool(MAXIMUM_NUMBER_OF_PACKETS);
+	m_InboundPacketRing = new InboundPacket[INBOUND_PACKET_RING_SIZE];
+	m_OutboundPackets = new OutboundPacket[MAXIMUM_DATAGRAMS_PER_BATCH];
+
+	for (size_t packetIndex = 0; packetIndex < MAXIMUM_DATAGRAMS_PER_BATCH; ++packetIndex)
+	{
+		m_OutboundDatagrams[packetIndex].m_Buffer = m_OutboundPackets[packetIndex].m_Buffer;
+		m_OutboundDatagrams[packetIndex].m_BufferSize = PACKET_MTU;
+		m_OutboundDatagrams[packetIndex].m_DataSize = 0U;
+	}
 }
 
 
 
 PacketChannel::~PacketChannel()
 {
-	m_PacketPool.UninitializeObjectPool();
-	
 	if (IsChannelActive())
 	{
+		FlushOutboundPackets();
 		UDPSocket::UnbindAndDestroyUDPSocket(m_UDPSocket);
 	}
+
+	delete[] m_OutboundPackets;
+	delete[] m_InboundPacketRing;
 }
 
 
@@ -49,6 +57,60 @@ void PacketChannel::DestroyPacketChannel(PacketChannel*& currentPacketChannel)
 
 
 
+LoopbackBenchmarkResults PacketChannel::RunLoopbackBenchmark(size_t numberOfPackets, size_t batchSize)
+{
+	LoopbackBenchmarkResults benchmarkResults;
+	memset(&benchmarkResults, 0, sizeof(benchmarkResults));
+
+	PacketChannel* sendingChannel = PacketChannel::CreatePacketChannel("127.0.0.1", "0");
+	PacketChannel* receivingChannel = PacketChannel::CreatePacketChannel("127.0.0.1", "0");
+
+	if (sendingChannel->IsChannelActive() && receivingChannel->IsChannelActive())
+	{
+		sockaddr_in receivingAddress;
+		int addressSize = sizeof(receivingAddress);
+		getsockname(receivingChannel->m_UDPSocket->m_Socket, (sockaddr*)&receivingAddress, &addressSize);
+
+		unsigned char packetData[PACKET_MTU];
+		memset(packetData, 0, PACKET_MTU);
+
+		unsigned char receivedData[PACKET_MTU];
+		sockaddr_in fromAddress;
+
+		double startTime = GetCurrentTimeInMilliseconds();
+
+		while (benchmarkResults.m_NumberOfPacketsSent < numberOfPackets)
+		{
+			for (size_t batchIndex = 0; batchIndex < batchSize && benchmarkResults.m_NumberOfPacketsSent < numberOfPackets; ++batchIndex)
+			{
+				*(uint32_t*)packetData = static_cast<uint32_t>(benchmarkResults.m_NumberOfPacketsSent);
+				sendingChannel->QueueToAddressOnPacketChannel(packetData, PACKET_MTU / 4, receivingAddress);
+				++benchmarkResults.m_NumberOfPacketsSent;
+			}
+
+			sendingChannel->FlushOutboundPackets();
+			++benchmarkResults.m_NumberOfSendBatches;
+
+			receivingChannel->ReceiveBatchOnPacketChannel();
+			++benchmarkResults.m_NumberOfReceiveBatches;
+
+			while (receivingChannel->ReceiveFromAddressOnPacketChannel(receivedData, PACKET_MTU, &fromAddress) > 0)
+			{
+				++benchmarkResults.m_NumberOfPacketsReceived;
+			}
+		}
+
+		benchmarkResults.m_ElapsedTimeInMilliseconds = GetCurrentTimeInMilliseconds() - startTime;
+	}
+
+	PacketChannel::DestroyPacketChannel(receivingChannel);
+	PacketChannel::DestroyPacketChannel(sendingChannel);
+
+	return benchmarkResults;
+}
+
+
+
 size_t PacketChannel::SendToAddressOnPacketChannel(const void* sendData, size_t dataSize, const sockaddr_in& toAddress)
 {
 	return m_UDPSocket->SendToAddressOnSocket(sendData, dataSize, toAddress);
@@ -56,48 +118,149 @@ size_t PacketChannel::SendToAddressOnPacketChannel(const void* sendData, size_t
 
 
 
-size_t PacketChannel::ReceiveFromAddressOnPacketChannel(void* dataBuffer, size_t bufferSize, sockaddr_in* fromAddress)
+size_t PacketChannel::QueueToAddressOnPacketChannel(const void* sendData, size_t dataSize, const sockaddr_in& toAddress)
+{
+	NetPacketSlice packetSlice;
+	packetSlice.m_Data = sendData;
+	packetSlice.m_DataSize = dataSize;
+
+	return QueueSlicesToAddressOnPacketChannel(&packetSlice, 1U, toAddress);
+}
+
+
+
+size_t PacketChannel::QueueSlicesToAddressOnPacketChannel(const NetPacketSlice* packetSlices, size_t numberOfSlices, const sockaddr_in& toAddress)
+{
+	size_t dataSize = 0U;
+	for (size_t sliceIndex = 0; sliceIndex < numberOfSlices; ++sliceIndex)
+	{
+		dataSize += packetSlices[sliceIndex].m_DataSize;
+	}
+
+	if (dataSize > PACKET_MTU)
+	{
+		return 0U;
+	}
+
+	if (m_NumberOfOutboundPackets == MAXIMUM_DATAGRAMS_PER_BATCH)
+	{
+		FlushOutboundPackets();
+	}
+
+	UDPDatagram& outboundDatagram = m_OutboundDatagrams[m_NumberOfOutboundPackets];
+	unsigned char* gatherLocation = (unsigned char*)outboundDatagram.m_Buffer;
+	for (size_t sliceIndex = 0; sliceIndex < numberOfSlices; ++sliceIndex)
+	{
+		memcpy(gatherLocation, packetSlices[sliceIndex].m_Data, packetSlices[sliceIndex].m_DataSize);
+		gatherLocation += packetSlices[sliceIndex].m_DataSize;
+	}
+
+	outboundDatagram.m_DataSize = dataSize;
+	outboundDatagram.m_Address = toAddress;
+	++m_NumberOfOutboundPackets;
+
+	return dataSize;
+}
+
+
+
+size_t PacketChannel::FlushOutboundPackets()
 {
-	TimeStampedPacket* currentPacket = m_PacketPool.AllocateObjectFromPool();
-	sockaddr_in sendingAddress;
-	size_t receivedSize = m_UDPSocket->ReceiveFromAddressOnSocket(currentPacket->m_NetPacket.m_Buffer, bufferSize, &sendingAddress);
-	if (receivedSize > 0)
+	if (m_NumberOfOutboundPackets == 0U)
 	{
-		if (GetRandomFloatWithinRange(0.0f, 1.0f) < m_DropPercentage)
+		return 0U;
+	}
+
+	size_t numberOfPacketsSent = m_UDPSocket->SendDatagramsOnSocket(m_OutboundDatagrams, m_NumberOfOutboundPackets);
+	m_NumberOfOutboundPackets = 0U;
+
+	return numberOfPacketsSent;
+}
+
+
+
+size_t PacketChannel::ReceiveBatchOnPacketChannel()
+{
+	UDPDatagram inboundDatagrams[MAXIMUM_DATAGRAMS_PER_BATCH];
+	size_t numberOfPacketsReceived = 0U;
+
+	while (true)
+	{
+		size_t freeSlots = INBOUND_PACKET_RING_SIZE - (m_InboundWriteIndex - m_InboundReadIndex);
+		size_t batchSize = (freeSlots < MAXIMUM_DATAGRAMS_PER_BATCH) ? freeSlots : MAXIMUM_DATAGRAMS_PER_BATCH;
+		if (batchSize == 0U)
 		{
-			m_PacketPool.DeallocateObjectToPool(currentPacket);
+			break;
 		}
-		else
+
+		for (size_t datagramIndex = 0; datagramIndex < batchSize; ++datagramIndex)
 		{
-			double packetDelay = GetRandomDoubleWithinRange(m_MinimumLag, m_MaximumLag);
-			currentPacket->m_NetPacket.SetReadableSize(receivedSize);
-			currentPacket->m_TimeToProcess = GetCurrentTimeInMilliseconds() + packetDelay;
-			currentPacket->m_FromAddress = sendingAddress;
-			m_InboundPackets.push_back(currentPacket);
+			InboundPacket& ringPacket = m_InboundPacketRing[(m_InboundWriteIndex + datagramIndex) % INBOUND_PACKET_RING_SIZE];
+			inboundDatagrams[datagramIndex].m_Buffer = ringPacket.m_NetPacket.m_Buffer;
+			inboundDatagrams[datagramIndex].m_BufferSize = PACKET_MTU;
+		}
+
+		size_t numberOfDatagrams = m_UDPSocket->ReceiveDatagramsFromSocket(inboundDatagrams, batchSize);
+		bool isSimulating = m_Simulator.m_Settings.IsSimulating();
+
+		for (size_t datagramIndex = 0; datagramIndex < numberOfDatagrams; ++datagramIndex)
+		{
+			const UDPDatagram& currentDatagram = inboundDatagrams[datagramIndex];
+			if (isSimulating)
+			{
+				m_Simulator.SubmitPacket(currentDatagram.m_Buffer, currentDatagram.m_DataSize, currentDatagram.m_Address);
+				continue;
+			}
+
+			InboundPacket& ringPacket = m_InboundPacketRing[m_InboundWriteIndex % INBOUND_PACKET_RING_SIZE];
+			if (ringPacket.m_NetPacket.m_Buffer != currentDatagram.m_Buffer)
+			{
+				memcpy(ringPacket.m_NetPacket.m_Buffer, currentDatagram.m_Buffer, currentDatagram.m_DataSize);
+			}
+
+			ringPacket.m_NetPacket.SetReadableSize(currentDatagram.m_DataSize);
+			ringPacket.m_FromAddress = currentDatagram.m_Address;
+			++m_InboundWriteIndex;
+			++numberOfPacketsReceived;
+		}
+
+		if (numberOfDatagrams < batchSize)
+		{
+			break;
 		}
 	}
-	else
+
+	return numberOfPacketsReceived;
+}
+
+
+
+size_t PacketChannel::ReceiveFromAddressOnPacketChannel(void* dataBuffer, size_t bufferSize, sockaddr_in* fromAddress)
+{
+	size_t simulatedSize = m_Simulator.ReleasePacket(dataBuffer, bufferSize, fromAddress);
+	if (simulatedSize > 0U)
 	{
-		m_PacketPool.DeallocateObjectToPool(currentPacket);
+		return simulatedSize;
 	}
 
-	if (m_InboundPackets.size() > 0)
+	if (m_InboundReadIndex == m_InboundWriteIndex)
 	{
-		double currentTime = GetCurrentTimeInMilliseconds();
-		currentPacket = m_InboundPackets[0];
-		if (currentTime >= currentPacket->m_TimeToProcess)
-		{
-			*fromAddress = currentPacket->m_FromAddress;
-			size_t dataSize = currentPacket->m_NetPacket.GetTotalReadableSize();
-			memcpy(dataBuffer, currentPacket->m_NetPacket.m_Buffer, dataSize);
-			m_PacketPool.DeallocateObjectToPool(currentPacket);
-			m_InboundPackets.erase(m_InboundPackets.begin());
+		return 0U;
+	}
 
-			return dataSize;
-		}
+	InboundPacket& currentPacket = m_InboundPacketRing[m_InboundReadIndex % INBOUND_PACKET_RING_SIZE];
+
+	size_t dataSize = currentPacket.m_NetPacket.GetTotalReadableSize();
+	if (dataSize > bufferSize)
+	{
+		dataSize = bufferSize;
 	}
 
-	return 0U;
+	*fromAddress = currentPacket.m_FromAddress;
+	memcpy(dataBuffer, currentPacket.m_NetPacket.m_Buffer, dataSize);
+	++m_InboundReadIndex;
+
+	return dataSize;
 }
 
 
@@ -113,4 +276,44 @@ bool PacketChannel::IsChannelActive() const
 	}
 
 	return false;
+}
+
+
+
+void NetLoopbackBenchmarkCommand(Command& currentCommand)
+{
+	size_t numberOfPackets = 100000;
+	size_t batchSize = MAXIMUM_DATAGRAMS_PER_BATCH;
+
+	std::vector<std::string> currentCommandArguments;
+	currentCommand.GetCommandArguments(currentCommandArguments);
+
+	if (currentCommandArguments.size() > 2)
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("Too many arguments. NetLoopbackBenchmark takes the number of packets and batch size as optional arguments.", RGBA::RED));
+		return;
+	}
+
+	if (currentCommandArguments.size() > 0)
+	{
+		numberOfPackets = static_cast<size_t>(stoul(currentCommandArguments[0]));
+	}
+
+	if (currentCommandArguments.size() > 1)
+	{
+		batchSize = static_cast<size_t>(stoul(currentCommandArguments[1]));
+		batchSize = (batchSize == 0U) ? 1U : batchSize;
+	}
+
+	LoopbackBenchmarkResults benchmarkResults = PacketChannel::RunLoopbackBenchmark(numberOfPackets, batchSize);
+	if (benchmarkResults.m_ElapsedTimeInMilliseconds <= 0.0)
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("Could not bind loopback sockets.", RGBA::RED));
+		return;
+	}
+
+	double packetsPerSecond = static_cast<double>(benchmarkResults.m_NumberOfPacketsReceived) * 1000.0 / benchmarkResults.m_ElapsedTimeInMilliseconds;
+
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Packets: %u sent, %u received in %u send batches.", benchmarkResults.m_NumberOfPacketsSent, benchmarkResults.m_NumberOfPacketsReceived, benchmarkResults.m_NumberOfSendBatches), RGBA::GREEN));
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Elapsed: %.3f ms (%.0f packets per second on one core).", benchmarkResults.m_ElapsedTimeInMilliseconds, packetsPerSecond), RGBA::GREEN));
 }
\ No newline at end of file
@@ -1,22 +1,42 @@
 #pragma once
 
-#include <vector>
-
 #include "Engine/Networking/UDP/NetPacket.hpp"
+#include "Engine/Networking/UDP/NetSimulator.hpp"
 #include "Engine/Networking/UDP/UDPSocket.hpp"
-#include "Engine/DataStructures/ObjectPool.hpp"
+#include "Engine/DeveloperConsole/Command.hpp"
+
+
 
+const size_t INBOUND_PACKET_RING_SIZE = 1024;
 
 
-struct TimeStampedPacket
+
+struct InboundPacket
 {
 	NetPacket m_NetPacket;
-	double m_TimeToProcess;
 	sockaddr_in m_FromAddress;
 };
 
 
 
+struct OutboundPacket
+{
+	unsigned char m_Buffer[PACKET_MTU];
+};
+
+
+
+struct LoopbackBenchmarkResults
+{
+	size_t m_NumberOfPacketsSent;
+	size_t m_NumberOfPacketsReceived;
+	size_t m_NumberOfSendBatches;
+	size_t m_NumberOfReceiveBatches;
+	double m_ElapsedTimeInMilliseconds;
+};
+
+
+
 class PacketChannel
 {
 private:
@@ -26,19 +46,32 @@ private:
 public:
 	static PacketChannel* CreatePacketChannel(const char* hostName, const char* servicePort);
 	static void DestroyPacketChannel(PacketChannel*& currentPacketChannel);
+	static LoopbackBenchmarkResults RunLoopbackBenchmark(size_t numberOfPackets, size_t batchSize);
 
 	size_t SendToAddressOnPacketChannel(const void* sendData, size_t dataSize, const sockaddr_in& toAddress);
-	size_t ReceiveFromAddressOnPacketChannel(void* dataBuffer, size_t bufferSize, sockaddr_in* fromAddress); // TODO: Complete and verify this function.
+	size_t QueueToAddressOnPacketChannel(const void* sendData, size_t dataSize, const sockaddr_in& toAddress);
+	size_t QueueSlicesToAddressOnPacketChannel(const NetPacketSlice* packetSlices, size_t numberOfSlices, const sockaddr_in& toAddress);
+	size_t FlushOutboundPackets();
+
+	size_t ReceiveBatchOnPacketChannel();
+	size_t ReceiveFromAddressOnPacketChannel(void* dataBuffer, size_t bufferSize, sockaddr_in* fromAddress);
 
 	bool IsChannelActive() const;
 
 public:
 	UDPSocket* m_UDPSocket;
 
-	std::vector<TimeStampedPacket*> m_InboundPackets;
-	ObjectPool<TimeStampedPacket> m_PacketPool;
+	InboundPacket* m_InboundPacketRing;
+	size_t m_InboundReadIndex;
+	size_t m_InboundWriteIndex;
+
+	OutboundPacket* m_OutboundPackets;
+	UDPDatagram m_OutboundDatagrams[MAXIMUM_DATAGRAMS_PER_BATCH];
+	size_t m_NumberOfOutboundPackets;
+
+	NetSimulator m_Simulator;
+};
+
+
 
-	float m_DropPercentage;
-	double m_MinimumLag;
-	double m_MaximumLag;
-};
\ No newline at end of file
+void NetLoopbackBenchmarkCommand(Command& currentCommand);
\ No newline at end of file
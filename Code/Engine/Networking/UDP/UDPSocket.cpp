@@ -20,6 +20,10 @@ UDPSocket::UDPSocket(const char* hostName, const char* servicePort)
 			{
 				u_long nonBlocking = 1;
 				ioctlsocket(m_Socket, FIONBIO, &nonBlocking);
+
+				int socketBufferSize = UDP_SOCKET_BUFFER_SIZE;
+				setsockopt(m_Socket, SOL_SOCKET, SO_RCVBUF, (const char*)&socketBufferSize, sizeof(socketBufferSize));
+				setsockopt(m_Socket, SOL_SOCKET, SO_SNDBUF, (const char*)&socketBufferSize, sizeof(socketBufferSize));
 				memcpy_s(&m_Address, sizeof(sockaddr_in), infoListIterator->ai_addr, infoListIterator->ai_addrlen);
 			}
 			else
@@ -101,6 +105,45 @@ size_t UDPSocket::ReceiveFromAddressOnSocket(void* dataBuffer, size_t bufferSize
 
 
 
+size_t UDPSocket::SendDatagramsOnSocket(const UDPDatagram* datagrams, size_t numberOfDatagrams)
+{
+	size_t numberOfDatagramsSent = 0U;
+
+	for (size_t datagramIndex = 0; datagramIndex < numberOfDatagrams; ++datagramIndex)
+	{
+		const UDPDatagram& currentDatagram = datagrams[datagramIndex];
+		if (SendToAddressOnSocket(currentDatagram.m_Buffer, currentDatagram.m_DataSize, currentDatagram.m_Address) > 0)
+		{
+			++numberOfDatagramsSent;
+		}
+	}
+
+	return numberOfDatagramsSent;
+}
+
+
+
+size_t UDPSocket::ReceiveDatagramsFromSocket(UDPDatagram* datagrams, size_t numberOfDatagrams)
+{
+	size_t numberOfDatagramsReceived = 0U;
+
+	while (numberOfDatagramsReceived < numberOfDatagrams)
+	{
+		UDPDatagram& currentDatagram = datagrams[numberOfDatagramsReceived];
+		currentDatagram.m_DataSize = ReceiveFromAddressOnSocket(currentDatagram.m_Buffer, currentDatagram.m_BufferSize, &currentDatagram.m_Address);
+		if (currentDatagram.m_DataSize == 0U)
+		{
+			break;
+		}
+
+		++numberOfDatagramsReceived;
+	}
+
+	return numberOfDatagramsReceived;
+}
+
+
+
 bool UDPSocket::IsBound() const
 {
 	return (m_Socket != INVALID_SOCKET);
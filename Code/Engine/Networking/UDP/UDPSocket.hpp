@@ -4,6 +4,21 @@
 
 
 
+const size_t MAXIMUM_DATAGRAMS_PER_BATCH = 64;
+const int UDP_SOCKET_BUFFER_SIZE = 1024 * 1024;
+
+
+
+struct UDPDatagram
+{
+	void* m_Buffer;
+	size_t m_BufferSize;
+	size_t m_DataSize;
+	sockaddr_in m_Address;
+};
+
+
+
 class UDPSocket
 {
 private:
@@ -17,6 +32,9 @@ public:
 	size_t SendToAddressOnSocket(const void* sendData, size_t dataSize, const sockaddr_in& toAddress);
 	size_t ReceiveFromAddressOnSocket(void* dataBuffer, size_t bufferSize, sockaddr_in* fromAddress);
 
+	size_t SendDatagramsOnSocket(const UDPDatagram* datagrams, size_t numberOfDatagrams);
+	size_t ReceiveDatagramsFromSocket(UDPDatagram* datagrams, size_t numberOfDatagrams);
+
 	bool IsBound() const;
 
 public:
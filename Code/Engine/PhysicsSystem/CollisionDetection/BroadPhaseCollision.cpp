@@ -2,12 +2,9 @@
 
 
 
-const Vector2D AABB_EXTENSION(0.1f, 0.1f);
-
-
-
-DynamicAABBTree::DynamicAABBTree() :
+DynamicAABBTree::DynamicAABBTree(const Vector2D& aabbExtension /*= AABB_EXTENSION*/) :
 	m_AllTreeNodes(nullptr),
+	m_AABBExtension(aabbExtension),
 	m_MaximumTreeSize(16U),
 	m_NumberOfNodes(0U),
 	m_RootNodeID(INVALID_ID),
@@ -39,7 +36,7 @@ int32_t DynamicAABBTree::AddFixtureToTree(const AABB2D& fixtureAABB, void* fixtu
 {
 	int32_t fixtureID = AllocateNodeToTree();
 
-	m_AllTreeNodes[fixtureID].m_NodeAABB = AABB2D(fixtureAABB.minimums - AABB_EXTENSION, fixtureAABB.maximums + AABB_EXTENSION);
+	m_AllTreeNodes[fixtureID].m_NodeAABB = AABB2D(fixtureAABB.minimums - m_AABBExtension, fixtureAABB.maximums + m_AABBExtension);
 	m_AllTreeNodes[fixtureID].m_NodeData = fixtureReference;
 	m_AllTreeNodes[fixtureID].m_NodeHeight = 0;
 
@@ -73,7 +70,7 @@ bool DynamicAABBTree::MoveFixtureWithinTree(int32_t currentFixtureID, const AABB
 
 	RemoveLeafNodeFromTree(currentFixtureID);
 
-	AABB2D extendedAABB = AABB2D(fixtureAABB.minimums - AABB_EXTENSION, fixtureAABB.maximums + AABB_EXTENSION);
+	AABB2D extendedAABB = AABB2D(fixtureAABB.minimums - m_AABBExtension, fixtureAABB.maximums + m_AABBExtension);
 	Vector2D predictedDisplacement = fixtureDisplacement * 2.0f;
 
 	if (predictedDisplacement.X < 0.0f)
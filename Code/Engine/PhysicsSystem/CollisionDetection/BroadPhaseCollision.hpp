@@ -7,6 +7,10 @@
 
 
 
+const Vector2D AABB_EXTENSION(0.1f, 0.1f);
+
+
+
 struct DAT_Node
 {
 	AABB2D m_NodeAABB;
@@ -33,7 +37,7 @@ inline bool IsALeafNode(const DAT_Node& currentNode)
 class DynamicAABBTree
 {
 public:
-	DynamicAABBTree();
+	DynamicAABBTree(const Vector2D& aabbExtension = AABB_EXTENSION);
 	~DynamicAABBTree();
 
 	int32_t AddFixtureToTree(const AABB2D& fixtureAABB, void* fixtureReference);
@@ -61,6 +65,7 @@ private:
 
 private:
 	DAT_Node* m_AllTreeNodes;
+	Vector2D m_AABBExtension;
 	size_t m_MaximumTreeSize;
 	size_t m_NumberOfNodes;
 
@@ -5,6 +5,7 @@
 #include "Engine/PhysicsSystem/ContactSolver/Contacts/Contact.hpp"
 #include "Engine/DebugTools/ProfilerSystem/ProfilerSystem.hpp"
 #include "Engine/Input/InputSystem.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
 
 
 
@@ -513,6 +514,8 @@ PhysicsWorld* PhysicsWorld::SingletonInstance()
 
 void PhysicsWorld::SimulateWorld()
 {
+	MEMORY_SCOPE("Physics");
+
 	ToggleAABBs();
 	
 	if (HaveNewFixturesBeenCreated())
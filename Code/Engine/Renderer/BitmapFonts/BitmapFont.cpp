@@ -1,4 +1,5 @@
 #include "Engine/Renderer/BitmapFonts/BitmapFont.hpp"
+#include "Engine/Renderer/BitmapFonts/TextLayoutCache.hpp"
 #include "Engine/Renderer/RenderUtilities/RenderConstants.hpp"
 #include "Engine/FileUtilities/FileUtilities.hpp"
 
@@ -362,6 +363,8 @@ ProportionalFont* ProportionalFont::CreateOrGetProportionalFont(const char* prop
 
 void ProportionalFont::DestroyAllProportionalFonts()
 {
+	TextLayoutCache::ClearTextLayoutCache();
+
 	for (auto currentProportionalFont = s_ProportionalFontRegistry.begin(); currentProportionalFont != s_ProportionalFontRegistry.end();)
 	{
 		delete currentProportionalFont->second;
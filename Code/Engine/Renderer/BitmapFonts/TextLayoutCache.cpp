@@ -0,0 +1,229 @@
+#include <algorithm>
+
+#include "Engine/Renderer/BitmapFonts/TextLayoutCache.hpp"
+#include "Engine/Renderer/MeshAndMaterial/Mesh.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
+
+
+
+std::map<TextLayoutKey, TextLayout*, CompareTextLayoutKeys> TextLayoutCache::s_TextLayouts;
+uint64_t TextLayoutCache::s_NextUseStamp = 0U;
+size_t TextLayoutCache::s_NumberOfLayoutBuilds = 0U;
+
+
+
+TextLayout::TextLayout() :
+m_LayoutMesh(nullptr),
+m_TextWidth(0.0f),
+m_LastUseStamp(0U)
+{
+
+}
+
+
+
+TextLayout::~TextLayout()
+{
+	delete m_LayoutMesh;
+}
+
+
+
+void TextLayout::BuildTextLayout(const std::string& asciiText, float cellHeight, const ProportionalFont* font)
+{
+	m_Vertices.clear();
+	m_Indices.clear();
+	m_GlyphRuns.clear();
+
+	delete m_LayoutMesh;
+	m_LayoutMesh = nullptr;
+
+	Vertex3D textVertex;
+	textVertex.m_Color = RGBA::WHITE;
+
+	Vector2 cursorPosition = Vector2(0.0f, cellHeight);
+	float textScale = font->GetCharacterScaleForCellHeight(cellHeight);
+
+	ProportionalGlyph* previousGlyph = nullptr;
+
+	for (char asciiGlyph : asciiText)
+	{
+		ProportionalGlyph* currentGlyph = font->GetProportionalGlyphForGlyphUnicode(asciiGlyph);
+		if (currentGlyph == nullptr)
+		{
+			continue;
+		}
+
+		if (previousGlyph != nullptr)
+		{
+			cursorPosition.X += font->GetKerningForGlyphPair(previousGlyph->m_glyphUnicode, currentGlyph->m_glyphUnicode) * textScale;
+		}
+
+		Vector2 glyphOffset = currentGlyph->GetOffset();
+		Vector2 glyphSize = currentGlyph->GetSize();
+
+		Vector2 letterMinimums;
+		Vector2 letterMaximums;
+
+		letterMinimums.X = cursorPosition.X + (glyphOffset.X * textScale);
+		letterMaximums.Y = cursorPosition.Y - (glyphOffset.Y * textScale);
+
+		letterMaximums.X = letterMinimums.X + (glyphSize.X * textScale);
+		letterMinimums.Y = letterMaximums.Y - (glyphSize.Y * textScale);
+
+		Texture* glyphTexture = font->GetFontTextureForGlyph(*currentGlyph);
+		if (m_GlyphRuns.empty() || m_GlyphRuns.back().m_GlyphTexture != glyphTexture)
+		{
+			TextGlyphRun glyphRun;
+			glyphRun.m_GlyphTexture = glyphTexture;
+			glyphRun.m_FirstVertex = static_cast<uint32_t>(m_Vertices.size());
+			glyphRun.m_NumberOfVertices = 0U;
+			glyphRun.m_FirstIndex = static_cast<uint32_t>(m_Indices.size());
+			glyphRun.m_NumberOfIndices = 0U;
+			m_GlyphRuns.push_back(glyphRun);
+		}
+
+		TextGlyphRun& currentRun = m_GlyphRuns.back();
+
+		AABB2 glyphTextureBounds = font->GetTextureBoundsForGlyph(*currentGlyph);
+		Vector2 textureMinimums = glyphTextureBounds.minimums;
+		Vector2 textureMaximums = glyphTextureBounds.maximums;
+
+		uint32_t letterStartingIndex = currentRun.m_NumberOfVertices;
+
+		textVertex.m_Position = Vector3(letterMinimums.X, letterMinimums.Y, 0.0f);
+		textVertex.m_TextureCoordinates = Vector2(textureMinimums.X, textureMaximums.Y);
+		m_Vertices.push_back(textVertex);
+
+		textVertex.m_Position = Vector3(letterMaximums.X, letterMinimums.Y, 0.0f);
+		textVertex.m_TextureCoordinates = Vector2(textureMaximums.X, textureMaximums.Y);
+		m_Vertices.push_back(textVertex);
+
+		textVertex.m_Position = Vector3(letterMaximums.X, letterMaximums.Y, 0.0f);
+		textVertex.m_TextureCoordinates = Vector2(textureMaximums.X, textureMinimums.Y);
+		m_Vertices.push_back(textVertex);
+
+		textVertex.m_Position = Vector3(letterMinimums.X, letterMaximums.Y, 0.0f);
+		textVertex.m_TextureCoordinates = Vector2(textureMinimums.X, textureMinimums.Y);
+		m_Vertices.push_back(textVertex);
+
+		m_Indices.push_back(letterStartingIndex + 0);
+		m_Indices.push_back(letterStartingIndex + 1);
+		m_Indices.push_back(letterStartingIndex + 2);
+		m_Indices.push_back(letterStartingIndex + 0);
+		m_Indices.push_back(letterStartingIndex + 2);
+		m_Indices.push_back(letterStartingIndex + 3);
+
+		currentRun.m_NumberOfVertices += 4U;
+		currentRun.m_NumberOfIndices += 6U;
+
+		cursorPosition.X += currentGlyph->GetAdvance().X * textScale;
+		previousGlyph = currentGlyph;
+	}
+
+	m_TextWidth = cursorPosition.X;
+}
+
+
+
+bool CompareTextLayoutKeys::operator()(const TextLayoutKey& firstKey, const TextLayoutKey& secondKey) const
+{
+	if (firstKey.m_Font != secondKey.m_Font)
+	{
+		return (firstKey.m_Font < secondKey.m_Font);
+	}
+
+	if (firstKey.m_CellHeight != secondKey.m_CellHeight)
+	{
+		return (firstKey.m_CellHeight < secondKey.m_CellHeight);
+	}
+
+	return (firstKey.m_Text < secondKey.m_Text);
+}
+
+
+
+const TextLayout* TextLayoutCache::CreateOrGetTextLayout(const std::string& asciiText, float cellHeight, const ProportionalFont* font)
+{
+	MEMORY_SCOPE("Text");
+
+	TextLayoutKey layoutKey;
+	layoutKey.m_Text = asciiText;
+	layoutKey.m_Font = font;
+	layoutKey.m_CellHeight = cellHeight;
+
+	auto textLayoutIterator = s_TextLayouts.find(layoutKey);
+	if (textLayoutIterator != s_TextLayouts.end())
+	{
+		textLayoutIterator->second->m_LastUseStamp = s_NextUseStamp++;
+		return textLayoutIterator->second;
+	}
+
+	if (s_TextLayouts.size() >= MAXIMUM_CACHED_TEXT_LAYOUTS)
+	{
+		EvictLeastRecentlyUsedLayouts();
+	}
+
+	TextLayout* textLayout = new TextLayout();
+	textLayout->BuildTextLayout(asciiText, cellHeight, font);
+	textLayout->m_LastUseStamp = s_NextUseStamp++;
+	++s_NumberOfLayoutBuilds;
+
+	s_TextLayouts.insert(std::make_pair(layoutKey, textLayout));
+
+	return textLayout;
+}
+
+
+
+void TextLayoutCache::ClearTextLayoutCache()
+{
+	for (auto textLayoutIterator = s_TextLayouts.begin(); textLayoutIterator != s_TextLayouts.end();)
+	{
+		delete textLayoutIterator->second;
+		textLayoutIterator = s_TextLayouts.erase(textLayoutIterator);
+	}
+}
+
+
+
+size_t TextLayoutCache::GetNumberOfCachedLayouts()
+{
+	return s_TextLayouts.size();
+}
+
+
+
+size_t TextLayoutCache::GetNumberOfLayoutBuilds()
+{
+	return s_NumberOfLayoutBuilds;
+}
+
+
+
+void TextLayoutCache::EvictLeastRecentlyUsedLayouts()
+{
+	std::vector<uint64_t> useStamps;
+	useStamps.reserve(s_TextLayouts.size());
+	for (const auto& textLayoutPair : s_TextLayouts)
+	{
+		useStamps.push_back(textLayoutPair.second->m_LastUseStamp);
+	}
+
+	auto medianIterator = useStamps.begin() + (useStamps.size() / 2U);
+	std::nth_element(useStamps.begin(), medianIterator, useStamps.end());
+	uint64_t oldestKeptStamp = *medianIterator;
+
+	for (auto textLayoutIterator = s_TextLayouts.begin(); textLayoutIterator != s_TextLayouts.end();)
+	{
+		if (textLayoutIterator->second->m_LastUseStamp < oldestKeptStamp)
+		{
+			delete textLayoutIterator->second;
+			textLayoutIterator = s_TextLayouts.erase(textLayoutIterator);
+		}
+		else
+		{
+			++textLayoutIterator;
+		}
+	}
+}
\ No newline at end of file
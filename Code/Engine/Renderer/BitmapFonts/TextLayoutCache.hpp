@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Engine/Renderer/BitmapFonts/BitmapFont.hpp"
+#include "Engine/Renderer/Vertex/Vertex.hpp"
+
+
+
+class Mesh;
+
+
+
+const size_t MAXIMUM_CACHED_TEXT_LAYOUTS = 512U;
+
+
+
+struct TextGlyphRun
+{
+	Texture* m_GlyphTexture;
+	uint32_t m_FirstVertex;
+	uint32_t m_NumberOfVertices;
+	uint32_t m_FirstIndex;
+	uint32_t m_NumberOfIndices;
+};
+
+
+
+class TextLayout
+{
+public:
+	TextLayout();
+	TextLayout(const TextLayout&) = delete;
+	~TextLayout();
+
+	void BuildTextLayout(const std::string& asciiText, float cellHeight, const ProportionalFont* font);
+
+public:
+	std::vector<Vertex3D> m_Vertices;
+	std::vector<uint32_t> m_Indices;
+	std::vector<TextGlyphRun> m_GlyphRuns;
+	mutable Mesh* m_LayoutMesh;
+
+	float m_TextWidth;
+	uint64_t m_LastUseStamp;
+};
+
+
+
+struct TextLayoutKey
+{
+	std::string m_Text;
+	const ProportionalFont* m_Font;
+	float m_CellHeight;
+};
+
+
+
+struct CompareTextLayoutKeys
+{
+	bool operator()(const TextLayoutKey& firstKey, const TextLayoutKey& secondKey) const;
+};
+
+
+
+class TextLayoutCache
+{
+public:
+	static const TextLayout* CreateOrGetTextLayout(const std::string& asciiText, float cellHeight, const ProportionalFont* font);
+	static void ClearTextLayoutCache();
+
+	static size_t GetNumberOfCachedLayouts();
+	static size_t GetNumberOfLayoutBuilds();
+
+private:
+	static void EvictLeastRecentlyUsedLayouts();
+
+private:
+	static std::map<TextLayoutKey, TextLayout*, CompareTextLayoutKeys> s_TextLayouts;
+	static uint64_t s_NextUseStamp;
+	static size_t s_NumberOfLayoutBuilds;
+};
\ No newline at end of file
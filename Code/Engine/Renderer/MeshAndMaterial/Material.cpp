@@ -201,6 +201,18 @@ void Material::BindIntAttributeFromShaderProgram(const char* attributeName, int
 
 
 
+void Material::SetConstantFloatAttributeToShaderProgram4D(const char* attributeName, const float* attributeValue) const
+{
+	int attributeLocation = glGetAttribLocation(m_ShaderProgram, attributeName);
+	if (attributeLocation >= 0)
+	{
+		glDisableVertexAttribArray(attributeLocation);
+		glVertexAttrib4f(attributeLocation, attributeValue[0], attributeValue[1], attributeValue[2], attributeValue[3]);
+	}
+}
+
+
+
 uint32_t Material::GetShaderProgramID()
 {
 	return m_ShaderProgram;
@@ -24,6 +24,7 @@ public:
 
 	void BindFloatAttributeFromShaderProgram(const char* attributeName, int attributeSize, uint32_t attributeType, uint8_t normalizeAttribute, int attributeStride, int attributeOffset) const;
 	void BindIntAttributeFromShaderProgram(const char* attributeName, int attributeSize, uint32_t attributeType, int attributeStride, int attributeOffset) const;
+	void SetConstantFloatAttributeToShaderProgram4D(const char* attributeName, const float* attributeValue) const;
 
 	uint32_t GetShaderProgramID();
 
@@ -3,6 +3,18 @@
 
 
 
+MeshRenderInstruction::MeshRenderInstruction() :
+m_PrimitiveType(TRIANGLES_PRIMITIVE),
+m_StartIndex(0U),
+m_ElementCount(0U),
+m_BaseVertex(0),
+m_RenderUsingIndexBuffer(false)
+{
+
+}
+
+
+
 Mesh::Mesh() :
 m_VertexBufferObject(new RenderBuffer()),
 m_IndexBufferObject(new RenderBuffer())
@@ -80,11 +92,34 @@ void Mesh::AddRenderInstruction(size_t numberOfVertices, size_t numberOfIndices,
 
 
 
+void Mesh::SetSingleRenderInstruction(size_t numberOfVertices, size_t numberOfIndices, unsigned int primitiveType /*= TRIANGLES_PRIMITIVE*/, size_t startIndex /*= 0U*/, int baseVertex /*= 0*/)
+{
+	if (m_RenderInstructions.size() != 1U)
+	{
+		m_RenderInstructions.resize(1U);
+	}
+
+	MeshRenderInstruction& renderInstruction = m_RenderInstructions[0];
+
+	renderInstruction.m_PrimitiveType = primitiveType;
+	renderInstruction.m_ElementCount = (numberOfIndices > 0) ? numberOfIndices : numberOfVertices;
+	renderInstruction.m_StartIndex = startIndex;
+	renderInstruction.m_BaseVertex = baseVertex;
+	renderInstruction.m_RenderUsingIndexBuffer = (numberOfIndices > 0);
+	renderInstruction.m_MaterialID.clear();
+}
+
+
+
 void Mesh::RenderUsingInstructions() const
 {
 	for (const MeshRenderInstruction& currentInstruction : m_RenderInstructions)
 	{
-		if (currentInstruction.m_RenderUsingIndexBuffer)
+		if (currentInstruction.m_RenderUsingIndexBuffer && currentInstruction.m_BaseVertex != 0)
+		{
+			glDrawElementsBaseVertex(currentInstruction.m_PrimitiveType, currentInstruction.m_ElementCount, GL_UNSIGNED_INT, (void*)(currentInstruction.m_StartIndex * sizeof(uint32_t)), currentInstruction.m_BaseVertex);
+		}
+		else if (currentInstruction.m_RenderUsingIndexBuffer)
 		{
 			glDrawElements(currentInstruction.m_PrimitiveType, currentInstruction.m_ElementCount, GL_UNSIGNED_INT, (void*)(currentInstruction.m_StartIndex * sizeof(uint32_t)));
 		}
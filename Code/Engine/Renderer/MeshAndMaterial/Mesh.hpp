@@ -10,9 +10,12 @@
 
 struct MeshRenderInstruction
 {
+	MeshRenderInstruction();
+
 	unsigned int m_PrimitiveType;
 	size_t m_StartIndex;
 	size_t m_ElementCount;
+	int m_BaseVertex;
 	bool m_RenderUsingIndexBuffer;
 	std::string m_MaterialID;
 };
@@ -37,6 +40,7 @@ public:
 	void WriteToMesh(const Vertex3D* meshVertices, const uint32_t* meshIndices, size_t numberOfVertices, size_t numberOfIndices);
 
 	void AddRenderInstruction(size_t numberOfVertices, size_t numberOfIndices, unsigned int primitiveType = TRIANGLES_PRIMITIVE, const std::string& materialID = "");
+	void SetSingleRenderInstruction(size_t numberOfVertices, size_t numberOfIndices, unsigned int primitiveType = TRIANGLES_PRIMITIVE, size_t startIndex = 0U, int baseVertex = 0);
 
 	void RenderUsingInstructions() const;
 
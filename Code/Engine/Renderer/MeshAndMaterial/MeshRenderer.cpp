@@ -39,6 +39,17 @@ void MeshRenderer::SetMaterial(Material* material)
 
 
 
+void MeshRenderer::SetConstantVertexColor(const RGBA& vertexColor) const
+{
+	float colorValue[4] = { vertexColor.m_Red / 255.0f, vertexColor.m_Green / 255.0f, vertexColor.m_Blue / 255.0f, vertexColor.m_Alpha / 255.0f };
+
+	glBindVertexArray(m_VertexArrayObject);
+	m_Material->SetConstantFloatAttributeToShaderProgram4D("inColor", colorValue);
+	glBindVertexArray(NULL);
+}
+
+
+
 void MeshRenderer::RenderMeshWithMaterial(const Matrix4& modelMatrix, const Matrix4& viewMatrix, const Matrix4& projectionMatrix) const
 {
 	SetModelViewProjectionMatrices(modelMatrix, viewMatrix, projectionMatrix);
@@ -5,6 +5,7 @@
 
 #include "Engine/Renderer/MeshAndMaterial/Mesh.hpp"
 #include "Engine/Renderer/MeshAndMaterial/Material.hpp"
+#include "Engine/Renderer/Color/RGBA.hpp"
 #include "Engine/Math/VectorMath/3D/Vector3.hpp"
 #include "Engine/Math/EulerAngles/EulerAngles.hpp"
 #include "Engine/Math/MatrixMath/Matrix4.hpp"
@@ -19,6 +20,7 @@ public:
 
 	void SetMesh(Mesh* mesh);
 	void SetMaterial(Material* material);
+	void SetConstantVertexColor(const RGBA& vertexColor) const;
 
 	void RenderMeshWithMaterial(const Matrix4& modelMatrix, const Matrix4& viewMatrix, const Matrix4& projectionMatrix) const;
 
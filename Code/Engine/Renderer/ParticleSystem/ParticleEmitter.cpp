@@ -1,14 +1,22 @@
 #include <vector>
 #include "Engine/Renderer/ParticleSystem/ParticleEmitter.hpp"
-#include "Engine/Renderer/RenderUtilities/AdvancedRenderer.hpp"
+#include "Engine/JobSystem/JobSystem.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+#include "Engine/ErrorHandling/StringUtils.hpp"
+#include "Engine/Time/Time.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
+
+
+
+static uint64_t s_NextParticleEmitterSeed = 1U;
 
 
 
 ParticleEmitter::ParticleEmitter(ParticleEmitterDefinition* particleEmitterDefinition, const Vector2& spawnPosition) :
 m_TimeElapsedSinceLastSpawn(0.0f),
 m_SpawnPosition(spawnPosition),
-m_EmitterMesh(new Mesh()),
 m_ParticleEmitterDefinition(particleEmitterDefinition),
+m_Random(s_NextParticleEmitterSeed++),
 m_HasTerminated(false)
 {
 	m_EmitterMaterial = particleEmitterDefinition->m_SpriteResource->m_Material;
@@ -18,7 +26,7 @@ m_HasTerminated(false)
 
 ParticleEmitter::~ParticleEmitter()
 {
-	delete m_EmitterMesh;
+
 }
 
 
@@ -32,18 +40,7 @@ void ParticleEmitter::UpdateExistingParticles(float deltaTimeInSeconds)
 
 void ParticleEmitter::DestroyDeadParticles()
 {
-	for (auto particleIterator = m_Particles.begin(); particleIterator != m_Particles.end();)
-	{
-		Particle* currentParticle = *particleIterator;
-		if (currentParticle->IsDead())
-		{
-			particleIterator = m_Particles.erase(particleIterator);
-			delete currentParticle;
-			continue;
-		}
-
-		++particleIterator;
-	}
+	m_Particles.RemoveDeadParticles();
 }
 
 
@@ -57,9 +54,7 @@ void ParticleEmitter::SpawnNewParticles(float deltaTimeInSeconds)
 
 		while (m_TimeElapsedSinceLastSpawn >= timeTakenPerParticle)
 		{
-			Particle* emittedParticle = m_ParticleEmitterDefinition->SpawnNewParticle();
-			emittedParticle->m_Position = m_SpawnPosition;
-			m_Particles.insert(emittedParticle);
+			m_ParticleEmitterDefinition->SpawnNewParticle(m_Particles, m_Random, m_SpawnPosition);
 			m_TimeElapsedSinceLastSpawn -= timeTakenPerParticle;
 		}
 	}
@@ -67,70 +62,158 @@ void ParticleEmitter::SpawnNewParticles(float deltaTimeInSeconds)
 
 
 
-void ParticleEmitter::UpdateEmitterMesh() const
+void ParticleEmitter::WriteEmitterVertices(Vertex3D* meshVertices, uint32_t* meshIndices) const
 {
-	std::vector<Vertex3D> meshVertices;
-	std::vector<uint32_t> meshIndices;
-
-	Vertex3D meshVertex;
 	AABB2 textureCoordinates = m_ParticleEmitterDefinition->GetParticleTextureCoordinates();
 	Vector2 particleMinimums = m_ParticleEmitterDefinition->GetParticleMinimums();
 	Vector2 particleMaximums = m_ParticleEmitterDefinition->GetParticleMaximums();
+	m_Particles.WriteQuads(meshVertices, meshIndices, particleMinimums, particleMaximums, textureCoordinates);
+}
 
-	for (const Particle* currentParticle : m_Particles)
-	{
-		meshIndices.push_back(meshVertices.size() + 0);
-		meshIndices.push_back(meshVertices.size() + 1);
-		meshIndices.push_back(meshVertices.size() + 2);
-		meshIndices.push_back(meshVertices.size() + 2);
-		meshIndices.push_back(meshVertices.size() + 3);
-		meshIndices.push_back(meshVertices.size() + 0);
 
-		meshVertex.m_Color = currentParticle->m_Tint;
 
-		Vector3 boundingPoint = Vector3::ZERO;
+ParticleEmitter* ParticleEmitter::CreateParticleEmitterFromDefinition(ParticleEmitterDefinition* particleEmitterDefinition, const Vector2& spawnPosition)
+{
+	return new ParticleEmitter(particleEmitterDefinition, spawnPosition);
+}
+
 
-		boundingPoint.X = currentParticle->m_Position.X + (particleMinimums.X * currentParticle->m_Scale.X);
-		boundingPoint.Y = currentParticle->m_Position.Y + (particleMinimums.Y * currentParticle->m_Scale.Y);
-		meshVertex.m_Position = boundingPoint;
-		meshVertex.m_TextureCoordinates = Vector2(textureCoordinates.minimums.X, textureCoordinates.maximums.Y);
-		meshVertices.push_back(meshVertex);
 
-		boundingPoint.X = currentParticle->m_Position.X + (particleMaximums.X * currentParticle->m_Scale.X);
-		boundingPoint.Y = currentParticle->m_Position.Y + (particleMinimums.Y * currentParticle->m_Scale.Y);
-		meshVertex.m_Position = boundingPoint;
-		meshVertex.m_TextureCoordinates = Vector2(textureCoordinates.maximums.X, textureCoordinates.maximums.Y);
-		meshVertices.push_back(meshVertex);
+void ParticleEmitter::DestroyParticleEmitter(ParticleEmitter* particleEmitter)
+{
+	delete particleEmitter;
+	particleEmitter = nullptr;
+}
+
 
-		boundingPoint.X = currentParticle->m_Position.X + (particleMaximums.X * currentParticle->m_Scale.X);
-		boundingPoint.Y = currentParticle->m_Position.Y + (particleMaximums.Y * currentParticle->m_Scale.Y);
-		meshVertex.m_Position = boundingPoint;
-		meshVertex.m_TextureCoordinates = Vector2(textureCoordinates.maximums.X, textureCoordinates.minimums.Y);
-		meshVertices.push_back(meshVertex);
 
-		boundingPoint.X = currentParticle->m_Position.X + (particleMinimums.X * currentParticle->m_Scale.X);
-		boundingPoint.Y = currentParticle->m_Position.Y + (particleMaximums.Y * currentParticle->m_Scale.Y);
-		meshVertex.m_Position = boundingPoint;
-		meshVertex.m_TextureCoordinates = Vector2(textureCoordinates.minimums.X, textureCoordinates.minimums.Y);
-		meshVertices.push_back(meshVertex);
+void ParticleEmitter::UpdateParticleEmitters(const std::vector<ParticleEmitter*>& particleEmitters, float deltaTimeInSeconds)
+{
+	if (!JobSystem::JobSystemIsRunning())
+	{
+		for (ParticleEmitter* currentParticleEmitter : particleEmitters)
+		{
+			currentParticleEmitter->Update(deltaTimeInSeconds);
+		}
+
+		return;
 	}
 
-	m_EmitterMesh->WriteToMesh(meshVertices.data(), meshIndices.data(), meshVertices.size(), meshIndices.size());
+	std::vector<Job*> dispatchedJobs;
+	for (ParticleEmitter* currentParticleEmitter : particleEmitters)
+	{
+		if (currentParticleEmitter->m_Particles.GetNumberOfParticles() < MINIMUM_PARTICLES_PER_EMITTER_JOB)
+		{
+			continue;
+		}
+
+		Job* emitterJob = Job::CreateJob(GENERIC, UpdateParticleEmittersJob);
+		emitterJob->WriteToJobData<ParticleEmitter*>(currentParticleEmitter);
+		emitterJob->WriteToJobData<float>(deltaTimeInSeconds);
+		Job::DispatchJob(emitterJob);
+		dispatchedJobs.push_back(emitterJob);
+	}
+
+	for (ParticleEmitter* currentParticleEmitter : particleEmitters)
+	{
+		if (currentParticleEmitter->m_Particles.GetNumberOfParticles() < MINIMUM_PARTICLES_PER_EMITTER_JOB)
+		{
+			currentParticleEmitter->Update(deltaTimeInSeconds);
+		}
+	}
+
+	for (Job* emitterJob : dispatchedJobs)
+	{
+		Job::WaitJob(emitterJob);
+	}
 }
 
 
 
-ParticleEmitter* ParticleEmitter::CreateParticleEmitterFromDefinition(ParticleEmitterDefinition* particleEmitterDefinition, const Vector2& spawnPosition)
+double ParticleEmitter::RunParticleBenchmark(size_t numberOfParticles, size_t numberOfEmitters, size_t numberOfFrames, size_t numberOfJobs)
 {
-	return new ParticleEmitter(particleEmitterDefinition, spawnPosition);
+	numberOfEmitters = (numberOfEmitters > 0U) ? numberOfEmitters : 1U;
+	numberOfJobs = (numberOfJobs > numberOfEmitters) ? numberOfEmitters : numberOfJobs;
+	bool useJobs = (numberOfJobs > 1U && JobSystem::JobSystemIsRunning());
+
+	ParticleBenchmarkEmitter* benchmarkEmitters = new ParticleBenchmarkEmitter[numberOfEmitters];
+	for (size_t emitterIndex = 0; emitterIndex < numberOfEmitters; ++emitterIndex)
+	{
+		ParticleBenchmarkEmitter& currentEmitter = benchmarkEmitters[emitterIndex];
+		currentEmitter.m_Random.SetSeed(emitterIndex + 1U);
+		currentEmitter.m_TargetNumberOfParticles = numberOfParticles / numberOfEmitters;
+		currentEmitter.m_Particles.Reserve(currentEmitter.m_TargetNumberOfParticles);
+	}
+
+	SimulateBenchmarkEmitters(benchmarkEmitters, numberOfEmitters, 0.0f);
+
+	double startTime = GetCurrentTimeInMilliseconds();
+	std::vector<Job*> dispatchedJobs;
+
+	for (size_t frameIndex = 0; frameIndex < numberOfFrames; ++frameIndex)
+	{
+		if (!useJobs)
+		{
+			SimulateBenchmarkEmitters(benchmarkEmitters, numberOfEmitters, PARTICLE_BENCHMARK_FRAME_TIME);
+			continue;
+		}
+
+		dispatchedJobs.clear();
+		size_t firstEmitterIndex = 0U;
+		for (size_t jobIndex = 0; jobIndex < numberOfJobs; ++jobIndex)
+		{
+			size_t endEmitterIndex = ((jobIndex + 1U) * numberOfEmitters) / numberOfJobs;
+
+			Job* benchmarkJob = Job::CreateJob(GENERIC, SimulateBenchmarkEmittersJob);
+			benchmarkJob->WriteToJobData<ParticleBenchmarkEmitter*>(benchmarkEmitters + firstEmitterIndex);
+			benchmarkJob->WriteToJobData<size_t>(endEmitterIndex - firstEmitterIndex);
+			benchmarkJob->WriteToJobData<float>(PARTICLE_BENCHMARK_FRAME_TIME);
+			Job::DispatchJob(benchmarkJob);
+			dispatchedJobs.push_back(benchmarkJob);
+
+			firstEmitterIndex = endEmitterIndex;
+		}
+
+		for (Job* benchmarkJob : dispatchedJobs)
+		{
+			Job::WaitJob(benchmarkJob);
+		}
+	}
+
+	double elapsedTime = GetCurrentTimeInMilliseconds() - startTime;
+	delete[] benchmarkEmitters;
+
+	return elapsedTime / static_cast<double>((numberOfFrames > 0U) ? numberOfFrames : 1U);
 }
 
 
 
-void ParticleEmitter::DestroyParticleEmitter(ParticleEmitter* particleEmitter)
+void ParticleEmitter::SimulateBenchmarkEmitters(ParticleBenchmarkEmitter* benchmarkEmitters, size_t numberOfEmitters, float deltaTimeInSeconds)
 {
-	delete particleEmitter;
-	particleEmitter = nullptr;
+	const AABB2 textureCoordinates = AABB2(Vector2::ZERO, Vector2::ONE);
+	const Vector2 particleMinimums = Vector2(-0.5f, -0.5f);
+	const Vector2 particleMaximums = Vector2(0.5f, 0.5f);
+
+	for (size_t emitterIndex = 0; emitterIndex < numberOfEmitters; ++emitterIndex)
+	{
+		ParticleBenchmarkEmitter& currentEmitter = benchmarkEmitters[emitterIndex];
+		ParticlePool& currentParticles = currentEmitter.m_Particles;
+
+		currentParticles.IntegrateParticles(deltaTimeInSeconds);
+		currentParticles.FadeParticles(255.0f);
+		currentParticles.RemoveDeadParticles();
+
+		while (currentParticles.GetNumberOfParticles() < currentEmitter.m_TargetNumberOfParticles)
+		{
+			Vector2 particleVelocity = currentEmitter.m_Random.GetVector2WithinRange(Vector2(-5.0f, -5.0f), Vector2(5.0f, 5.0f));
+			float particleLifeTime = currentEmitter.m_Random.GetFloatWithinRange(1.0f, 3.0f);
+			currentParticles.AddParticle(Vector2::ZERO, 1.0f, particleVelocity, Vector2(0.0f, -9.8f), particleLifeTime, RGBA::WHITE);
+		}
+
+		currentEmitter.m_MeshVertices.resize(currentParticles.GetNumberOfParticles() * 4U);
+		currentEmitter.m_MeshIndices.resize(currentParticles.GetNumberOfParticles() * 6U);
+		currentParticles.WriteQuads(currentEmitter.m_MeshVertices.data(), currentEmitter.m_MeshIndices.data(), particleMinimums, particleMaximums, textureCoordinates);
+	}
 }
 
 
@@ -139,9 +222,7 @@ void ParticleEmitter::SpawnInitialParticles()
 {
 	for (uint32_t particleIndex = 0; particleIndex < m_ParticleEmitterDefinition->m_InitialNumberOfSpawnParticles; ++particleIndex)
 	{
-		Particle* emittedParticle = m_ParticleEmitterDefinition->SpawnNewParticle();
-		emittedParticle->m_Position = m_SpawnPosition;
-		m_Particles.insert(emittedParticle);
+		m_ParticleEmitterDefinition->SpawnNewParticle(m_Particles, m_Random, m_SpawnPosition);
 	}
 }
 
@@ -156,15 +237,23 @@ void ParticleEmitter::Update(float deltaTimeInSeconds)
 
 
 
-void ParticleEmitter::Render() const
+void ParticleEmitter::Render(RenderCommandBuffer& commandBuffer, uint8_t layerID) const
 {
-	UpdateEmitterMesh();
-	
-	size_t numberOfVertices = m_EmitterMesh->m_VertexBufferObject->GetElementCount();
-	size_t numberOfIndices = m_EmitterMesh->m_IndexBufferObject->GetElementCount();
+	size_t numberOfParticles = m_Particles.GetNumberOfParticles();
+	if (numberOfParticles == 0U)
+	{
+		return;
+	}
+
+	StreamingMeshAllocation emitterAllocation;
+	if (!commandBuffer.AllocateTransientMesh(numberOfParticles * 4U, numberOfParticles * 6U, &emitterAllocation))
+	{
+		return;
+	}
 
-	m_EmitterMaterial->SetDiffuseTexture(m_ParticleEmitterDefinition->m_SpriteResource->m_Texture);
-	AdvancedRenderer::SingletonInstance()->DrawPolygonMesh(m_EmitterMesh, numberOfVertices, numberOfIndices, m_EmitterMaterial);
+	WriteEmitterVertices(emitterAllocation.m_Vertices, emitterAllocation.m_Indices);
+
+	commandBuffer.DrawTransientMesh(commandBuffer.GetNextSortKey(layerID), emitterAllocation, m_EmitterMaterial, m_ParticleEmitterDefinition->m_SpriteResource->m_Texture);
 }
 
 
@@ -185,7 +274,7 @@ void ParticleEmitter::TerminateEmitter()
 
 bool ParticleEmitter::HasFinishedPlaying() const
 {
-	return (m_Particles.empty());
+	return m_Particles.IsEmpty();
 }
 
 
@@ -193,4 +282,76 @@ bool ParticleEmitter::HasFinishedPlaying() const
 bool ParticleEmitter::IsLooping() const
 {
 	return m_ParticleEmitterDefinition->IsLooping();
+}
+
+
+
+void UpdateParticleEmittersJob(Job* currentJob)
+{
+	MEMORY_SCOPE("Particles");
+
+	ParticleEmitter* currentParticleEmitter = currentJob->ReadFromJobData<ParticleEmitter*>();
+	float deltaTimeInSeconds = currentJob->ReadFromJobData<float>();
+
+	currentParticleEmitter->Update(deltaTimeInSeconds);
+}
+
+
+
+void SimulateBenchmarkEmittersJob(Job* currentJob)
+{
+	ParticleBenchmarkEmitter* benchmarkEmitters = currentJob->ReadFromJobData<ParticleBenchmarkEmitter*>();
+	size_t numberOfEmitters = currentJob->ReadFromJobData<size_t>();
+	float deltaTimeInSeconds = currentJob->ReadFromJobData<float>();
+
+	ParticleEmitter::SimulateBenchmarkEmitters(benchmarkEmitters, numberOfEmitters, deltaTimeInSeconds);
+}
+
+
+
+void ParticleBenchmarkCommand(Command& currentCommand)
+{
+	size_t numberOfParticles = 200000;
+	size_t numberOfEmitters = 64;
+	size_t numberOfFrames = 120;
+
+	std::vector<std::string> currentCommandArguments;
+	currentCommand.GetCommandArguments(currentCommandArguments);
+
+	if (currentCommandArguments.size() > 3)
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("Too many arguments. ParticleBenchmark takes the number of particles, emitters and frames as optional arguments.", RGBA::RED));
+		return;
+	}
+
+	if (currentCommandArguments.size() > 0)
+	{
+		numberOfParticles = static_cast<size_t>(stoul(currentCommandArguments[0]));
+	}
+
+	if (currentCommandArguments.size() > 1)
+	{
+		numberOfEmitters = static_cast<size_t>(stoul(currentCommandArguments[1]));
+	}
+
+	if (currentCommandArguments.size() > 2)
+	{
+		numberOfFrames = static_cast<size_t>(stoul(currentCommandArguments[2]));
+	}
+
+	size_t maximumNumberOfThreads = 1U;
+	if (JobSystem::JobSystemIsRunning())
+	{
+		maximumNumberOfThreads += static_cast<size_t>(JobSystem::SingletonInstance()->m_NumberOfJobThreads);
+	}
+
+	double serialTime = ParticleEmitter::RunParticleBenchmark(numberOfParticles, numberOfEmitters, numberOfFrames, 1U);
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("%u particles, %u emitters: 1 thread %.3f ms per frame.", numberOfParticles, numberOfEmitters, serialTime), RGBA::GREEN));
+
+	for (size_t numberOfThreads = 2U; numberOfThreads <= maximumNumberOfThreads; numberOfThreads *= 2U)
+	{
+		double parallelTime = ParticleEmitter::RunParticleBenchmark(numberOfParticles, numberOfEmitters, numberOfFrames, numberOfThreads);
+		double speedup = serialTime / ((parallelTime > 0.0) ? parallelTime : 1.0);
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("%u threads %.3f ms per frame (%.2fx).", numberOfThreads, parallelTime, speedup), RGBA::GREEN));
+	}
 }
\ No newline at end of file
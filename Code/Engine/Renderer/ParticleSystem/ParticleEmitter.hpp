@@ -1,10 +1,34 @@
 #pragma once
 
-#include <set>
-#include "Engine/Renderer/ParticleSystem/Particle.hpp"
+#include <vector>
+#include "Engine/Renderer/ParticleSystem/ParticlePool.hpp"
+#include "Engine/Renderer/ParticleSystem/ParticleRandom.hpp"
 #include "Engine/Renderer/ParticleSystem/ParticleEmitterDefinition.hpp"
 #include "Engine/Renderer/MeshAndMaterial/Mesh.hpp"
 #include "Engine/Renderer/MeshAndMaterial/Material.hpp"
+#include "Engine/Renderer/RenderUtilities/RenderCommandBuffer.hpp"
+#include "Engine/DeveloperConsole/Command.hpp"
+
+
+
+const size_t MINIMUM_PARTICLES_PER_EMITTER_JOB = 1024;
+const float PARTICLE_BENCHMARK_FRAME_TIME = 1.0f / 60.0f;
+
+
+
+class Job;
+
+
+
+struct ParticleBenchmarkEmitter
+{
+	ParticlePool m_Particles;
+	ParticleRandom m_Random;
+	size_t m_TargetNumberOfParticles;
+
+	std::vector<Vertex3D> m_MeshVertices;
+	std::vector<uint32_t> m_MeshIndices;
+};
 
 
 
@@ -18,16 +42,19 @@ private:
 	void DestroyDeadParticles();
 	void SpawnNewParticles(float deltaTimeInSeconds);
 
-	void UpdateEmitterMesh() const;
+	void WriteEmitterVertices(Vertex3D* meshVertices, uint32_t* meshIndices) const;
 
 public:
 	static ParticleEmitter* CreateParticleEmitterFromDefinition(ParticleEmitterDefinition* particleEmitterDefinition, const Vector2& spawnPosition);
 	static void DestroyParticleEmitter(ParticleEmitter* particleEmitter);
+	static void UpdateParticleEmitters(const std::vector<ParticleEmitter*>& particleEmitters, float deltaTimeInSeconds);
+	static double RunParticleBenchmark(size_t numberOfParticles, size_t numberOfEmitters, size_t numberOfFrames, size_t numberOfJobs);
+	static void SimulateBenchmarkEmitters(ParticleBenchmarkEmitter* benchmarkEmitters, size_t numberOfEmitters, float deltaTimeInSeconds);
 
 	void SpawnInitialParticles();
 
 	void Update(float deltaTimeInSeconds);
-	void Render() const;
+	void Render(RenderCommandBuffer& commandBuffer, uint8_t layerID) const;
 
 	bool HasTerminated() const;
 	void TerminateEmitter();
@@ -39,12 +66,19 @@ public:
 	float m_TimeElapsedSinceLastSpawn;
 	Vector2 m_SpawnPosition;
 
-	Mesh* m_EmitterMesh;
 	Material* m_EmitterMaterial;
 
 	ParticleEmitterDefinition* m_ParticleEmitterDefinition;
-	std::set<Particle*> m_Particles;
+	ParticlePool m_Particles;
+	ParticleRandom m_Random;
 
 private:
 	bool m_HasTerminated;
-};
\ No newline at end of file
+};
+
+
+
+void UpdateParticleEmittersJob(Job* currentJob);
+void SimulateBenchmarkEmittersJob(Job* currentJob);
+
+void ParticleBenchmarkCommand(Command& currentCommand);
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "Engine/Renderer/ParticleSystem/ParticleEmitterDefinition.hpp"
 #include "Engine/Renderer/SpriteRendering/SpriteDatabase.hpp"
-#include "Engine/Math/MathUtilities/MathUtilities.hpp"
 
 
 
@@ -26,17 +25,6 @@ ParticleEmitterDefinition::~ParticleEmitterDefinition()
 
 
 
-void ParticleEmitterDefinition::FadeTintForParticle(Particle* currentParticle)
-{
-	float alphaBlendFactor = currentParticle->GetRatioOfAgeOverLifeTime();
-	float maximumAlphaValue = static_cast<float>(m_Tint.m_Alpha);
-
-	float particleAlphaValue = LinearlyInterpolateIn1D(maximumAlphaValue, 0.0f, alphaBlendFactor);
-	currentParticle->m_Tint.m_Alpha = static_cast<unsigned char>(particleAlphaValue);
-}
-
-
-
 ParticleEmitterDefinition* ParticleEmitterDefinition::CreateParticleEmitterDefinition(const char* spriteResourceID)
 {
 	return new ParticleEmitterDefinition(spriteResourceID);
@@ -52,34 +40,21 @@ void ParticleEmitterDefinition::DestroyParticleEmitterDefinition(ParticleEmitter
 
 
 
-Particle* ParticleEmitterDefinition::SpawnNewParticle()
+void ParticleEmitterDefinition::SpawnNewParticle(ParticlePool& particlePool, ParticleRandom& particleRandom, const Vector2& spawnPosition) const
 {
-	Particle* emittedParticle = new Particle();
-	
-	float scaleFactor = GetRandomFloatWithinRange(m_ScaleRange.X, m_ScaleRange.Y);
-	emittedParticle->m_Scale = Vector2(scaleFactor, scaleFactor);
-
-	emittedParticle->m_Velocity = GetRandomVector2WithinRange(m_VelocityRange.minimums, m_VelocityRange.maximums);
-	emittedParticle->m_Acceleration = GetRandomVector2WithinRange(m_AccelerationRange.minimums, m_AccelerationRange.maximums);
-
-	emittedParticle->m_LifeTime = m_LifeTime;
-	emittedParticle->m_Tint = m_Tint;
+	float scaleFactor = particleRandom.GetFloatWithinRange(m_ScaleRange.X, m_ScaleRange.Y);
+	Vector2 particleVelocity = particleRandom.GetVector2WithinRange(m_VelocityRange.minimums, m_VelocityRange.maximums);
+	Vector2 particleAcceleration = particleRandom.GetVector2WithinRange(m_AccelerationRange.minimums, m_AccelerationRange.maximums);
 
-	return emittedParticle;
+	particlePool.AddParticle(spawnPosition, scaleFactor, particleVelocity, particleAcceleration, m_LifeTime, m_Tint);
 }
 
 
 
-void ParticleEmitterDefinition::UpdateParticles(std::set<Particle*>& allParticles, float deltaTimeInSeconds)
+void ParticleEmitterDefinition::UpdateParticles(ParticlePool& particlePool, float deltaTimeInSeconds) const
 {
-	for (Particle* currentParticle : allParticles)
-	{
-		currentParticle->m_Age += deltaTimeInSeconds;
-		currentParticle->m_Velocity += currentParticle->m_Acceleration * deltaTimeInSeconds;
-		currentParticle->m_Position += currentParticle->m_Velocity * deltaTimeInSeconds;
-
-		FadeTintForParticle(currentParticle);
-	}
+	particlePool.IntegrateParticles(deltaTimeInSeconds);
+	particlePool.FadeParticles(static_cast<float>(m_Tint.m_Alpha));
 }
 
 
@@ -1,10 +1,10 @@
 #pragma once
 
-#include <set>
 #include "Engine/Math/VectorMath/2D/Vector2.hpp"
 #include "Engine/Renderer/Color/RGBA.hpp"
 #include "Engine/Renderer/SpriteRendering/SpriteResource.hpp"
-#include "Engine/Renderer/ParticleSystem/Particle.hpp"
+#include "Engine/Renderer/ParticleSystem/ParticlePool.hpp"
+#include "Engine/Renderer/ParticleSystem/ParticleRandom.hpp"
 
 
 
@@ -14,14 +14,12 @@ private:
 	ParticleEmitterDefinition(const char* spriteResourceID);
 	~ParticleEmitterDefinition();
 
-	void FadeTintForParticle(Particle* currentParticle);
-
 public:
 	static ParticleEmitterDefinition* CreateParticleEmitterDefinition(const char* spriteResourceID);
 	static void DestroyParticleEmitterDefinition(ParticleEmitterDefinition* particleEmitterDefinition);
 
-	Particle* SpawnNewParticle();
-	void UpdateParticles(std::set<Particle*>& allParticles, float deltaTimeInSeconds);
+	void SpawnNewParticle(ParticlePool& particlePool, ParticleRandom& particleRandom, const Vector2& spawnPosition) const;
+	void UpdateParticles(ParticlePool& particlePool, float deltaTimeInSeconds) const;
 	
 	float GetTimePerParticleInSeconds() const;
 	bool IsLooping() const;
@@ -0,0 +1,274 @@
+#include "Engine/Renderer/ParticleSystem/ParticlePool.hpp"
+
+#include <malloc.h>
+#include <string.h>
+#include <xmmintrin.h>
+
+
+
+ParticlePool::ParticlePool() :
+m_PositionX(nullptr),
+m_PositionY(nullptr),
+m_VelocityX(nullptr),
+m_VelocityY(nullptr),
+m_AccelerationX(nullptr),
+m_AccelerationY(nullptr),
+m_Scale(nullptr),
+m_Age(nullptr),
+m_LifeTime(nullptr),
+m_Alpha(nullptr),
+m_Tint(nullptr),
+m_NumberOfParticles(0U),
+m_Capacity(0U)
+{
+
+}
+
+
+
+ParticlePool::~ParticlePool()
+{
+	float** allFloatStreams[] = { &m_PositionX, &m_PositionY, &m_VelocityX, &m_VelocityY, &m_AccelerationX, &m_AccelerationY, &m_Scale, &m_Age, &m_LifeTime, &m_Alpha };
+	for (float** currentStream : allFloatStreams)
+	{
+		_aligned_free(*currentStream);
+		*currentStream = nullptr;
+	}
+
+	_aligned_free(m_Tint);
+	m_Tint = nullptr;
+}
+
+
+
+void ParticlePool::Reserve(size_t newCapacity)
+{
+	if (newCapacity <= m_Capacity)
+	{
+		return;
+	}
+
+	float** allFloatStreams[] = { &m_PositionX, &m_PositionY, &m_VelocityX, &m_VelocityY, &m_AccelerationX, &m_AccelerationY, &m_Scale, &m_Age, &m_LifeTime, &m_Alpha };
+	for (float** currentStream : allFloatStreams)
+	{
+		float* newStream = static_cast<float*>(_aligned_malloc(newCapacity * sizeof(float), PARTICLE_POOL_ALIGNMENT));
+		if (*currentStream != nullptr)
+		{
+			memcpy(newStream, *currentStream, m_NumberOfParticles * sizeof(float));
+			_aligned_free(*currentStream);
+		}
+
+		*currentStream = newStream;
+	}
+
+	RGBA* newTints = static_cast<RGBA*>(_aligned_malloc(newCapacity * sizeof(RGBA), PARTICLE_POOL_ALIGNMENT));
+	if (m_Tint != nullptr)
+	{
+		memcpy(newTints, m_Tint, m_NumberOfParticles * sizeof(RGBA));
+		_aligned_free(m_Tint);
+	}
+
+	m_Tint = newTints;
+	m_Capacity = newCapacity;
+}
+
+
+
+void ParticlePool::Clear()
+{
+	m_NumberOfParticles = 0U;
+}
+
+
+
+size_t ParticlePool::AddParticle(const Vector2& spawnPosition, float particleScale, const Vector2& particleVelocity, const Vector2& particleAcceleration, float particleLifeTime, const RGBA& particleTint)
+{
+	if (m_NumberOfParticles == m_Capacity)
+	{
+		Reserve((m_Capacity > 0U) ? (m_Capacity * 2U) : INITIAL_PARTICLE_POOL_CAPACITY);
+	}
+
+	size_t particleIndex = m_NumberOfParticles++;
+	m_PositionX[particleIndex] = spawnPosition.X;
+	m_PositionY[particleIndex] = spawnPosition.Y;
+	m_VelocityX[particleIndex] = particleVelocity.X;
+	m_VelocityY[particleIndex] = particleVelocity.Y;
+	m_AccelerationX[particleIndex] = particleAcceleration.X;
+	m_AccelerationY[particleIndex] = particleAcceleration.Y;
+	m_Scale[particleIndex] = particleScale;
+	m_Age[particleIndex] = 0.0f;
+	m_LifeTime[particleIndex] = particleLifeTime;
+	m_Alpha[particleIndex] = static_cast<float>(particleTint.m_Alpha);
+	m_Tint[particleIndex] = particleTint;
+
+	return particleIndex;
+}
+
+
+
+Particle ParticlePool::GetParticle(size_t particleIndex) const
+{
+	Particle currentParticle;
+	currentParticle.m_Position = Vector2(m_PositionX[particleIndex], m_PositionY[particleIndex]);
+	currentParticle.m_Scale = Vector2(m_Scale[particleIndex], m_Scale[particleIndex]);
+	currentParticle.m_Velocity = Vector2(m_VelocityX[particleIndex], m_VelocityY[particleIndex]);
+	currentParticle.m_Acceleration = Vector2(m_AccelerationX[particleIndex], m_AccelerationY[particleIndex]);
+	currentParticle.m_Age = m_Age[particleIndex];
+	currentParticle.m_LifeTime = m_LifeTime[particleIndex];
+	currentParticle.m_Tint = m_Tint[particleIndex];
+	currentParticle.m_Tint.m_Alpha = static_cast<unsigned char>(m_Alpha[particleIndex]);
+
+	return currentParticle;
+}
+
+
+
+void ParticlePool::IntegrateParticles(float deltaTimeInSeconds)
+{
+	size_t numberOfSIMDParticles = m_NumberOfParticles - (m_NumberOfParticles % PARTICLE_SIMD_WIDTH);
+	__m128 deltaTime = _mm_set1_ps(deltaTimeInSeconds);
+
+	for (size_t particleIndex = 0; particleIndex < numberOfSIMDParticles; particleIndex += PARTICLE_SIMD_WIDTH)
+	{
+		__m128 particleAge = _mm_add_ps(_mm_load_ps(m_Age + particleIndex), deltaTime);
+		_mm_store_ps(m_Age + particleIndex, particleAge);
+
+		__m128 velocityX = _mm_add_ps(_mm_load_ps(m_VelocityX + particleIndex), _mm_mul_ps(_mm_load_ps(m_AccelerationX + particleIndex), deltaTime));
+		__m128 velocityY = _mm_add_ps(_mm_load_ps(m_VelocityY + particleIndex), _mm_mul_ps(_mm_load_ps(m_AccelerationY + particleIndex), deltaTime));
+		_mm_store_ps(m_VelocityX + particleIndex, velocityX);
+		_mm_store_ps(m_VelocityY + particleIndex, velocityY);
+
+		_mm_store_ps(m_PositionX + particleIndex, _mm_add_ps(_mm_load_ps(m_PositionX + particleIndex), _mm_mul_ps(velocityX, deltaTime)));
+		_mm_store_ps(m_PositionY + particleIndex, _mm_add_ps(_mm_load_ps(m_PositionY + particleIndex), _mm_mul_ps(velocityY, deltaTime)));
+	}
+
+	for (size_t particleIndex = numberOfSIMDParticles; particleIndex < m_NumberOfParticles; ++particleIndex)
+	{
+		m_Age[particleIndex] += deltaTimeInSeconds;
+		m_VelocityX[particleIndex] += m_AccelerationX[particleIndex] * deltaTimeInSeconds;
+		m_VelocityY[particleIndex] += m_AccelerationY[particleIndex] * deltaTimeInSeconds;
+		m_PositionX[particleIndex] += m_VelocityX[particleIndex] * deltaTimeInSeconds;
+		m_PositionY[particleIndex] += m_VelocityY[particleIndex] * deltaTimeInSeconds;
+	}
+}
+
+
+
+void ParticlePool::FadeParticles(float maximumAlphaValue)
+{
+	size_t numberOfSIMDParticles = m_NumberOfParticles - (m_NumberOfParticles % PARTICLE_SIMD_WIDTH);
+	__m128 maximumAlpha = _mm_set1_ps(maximumAlphaValue);
+	__m128 zero = _mm_setzero_ps();
+
+	for (size_t particleIndex = 0; particleIndex < numberOfSIMDParticles; particleIndex += PARTICLE_SIMD_WIDTH)
+	{
+		__m128 particleLifeTime = _mm_load_ps(m_LifeTime + particleIndex);
+		__m128 clampedAge = _mm_min_ps(_mm_max_ps(_mm_load_ps(m_Age + particleIndex), zero), particleLifeTime);
+		__m128 remainingRatio = _mm_sub_ps(particleLifeTime, clampedAge);
+		_mm_store_ps(m_Alpha + particleIndex, _mm_div_ps(_mm_mul_ps(maximumAlpha, remainingRatio), particleLifeTime));
+	}
+
+	for (size_t particleIndex = numberOfSIMDParticles; particleIndex < m_NumberOfParticles; ++particleIndex)
+	{
+		float particleLifeTime = m_LifeTime[particleIndex];
+		float clampedAge = m_Age[particleIndex];
+		clampedAge = (clampedAge < 0.0f) ? 0.0f : clampedAge;
+		clampedAge = (clampedAge > particleLifeTime) ? particleLifeTime : clampedAge;
+		m_Alpha[particleIndex] = (maximumAlphaValue * (particleLifeTime - clampedAge)) / particleLifeTime;
+	}
+}
+
+
+
+size_t ParticlePool::RemoveDeadParticles()
+{
+	size_t numberOfRemovedParticles = 0U;
+	size_t particleIndex = 0U;
+
+	while (particleIndex < m_NumberOfParticles)
+	{
+		if (m_Age[particleIndex] >= m_LifeTime[particleIndex])
+		{
+			--m_NumberOfParticles;
+			CopyParticle(particleIndex, m_NumberOfParticles);
+			++numberOfRemovedParticles;
+			continue;
+		}
+
+		++particleIndex;
+	}
+
+	return numberOfRemovedParticles;
+}
+
+
+
+void ParticlePool::WriteQuads(Vertex3D* quadVertices, uint32_t* quadIndices, const Vector2& particleMinimums, const Vector2& particleMaximums, const AABB2& textureCoordinates) const
+{
+	for (size_t particleIndex = 0; particleIndex < m_NumberOfParticles; ++particleIndex)
+	{
+		uint32_t firstVertex = static_cast<uint32_t>(particleIndex * 4U);
+		uint32_t* particleIndices = quadIndices + (particleIndex * 6U);
+		particleIndices[0] = firstVertex + 0;
+		particleIndices[1] = firstVertex + 1;
+		particleIndices[2] = firstVertex + 2;
+		particleIndices[3] = firstVertex + 2;
+		particleIndices[4] = firstVertex + 3;
+		particleIndices[5] = firstVertex + 0;
+
+		RGBA particleTint = m_Tint[particleIndex];
+		particleTint.m_Alpha = static_cast<unsigned char>(m_Alpha[particleIndex]);
+
+		float particleScale = m_Scale[particleIndex];
+		float minimumX = m_PositionX[particleIndex] + (particleMinimums.X * particleScale);
+		float minimumY = m_PositionY[particleIndex] + (particleMinimums.Y * particleScale);
+		float maximumX = m_PositionX[particleIndex] + (particleMaximums.X * particleScale);
+		float maximumY = m_PositionY[particleIndex] + (particleMaximums.Y * particleScale);
+
+		Vertex3D* particleVertices = quadVertices + firstVertex;
+		particleVertices[0].m_Position = Vector3(minimumX, minimumY, 0.0f);
+		particleVertices[0].m_TextureCoordinates = Vector2(textureCoordinates.minimums.X, textureCoordinates.maximums.Y);
+		particleVertices[1].m_Position = Vector3(maximumX, minimumY, 0.0f);
+		particleVertices[1].m_TextureCoordinates = Vector2(textureCoordinates.maximums.X, textureCoordinates.maximums.Y);
+		particleVertices[2].m_Position = Vector3(maximumX, maximumY, 0.0f);
+		particleVertices[2].m_TextureCoordinates = Vector2(textureCoordinates.maximums.X, textureCoordinates.minimums.Y);
+		particleVertices[3].m_Position = Vector3(minimumX, maximumY, 0.0f);
+		particleVertices[3].m_TextureCoordinates = Vector2(textureCoordinates.minimums.X, textureCoordinates.minimums.Y);
+
+		for (size_t cornerIndex = 0; cornerIndex < 4; ++cornerIndex)
+		{
+			particleVertices[cornerIndex].m_Color = particleTint;
+		}
+	}
+}
+
+
+
+size_t ParticlePool::GetNumberOfParticles() const
+{
+	return m_NumberOfParticles;
+}
+
+
+
+bool ParticlePool::IsEmpty() const
+{
+	return (m_NumberOfParticles == 0U);
+}
+
+
+
+void ParticlePool::CopyParticle(size_t destinationIndex, size_t sourceIndex)
+{
+	m_PositionX[destinationIndex] = m_PositionX[sourceIndex];
+	m_PositionY[destinationIndex] = m_PositionY[sourceIndex];
+	m_VelocityX[destinationIndex] = m_VelocityX[sourceIndex];
+	m_VelocityY[destinationIndex] = m_VelocityY[sourceIndex];
+	m_AccelerationX[destinationIndex] = m_AccelerationX[sourceIndex];
+	m_AccelerationY[destinationIndex] = m_AccelerationY[sourceIndex];
+	m_Scale[destinationIndex] = m_Scale[sourceIndex];
+	m_Age[destinationIndex] = m_Age[sourceIndex];
+	m_LifeTime[destinationIndex] = m_LifeTime[sourceIndex];
+	m_Alpha[destinationIndex] = m_Alpha[sourceIndex];
+	m_Tint[destinationIndex] = m_Tint[sourceIndex];
+}
\ No newline at end of file
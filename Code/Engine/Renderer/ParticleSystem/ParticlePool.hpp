@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Engine/Renderer/ParticleSystem/Particle.hpp"
+#include "Engine/Renderer/Vertex/Vertex.hpp"
+#include "Engine/Math/VectorMath/2D/AABB2.hpp"
+
+
+
+const size_t INITIAL_PARTICLE_POOL_CAPACITY = 256;
+const size_t PARTICLE_POOL_ALIGNMENT = 16;
+const size_t PARTICLE_SIMD_WIDTH = 4;
+
+
+
+class ParticlePool
+{
+public:
+	ParticlePool();
+	ParticlePool(const ParticlePool&) = delete;
+	ParticlePool& operator=(const ParticlePool&) = delete;
+	~ParticlePool();
+
+	void Reserve(size_t newCapacity);
+	void Clear();
+
+	size_t AddParticle(const Vector2& spawnPosition, float particleScale, const Vector2& particleVelocity, const Vector2& particleAcceleration, float particleLifeTime, const RGBA& particleTint);
+	Particle GetParticle(size_t particleIndex) const;
+
+	void IntegrateParticles(float deltaTimeInSeconds);
+	void FadeParticles(float maximumAlphaValue);
+	size_t RemoveDeadParticles();
+	void WriteQuads(Vertex3D* quadVertices, uint32_t* quadIndices, const Vector2& particleMinimums, const Vector2& particleMaximums, const AABB2& textureCoordinates) const;
+
+	size_t GetNumberOfParticles() const;
+	bool IsEmpty() const;
+
+private:
+	void CopyParticle(size_t destinationIndex, size_t sourceIndex);
+
+public:
+	float* m_PositionX;
+	float* m_PositionY;
+	float* m_VelocityX;
+	float* m_VelocityY;
+	float* m_AccelerationX;
+	float* m_AccelerationY;
+	float* m_Scale;
+	float* m_Age;
+	float* m_LifeTime;
+	float* m_Alpha;
+	RGBA* m_Tint;
+
+	size_t m_NumberOfParticles;
+	size_t m_Capacity;
+};
\ No newline at end of file
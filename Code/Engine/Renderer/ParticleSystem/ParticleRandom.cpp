@@ -0,0 +1,54 @@
+#include "Engine/Renderer/ParticleSystem/ParticleRandom.hpp"
+
+
+
+ParticleRandom::ParticleRandom(uint64_t randomSeed /*= 0U*/)
+{
+	SetSeed(randomSeed);
+}
+
+
+
+void ParticleRandom::SetSeed(uint64_t randomSeed)
+{
+	m_State = randomSeed ^ 0x9E3779B97F4A7C15ULL;
+	if (m_State == 0U)
+	{
+		m_State = 0x9E3779B97F4A7C15ULL;
+	}
+}
+
+
+
+uint32_t ParticleRandom::GetNextInteger()
+{
+	m_State ^= m_State >> 12;
+	m_State ^= m_State << 25;
+	m_State ^= m_State >> 27;
+
+	return static_cast<uint32_t>((m_State * 0x2545F4914F6CDD1DULL) >> 32);
+}
+
+
+
+float ParticleRandom::GetNextFloat()
+{
+	return static_cast<float>(GetNextInteger() >> 8) / static_cast<float>(1U << 24);
+}
+
+
+
+float ParticleRandom::GetFloatWithinRange(float rangeMinimum, float rangeMaximum)
+{
+	return rangeMinimum + ((rangeMaximum - rangeMinimum) * GetNextFloat());
+}
+
+
+
+Vector2 ParticleRandom::GetVector2WithinRange(const Vector2& rangeMinimum, const Vector2& rangeMaximum)
+{
+	float randomX = GetFloatWithinRange(rangeMinimum.X, rangeMaximum.X);
+	float randomY = GetFloatWithinRange(rangeMinimum.Y, rangeMaximum.Y);
+
+	return Vector2(randomX, randomY);
+}
\ No newline at end of file
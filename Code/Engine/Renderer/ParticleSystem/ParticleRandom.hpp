@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "Engine/Math/VectorMath/2D/Vector2.hpp"
+
+
+
+class ParticleRandom
+{
+public:
+	ParticleRandom(uint64_t randomSeed = 0U);
+
+	void SetSeed(uint64_t randomSeed);
+	uint32_t GetNextInteger();
+	float GetNextFloat();
+
+	float GetFloatWithinRange(float rangeMinimum, float rangeMaximum);
+	Vector2 GetVector2WithinRange(const Vector2& rangeMinimum, const Vector2& rangeMaximum);
+
+private:
+	uint64_t m_State;
+};
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Engine/Renderer/ParticleSystem/ParticleSystem.hpp"
 #include "Engine/Renderer/ParticleSystem/ParticleSystemDatabase.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
 
 
 
@@ -7,6 +8,8 @@ ParticleSystem::ParticleSystem(const char* definitionID, const Vector2& spawnPos
 m_ParticleSystemDefinition(ParticleSystemDatabase::SingletonInstance()->GetEditableParticleSystemDefinition(definitionID)),
 m_HasTerminated(false)
 {
+	MEMORY_SCOPE("Particles");
+
 	for (ParticleEmitterDefinition* currentEmitterDefinition : m_ParticleSystemDefinition->m_EmitterDefinitions)
 	{
 		ParticleEmitter* particleEmitter = ParticleEmitter::CreateParticleEmitterFromDefinition(currentEmitterDefinition, spawnPosition);
@@ -53,21 +56,25 @@ void ParticleSystem::SpawnInitialParticles()
 
 
 
-void ParticleSystem::Update(float deltaTimeInSeconds)
+void ParticleSystem::PrepareCommands(size_t* numberOfVertices, size_t* numberOfIndices) const
 {
+	size_t numberOfParticles = 0U;
 	for (ParticleEmitter* currentParticleEmitter : m_ParticleEmitters)
 	{
-		currentParticleEmitter->Update(deltaTimeInSeconds);
+		numberOfParticles += currentParticleEmitter->m_Particles.GetNumberOfParticles();
 	}
+
+	*numberOfVertices = numberOfParticles * 4U;
+	*numberOfIndices = numberOfParticles * 6U;
 }
 
 
 
-void ParticleSystem::Render() const
+void ParticleSystem::RecordCommands(RenderCommandBuffer& commandBuffer, uint8_t layerID) const
 {
 	for (ParticleEmitter* currentParticleEmitter : m_ParticleEmitters)
 	{
-		currentParticleEmitter->Render();
+		currentParticleEmitter->Render(commandBuffer, layerID);
 	}
 }
 
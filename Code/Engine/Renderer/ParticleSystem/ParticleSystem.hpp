@@ -6,7 +6,7 @@
 
 
 
-class ParticleSystem
+class ParticleSystem : public RenderCommandRecorder
 {
 private:
 	ParticleSystem(const char* definitionID, const Vector2& spawnPosition);
@@ -18,8 +18,8 @@ public:
 
 	void SpawnInitialParticles();
 
-	void Update(float deltaTimeInSeconds);
-	void Render() const;
+	virtual void PrepareCommands(size_t* numberOfVertices, size_t* numberOfIndices) const override;
+	virtual void RecordCommands(RenderCommandBuffer& commandBuffer, uint8_t layerID) const override;
 
 	bool HasTerminated() const;
 	void TerminateSystem();
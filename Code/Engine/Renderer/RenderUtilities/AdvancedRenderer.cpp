@@ -1,3 +1,6 @@
+#include <string.h>
+#include <algorithm>
+
 #include "Engine/Renderer/OpenGL/OpenGLExtensions.hpp"
 #include "Engine/Renderer/RenderUtilities/AdvancedRenderer.hpp"
 #include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
@@ -11,7 +14,8 @@ AdvancedRenderer* g_AdvancedRenderer = nullptr;
 
 AdvancedRenderer::AdvancedRenderer() :
 MasterRenderer(),
-m_WindowDimensions(IntVector2::ZERO)
+m_WindowDimensions(IntVector2::ZERO),
+m_IsStreamingFrameOpen(false)
 {
 	InitializeOpenGL();
 
@@ -20,9 +24,16 @@ m_WindowDimensions(IntVector2::ZERO)
 
 	m_DefaultMaterial = new Material("Data/Shaders/DefaultShader.vert", "Data/Shaders/DefaultShader.frag");
 	m_DefaultMaterial->SetDiffuseTexture(m_DefaultTexture);
+	m_TextMaterial = new Material(*m_DefaultMaterial);
 
 	m_DefaultMesh = new Mesh();
 	m_MeshRenderer = new MeshRenderer(m_DefaultMesh, m_DefaultMaterial);
+
+	m_StreamingMesh = new Mesh();
+	m_StreamingMesh->m_VertexBufferObject->CreateStreamingBuffer(GL_ARRAY_BUFFER, STREAMING_VERTEX_BUFFER_SIZE);
+	m_StreamingMesh->m_IndexBufferObject->CreateStreamingBuffer(GL_ELEMENT_ARRAY_BUFFER, STREAMING_INDEX_BUFFER_SIZE);
+
+	m_TextMesh = new Mesh();
 }
 
 
@@ -30,7 +41,10 @@ m_WindowDimensions(IntVector2::ZERO)
 AdvancedRenderer::~AdvancedRenderer()
 {
 	delete m_DefaultMesh;
+	delete m_StreamingMesh;
+	delete m_TextMesh;
 	delete m_DefaultMaterial;
+	delete m_TextMaterial;
 	delete m_DefaultTexture;
 	delete m_MeshRenderer;
 }
@@ -43,6 +57,16 @@ void AdvancedRenderer::InitializeOpenGL()
 	glBindBuffer = (PFNGLBINDBUFFERPROC)wglGetProcAddress("glBindBuffer");
 	glBufferData = (PFNGLBUFFERDATAPROC)wglGetProcAddress("glBufferData");
 	glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)wglGetProcAddress("glDeleteBuffers");
+	glBufferSubData = (PFNGLBUFFERSUBDATAPROC)wglGetProcAddress("glBufferSubData");
+	glBufferStorage = (PFNGLBUFFERSTORAGEPROC)wglGetProcAddress("glBufferStorage");
+	glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)wglGetProcAddress("glMapBufferRange");
+	glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)wglGetProcAddress("glUnmapBuffer");
+
+	glFenceSync = (PFNGLFENCESYNCPROC)wglGetProcAddress("glFenceSync");
+	glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)wglGetProcAddress("glClientWaitSync");
+	glDeleteSync = (PFNGLDELETESYNCPROC)wglGetProcAddress("glDeleteSync");
+
+	glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)wglGetProcAddress("glDrawElementsBaseVertex");
 
 	glActiveTexture = (PFNGLACTIVETEXTUREPROC)wglGetProcAddress("glActiveTexture");
 
@@ -66,8 +90,10 @@ void AdvancedRenderer::InitializeOpenGL()
 	glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)wglGetProcAddress("glDeleteVertexArrays");
 	glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)wglGetProcAddress("glGetAttribLocation");
 	glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)wglGetProcAddress("glEnableVertexAttribArray");
+	glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)wglGetProcAddress("glDisableVertexAttribArray");
 	glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)wglGetProcAddress("glVertexAttribPointer");
 	glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)wglGetProcAddress("glVertexAttribIPointer");
+	glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)wglGetProcAddress("glVertexAttrib4f");
 
 	glUseProgram = (PFNGLUSEPROGRAMPROC)wglGetProcAddress("glUseProgram");
 
@@ -155,6 +181,29 @@ void AdvancedRenderer::UpdateProjectionMatrix(const Matrix4& projectionMatrix)
 
 
 
+void AdvancedRenderer::PushMatrices()
+{
+	m_MatrixStack.push_back(m_ModelMatrix);
+	m_MatrixStack.push_back(m_ViewMatrix);
+	m_MatrixStack.push_back(m_ProjectionMatrix);
+}
+
+
+
+void AdvancedRenderer::PopMatrices()
+{
+	ASSERT_OR_DIE(m_MatrixStack.size() >= 3U, "Matrix stack is empty.");
+
+	m_ProjectionMatrix = m_MatrixStack.back();
+	m_MatrixStack.pop_back();
+	m_ViewMatrix = m_MatrixStack.back();
+	m_MatrixStack.pop_back();
+	m_ModelMatrix = m_MatrixStack.back();
+	m_MatrixStack.pop_back();
+}
+
+
+
 Matrix4 AdvancedRenderer::GetModelMatrix(const Vector3& scalingFactor, const EulerAngles& rotationAngles, const Vector3& translationDisplacement)
 {
 	Matrix4 modelMatrix = Matrix4::IdentityMatrix4();
@@ -326,10 +375,60 @@ void AdvancedRenderer::DrawMeshWithVAO(Mesh* drawableMesh, Material* meshMateria
 
 
 
+void AdvancedRenderer::BeginStreamingFrame()
+{
+	m_StreamingMesh->m_VertexBufferObject->BeginStreamingFrame();
+	m_StreamingMesh->m_IndexBufferObject->BeginStreamingFrame();
+	m_IsStreamingFrameOpen = true;
+}
+
+
+
+void AdvancedRenderer::EndStreamingFrame()
+{
+	m_StreamingMesh->m_VertexBufferObject->EndStreamingFrame();
+	m_StreamingMesh->m_IndexBufferObject->EndStreamingFrame();
+	m_IsStreamingFrameOpen = false;
+}
+
+
+
+bool AdvancedRenderer::AllocateStreamingMesh(size_t numberOfVertices, size_t numberOfIndices, StreamingMeshAllocation* meshAllocation)
+{
+	meshAllocation->m_NumberOfVertices = numberOfVertices;
+	meshAllocation->m_NumberOfIndices = numberOfIndices;
+
+	meshAllocation->m_Vertices = (Vertex3D*)m_StreamingMesh->m_VertexBufferObject->AllocateStreamingSpace(numberOfVertices * sizeof(Vertex3D), sizeof(Vertex3D), &meshAllocation->m_VertexOffset);
+	if (meshAllocation->m_Vertices == nullptr)
+	{
+		return false;
+	}
+
+	meshAllocation->m_Indices = (uint32_t*)m_StreamingMesh->m_IndexBufferObject->AllocateStreamingSpace(numberOfIndices * sizeof(uint32_t), sizeof(uint32_t), &meshAllocation->m_IndexOffset);
+	return (meshAllocation->m_Indices != nullptr);
+}
+
+
+
+void AdvancedRenderer::DrawStreamingMesh(const StreamingMeshAllocation& meshAllocation, Material* meshMaterial /*= nullptr*/)
+{
+	size_t vertexBytes = meshAllocation.m_NumberOfVertices * sizeof(Vertex3D);
+	size_t indexBytes = meshAllocation.m_NumberOfIndices * sizeof(uint32_t);
+	m_StreamingMesh->m_VertexBufferObject->FlushStreamingSpace(meshAllocation.m_VertexOffset, vertexBytes);
+	m_StreamingMesh->m_IndexBufferObject->FlushStreamingSpace(meshAllocation.m_IndexOffset, indexBytes);
+
+	size_t startIndex = meshAllocation.m_IndexOffset / sizeof(uint32_t);
+	int baseVertex = static_cast<int>(meshAllocation.m_VertexOffset / sizeof(Vertex3D));
+	m_StreamingMesh->SetSingleRenderInstruction(meshAllocation.m_NumberOfVertices, meshAllocation.m_NumberOfIndices, TRIANGLES_PRIMITIVE, startIndex, baseVertex);
+
+	DrawMeshWithVAO(m_StreamingMesh, meshMaterial);
+}
+
+
+
 void AdvancedRenderer::DrawPointsMesh(Mesh* pointsMesh, size_t numberOfVertices, size_t numberOfIndices, float pointSize /*= 1.0f*/)
 {
-	pointsMesh->m_RenderInstructions.clear();
-	pointsMesh->AddRenderInstruction(numberOfVertices, numberOfIndices, POINTS_PRIMITIVE);
+	pointsMesh->SetSingleRenderInstruction(numberOfVertices, numberOfIndices, POINTS_PRIMITIVE);
 	
 	SetPointSize(pointSize);
 	DrawMeshWithVAO(pointsMesh);
@@ -339,8 +438,7 @@ void AdvancedRenderer::DrawPointsMesh(Mesh* pointsMesh, size_t numberOfVertices,
 
 void AdvancedRenderer::DrawLinesMesh(Mesh* linesMesh, size_t numberOfVertices, size_t numberOfIndices, float lineThickness /*= 1.0f*/)
 {
-	linesMesh->m_RenderInstructions.clear();
-	linesMesh->AddRenderInstruction(numberOfVertices, numberOfIndices, LINES_PRIMITIVE);
+	linesMesh->SetSingleRenderInstruction(numberOfVertices, numberOfIndices, LINES_PRIMITIVE);
 	
 	SetLineWidth(lineThickness);
 	DrawMeshWithVAO(linesMesh);
@@ -350,8 +448,7 @@ void AdvancedRenderer::DrawLinesMesh(Mesh* linesMesh, size_t numberOfVertices, s
 
 void AdvancedRenderer::DrawLineLoopMesh(Mesh* lineLoopMesh, size_t numberOfVertices, size_t numberOfIndices, float lineThickness /*= 1.0f*/)
 {
-	lineLoopMesh->m_RenderInstructions.clear();
-	lineLoopMesh->AddRenderInstruction(numberOfVertices, numberOfIndices, LINE_LOOP_PRIMITIVE);
+	lineLoopMesh->SetSingleRenderInstruction(numberOfVertices, numberOfIndices, LINE_LOOP_PRIMITIVE);
 	
 	SetLineWidth(lineThickness);
 	DrawMeshWithVAO(lineLoopMesh);
@@ -361,8 +458,7 @@ void AdvancedRenderer::DrawLineLoopMesh(Mesh* lineLoopMesh, size_t numberOfVerti
 
 void AdvancedRenderer::DrawPolygonMesh(Mesh* polygonMesh, size_t numberOfVertices, size_t numberOfIndices, Material* meshMaterial /*= nullptr*/)
 {
-	polygonMesh->m_RenderInstructions.clear();
-	polygonMesh->AddRenderInstruction(numberOfVertices, numberOfIndices, TRIANGLES_PRIMITIVE);
+	polygonMesh->SetSingleRenderInstruction(numberOfVertices, numberOfIndices, TRIANGLES_PRIMITIVE);
 	
 	DrawMeshWithVAO(polygonMesh, meshMaterial);
 }
@@ -383,22 +479,30 @@ void AdvancedRenderer::TriangulatePolygon(size_t numberOfVertices, std::vector<u
 
 void AdvancedRenderer::Draw2DMonospacedText(const Vector2& startingLetterMinimums, const char* asciiText, float cellHeight, float cellAspectRatio, const MonospaceFont* font /*= nullptr*/, const RGBA& textTint /*= RGBA::WHITE*/)
 {
-	Mesh textMesh;
-	Material textMaterial = *m_DefaultMaterial;
-	textMaterial.SetDiffuseTexture(font->GetFontTexture());
+	size_t textLength = strlen(asciiText);
+	size_t numberOfGlyphs = textLength - std::count(asciiText, asciiText + textLength, '\n');
+	if (numberOfGlyphs == 0U)
+	{
+		return;
+	}
+
+	StreamingMeshAllocation textAllocation;
+	if (!AllocateTextMesh(numberOfGlyphs * 4U, numberOfGlyphs * 6U, &textAllocation))
+	{
+		return;
+	}
 
-	std::vector<Vertex3D> textVertices;
-	std::vector<uint32_t> textIndices;
+	Vertex3D* textVertices = textAllocation.m_Vertices;
+	uint32_t* textIndices = textAllocation.m_Indices;
 
 	Vertex3D textVertex;
 	textVertex.m_Color = textTint;
-	Vector3 letterBoundingPoint = Vector3::ZERO;
 
 	float cellWidth = cellHeight * cellAspectRatio;
 	Vector2 cellDimensions(cellWidth, cellHeight);
 	Vector2 letterMinimums = startingLetterMinimums;
 
-	size_t textLength = strlen(asciiText);
+	uint32_t letterStartingIndex = 0U;
 	for (size_t glyphIndex = 0; glyphIndex < textLength; ++glyphIndex)
 	{
 		char asciiGlyph = asciiText[glyphIndex];
@@ -409,153 +513,116 @@ void AdvancedRenderer::Draw2DMonospacedText(const Vector2& startingLetterMinimum
 			continue;
 		}
 
-		uint32_t letterStartingIndex = textVertices.size();
-
 		AABB2 glyphTextureCoordinates = font->GetTextureCoordsForGlyph(asciiGlyph);
 		Vector2 textureMinimums = glyphTextureCoordinates.minimums;
 		Vector2 textureMaximums = glyphTextureCoordinates.maximums;
 
 		Vector2 letterMaximums = letterMinimums + cellDimensions;
 
-		letterBoundingPoint.X = letterMinimums.X;
-		letterBoundingPoint.Y = letterMinimums.Y;
-		textVertex.m_Position = letterBoundingPoint;
+		textVertex.m_Position = Vector3(letterMinimums.X, letterMinimums.Y, 0.0f);
 		textVertex.m_TextureCoordinates = Vector2(textureMinimums.X, textureMaximums.Y);
-		textVertices.push_back(textVertex);
+		*textVertices++ = textVertex;
 
-		letterBoundingPoint.X = letterMaximums.X;
-		letterBoundingPoint.Y = letterMinimums.Y;
-		textVertex.m_Position = letterBoundingPoint;
+		textVertex.m_Position = Vector3(letterMaximums.X, letterMinimums.Y, 0.0f);
 		textVertex.m_TextureCoordinates = Vector2(textureMaximums.X, textureMaximums.Y);
-		textVertices.push_back(textVertex);
+		*textVertices++ = textVertex;
 
-		letterBoundingPoint.X = letterMaximums.X;
-		letterBoundingPoint.Y = letterMaximums.Y;
-		textVertex.m_Position = letterBoundingPoint;
+		textVertex.m_Position = Vector3(letterMaximums.X, letterMaximums.Y, 0.0f);
 		textVertex.m_TextureCoordinates = Vector2(textureMaximums.X, textureMinimums.Y);
-		textVertices.push_back(textVertex);
+		*textVertices++ = textVertex;
 
-		letterBoundingPoint.X = letterMinimums.X;
-		letterBoundingPoint.Y = letterMaximums.Y;
-		textVertex.m_Position = letterBoundingPoint;
+		textVertex.m_Position = Vector3(letterMinimums.X, letterMaximums.Y, 0.0f);
 		textVertex.m_TextureCoordinates = Vector2(textureMinimums.X, textureMinimums.Y);
-		textVertices.push_back(textVertex);
+		*textVertices++ = textVertex;
 
-		textIndices.push_back(letterStartingIndex + 0);
-		textIndices.push_back(letterStartingIndex + 1);
-		textIndices.push_back(letterStartingIndex + 2);
-		textIndices.push_back(letterStartingIndex + 0);
-		textIndices.push_back(letterStartingIndex + 2);
-		textIndices.push_back(letterStartingIndex + 3);
+		*textIndices++ = letterStartingIndex + 0;
+		*textIndices++ = letterStartingIndex + 1;
+		*textIndices++ = letterStartingIndex + 2;
+		*textIndices++ = letterStartingIndex + 0;
+		*textIndices++ = letterStartingIndex + 2;
+		*textIndices++ = letterStartingIndex + 3;
 
+		letterStartingIndex += 4U;
 		letterMinimums.X += cellWidth;
 	}
 
-	size_t numberOfVertices = textVertices.size();
-	size_t numberOfIndices = textIndices.size();
-
-	textMesh.WriteToMesh(&textVertices[0], &textIndices[0], numberOfVertices, numberOfIndices);
-	DrawPolygonMesh(&textMesh, numberOfVertices, numberOfIndices, &textMaterial);
+	m_TextMaterial->SetDiffuseTexture(font->GetFontTexture());
+	DrawTextMesh(textAllocation);
 }
 
 
 
 void AdvancedRenderer::Draw2DProportionalText(const Vector2& startingLetterMinimums, const char* asciiText, float cellHeight, const ProportionalFont* font /*= nullptr*/, const RGBA& textTint /*= RGBA::WHITE*/)
 {
-	Mesh textMesh;
-	Material textMaterial = *m_DefaultMaterial;
-
-	std::vector<Vertex3D> textVertices;
-	std::vector<uint32_t> textIndices;
-
-	Vertex3D textVertex;
-	textVertex.m_Color = textTint;
-	Vector3 letterBoundingPoint = Vector3::ZERO;
-	
-	Vector2 cursorPosition = startingLetterMinimums;
-	cursorPosition.Y += cellHeight;
+	const TextLayout* textLayout = TextLayoutCache::CreateOrGetTextLayout(asciiText, cellHeight, font);
+	DrawTextLayout(textLayout, startingLetterMinimums, textTint);
+}
 
-	float textScale = font->GetCharacterScaleForCellHeight(cellHeight);
 
-	ProportionalGlyph* previousGlyph = nullptr;
 
-	size_t textLength = strlen(asciiText);
-	for (size_t glyphIndex = 0; glyphIndex < textLength; ++glyphIndex)
+void AdvancedRenderer::DrawTextLayout(const TextLayout* textLayout, const Vector2& startingLetterMinimums, const RGBA& textTint /*= RGBA::WHITE*/)
+{
+	if (textLayout->m_GlyphRuns.empty())
 	{
-		char asciiGlyph = asciiText[glyphIndex];
-		ProportionalGlyph* currentGlyph = font->GetProportionalGlyphForGlyphUnicode(asciiGlyph);
-		if (currentGlyph == nullptr)
-		{
-			continue;
-		}
+		return;
+	}
 
-		float currentGlyphKerning = 0.0f;
-		if (previousGlyph != nullptr && currentGlyph != nullptr)
-		{
-			currentGlyphKerning = font->GetKerningForGlyphPair(previousGlyph->m_glyphUnicode, currentGlyph->m_glyphUnicode);
-		}
+	if (textLayout->m_LayoutMesh == nullptr)
+	{
+		textLayout->m_LayoutMesh = new Mesh(textLayout->m_Vertices.data(), textLayout->m_Indices.data(), textLayout->m_Vertices.size(), textLayout->m_Indices.size());
+	}
 
-		cursorPosition.X += currentGlyphKerning * textScale;
+	PushMatrices();
+	UpdateModelMatrix(GetTranslationMatrix(Vector3(startingLetterMinimums.X, startingLetterMinimums.Y, 0.0f)) * m_ModelMatrix);
 
-		Vector2 glyphOffset = currentGlyph->GetOffset();
-		Vector2 glyphSize = currentGlyph->GetSize();
+	m_MeshRenderer->SetMesh(textLayout->m_LayoutMesh);
+	m_MeshRenderer->SetMaterial(m_TextMaterial);
+	m_MeshRenderer->SetConstantVertexColor(textTint);
 
-		Vector2 letterMinimums;
-		Vector2 letterMaximums;
+	for (const TextGlyphRun& currentRun : textLayout->m_GlyphRuns)
+	{
+		textLayout->m_LayoutMesh->SetSingleRenderInstruction(currentRun.m_NumberOfVertices, currentRun.m_NumberOfIndices, TRIANGLES_PRIMITIVE, currentRun.m_FirstIndex, static_cast<int>(currentRun.m_FirstVertex));
+		m_TextMaterial->SetDiffuseTexture(currentRun.m_GlyphTexture);
+		m_MeshRenderer->RenderMeshWithMaterial(m_ModelMatrix, m_ViewMatrix, m_ProjectionMatrix);
+	}
 
-		letterMinimums.X = cursorPosition.X + (glyphOffset.X * textScale);
-		letterMaximums.Y = cursorPosition.Y - (glyphOffset.Y * textScale);
+	PopMatrices();
+}
 
-		letterMaximums.X = letterMinimums.X + (glyphSize.X * textScale);
-		letterMinimums.Y = letterMaximums.Y - (glyphSize.Y * textScale);
 
-		textMaterial.SetDiffuseTexture(font->GetFontTextureForGlyph(*currentGlyph));
-		AABB2 glyphTextureBounds = font->GetTextureBoundsForGlyph(*currentGlyph);
-		Vector2 textureMinimums = glyphTextureBounds.minimums;
-		Vector2 textureMaximums = glyphTextureBounds.maximums;
 
-		uint32_t letterStartingIndex = textVertices.size();
+bool AdvancedRenderer::AllocateTextMesh(size_t numberOfVertices, size_t numberOfIndices, StreamingMeshAllocation* meshAllocation)
+{
+	if (m_IsStreamingFrameOpen)
+	{
+		return AllocateStreamingMesh(numberOfVertices, numberOfIndices, meshAllocation);
+	}
 
-		letterBoundingPoint.X = letterMinimums.X;
-		letterBoundingPoint.Y = letterMinimums.Y;
-		textVertex.m_Position = letterBoundingPoint;
-		textVertex.m_TextureCoordinates = Vector2(textureMinimums.X, textureMaximums.Y);
-		textVertices.push_back(textVertex);
+	m_TextVertices.resize(numberOfVertices);
+	m_TextIndices.resize(numberOfIndices);
 
-		letterBoundingPoint.X = letterMaximums.X;
-		letterBoundingPoint.Y = letterMinimums.Y;
-		textVertex.m_Position = letterBoundingPoint;
-		textVertex.m_TextureCoordinates = Vector2(textureMaximums.X, textureMaximums.Y);
-		textVertices.push_back(textVertex);
+	meshAllocation->m_Vertices = m_TextVertices.data();
+	meshAllocation->m_Indices = m_TextIndices.data();
+	meshAllocation->m_NumberOfVertices = numberOfVertices;
+	meshAllocation->m_NumberOfIndices = numberOfIndices;
+	meshAllocation->m_VertexOffset = 0U;
+	meshAllocation->m_IndexOffset = 0U;
 
-		letterBoundingPoint.X = letterMaximums.X;
-		letterBoundingPoint.Y = letterMaximums.Y;
-		textVertex.m_Position = letterBoundingPoint;
-		textVertex.m_TextureCoordinates = Vector2(textureMaximums.X, textureMinimums.Y);
-		textVertices.push_back(textVertex);
+	return true;
+}
 
-		letterBoundingPoint.X = letterMinimums.X;
-		letterBoundingPoint.Y = letterMaximums.Y;
-		textVertex.m_Position = letterBoundingPoint;
-		textVertex.m_TextureCoordinates = Vector2(textureMinimums.X, textureMinimums.Y);
-		textVertices.push_back(textVertex);
 
-		textIndices.push_back(letterStartingIndex + 0);
-		textIndices.push_back(letterStartingIndex + 1);
-		textIndices.push_back(letterStartingIndex + 2);
-		textIndices.push_back(letterStartingIndex + 0);
-		textIndices.push_back(letterStartingIndex + 2);
-		textIndices.push_back(letterStartingIndex + 3);
 
-		cursorPosition.X += currentGlyph->GetAdvance().X * textScale;
-		previousGlyph = currentGlyph;
+void AdvancedRenderer::DrawTextMesh(const StreamingMeshAllocation& meshAllocation)
+{
+	if (m_IsStreamingFrameOpen)
+	{
+		DrawStreamingMesh(meshAllocation, m_TextMaterial);
+		return;
 	}
 
-	size_t numberOfVertices = textVertices.size();
-	size_t numberOfIndices = textIndices.size();
-
-	textMesh.WriteToMesh(&textVertices[0], &textIndices[0], numberOfVertices, numberOfIndices);
-	DrawPolygonMesh(&textMesh, numberOfVertices, numberOfIndices, &textMaterial);
+	m_TextMesh->WriteToMesh(meshAllocation.m_Vertices, meshAllocation.m_Indices, meshAllocation.m_NumberOfVertices, meshAllocation.m_NumberOfIndices);
+	DrawPolygonMesh(m_TextMesh, meshAllocation.m_NumberOfVertices, meshAllocation.m_NumberOfIndices, m_TextMaterial);
 }
 
 
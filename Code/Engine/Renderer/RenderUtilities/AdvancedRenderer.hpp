@@ -3,11 +3,29 @@
 #include "Engine/Renderer/RenderUtilities/MasterRenderer.hpp"
 #include "Engine/Renderer/MeshAndMaterial/MeshRenderer.hpp"
 #include "Engine/Renderer/FrameBuffers/FrameBuffer.hpp"
+#include "Engine/Renderer/BitmapFonts/TextLayoutCache.hpp"
 #include "Engine/Math/VectorMath/2D/IntVector2.hpp"
 #include "Engine/Math/MatrixMath/Matrix4.hpp"
 
 
 
+const size_t STREAMING_VERTEX_BUFFER_SIZE = 8 * 1024 * 1024;
+const size_t STREAMING_INDEX_BUFFER_SIZE = 4 * 1024 * 1024;
+
+
+
+struct StreamingMeshAllocation
+{
+	Vertex3D* m_Vertices;
+	uint32_t* m_Indices;
+	size_t m_NumberOfVertices;
+	size_t m_NumberOfIndices;
+	size_t m_VertexOffset;
+	size_t m_IndexOffset;
+};
+
+
+
 class AdvancedRenderer : public MasterRenderer
 {
 private:
@@ -26,6 +44,8 @@ public:
 	void UpdateModelMatrix(const Matrix4& modelMatrix);
 	void UpdateViewMatrix(const Matrix4& viewMatrix);
 	void UpdateProjectionMatrix(const Matrix4& projectionMatrix);
+	void PushMatrices();
+	void PopMatrices();
 
 	Matrix4 GetModelMatrix(const Vector3& scalingFactor, const EulerAngles& rotationAngles, const Vector3& translationDisplacement);
 	Matrix4 GetViewMatrix(const Vector3& viewTranslation, const EulerAngles& viewRotation);
@@ -41,6 +61,11 @@ public:
 
 	void DrawMeshWithVAO(Mesh* drawableMesh, Material* meshMaterial = nullptr);
 
+	void BeginStreamingFrame();
+	void EndStreamingFrame();
+	bool AllocateStreamingMesh(size_t numberOfVertices, size_t numberOfIndices, StreamingMeshAllocation* meshAllocation);
+	void DrawStreamingMesh(const StreamingMeshAllocation& meshAllocation, Material* meshMaterial = nullptr);
+
 	void DrawPointsMesh(Mesh* pointsMesh, size_t numberOfVertices, size_t numberOfIndices, float pointSize = 1.0f);
 	void DrawLinesMesh(Mesh* linesMesh, size_t numberOfVertices, size_t numberOfIndices, float lineThickness = 1.0f);
 	void DrawLineLoopMesh(Mesh* lineLoopMesh, size_t numberOfVertices, size_t numberOfIndices, float lineThickness = 1.0f);
@@ -50,20 +75,32 @@ public:
 
 	void Draw2DMonospacedText(const Vector2& startingLetterMinimums, const char* asciiText, float cellHeight, float cellAspectRatio, const MonospaceFont* font = nullptr, const RGBA& textTint = RGBA::WHITE);
 	void Draw2DProportionalText(const Vector2& startingLetterMinimums, const char* asciiText, float cellHeight, const ProportionalFont* font = nullptr, const RGBA& textTint = RGBA::WHITE);
+	void DrawTextLayout(const TextLayout* textLayout, const Vector2& startingLetterMinimums, const RGBA& textTint = RGBA::WHITE);
 
 	void BindFrameBuffer(FrameBuffer* frameBuffer, size_t colorTargetIndex = 0U);
 	void UnbindFrameBuffer();
 	void CopyFrameBufferToBackBuffer(FrameBuffer* frameBuffer);
 
+private:
+	bool AllocateTextMesh(size_t numberOfVertices, size_t numberOfIndices, StreamingMeshAllocation* meshAllocation);
+	void DrawTextMesh(const StreamingMeshAllocation& meshAllocation);
+
 private:
 	Mesh* m_DefaultMesh;
+	Mesh* m_StreamingMesh;
+	Mesh* m_TextMesh;
 	Material* m_DefaultMaterial;
+	Material* m_TextMaterial;
 	Texture* m_DefaultTexture;
 	MeshRenderer* m_MeshRenderer;
 
 	Matrix4 m_ModelMatrix;
 	Matrix4 m_ViewMatrix;
 	Matrix4 m_ProjectionMatrix;
+	std::vector<Matrix4> m_MatrixStack;
+	std::vector<Vertex3D> m_TextVertices;
+	std::vector<uint32_t> m_TextIndices;
 
 	IntVector2 m_WindowDimensions;
+	bool m_IsStreamingFrameOpen;
 };
\ No newline at end of file
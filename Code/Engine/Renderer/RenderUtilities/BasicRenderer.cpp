@@ -1,5 +1,6 @@
 #include "Engine/Renderer/OpenGL/OpenGLExtensions.hpp"
 #include "Engine/Renderer/RenderUtilities/BasicRenderer.hpp"
+#include "Engine/Renderer/BitmapFonts/TextLayoutCache.hpp"
 #include "Engine/Math/MathUtilities/MathUtilities.hpp"
 
 
@@ -712,46 +713,42 @@ void BasicRenderer::Draw2DMonospacedText(const Vector2& startingLetterMinimums,
 
 void BasicRenderer::Draw2DProportionalText(const Vector2& startingLetterMinimums, const std::string& asciiText, float cellHeight, const ProportionalFont* font /*= nullptr*/, const RGBA& textTint /*= RGBA::WHITE*/)
 {
-	Vector2 cursorPosition = startingLetterMinimums;
-	cursorPosition.Y += cellHeight;
-
-	float textScale = font->GetCharacterScaleForCellHeight(cellHeight);
-
-	ProportionalGlyph* previousGlyph = nullptr;
-
-	for (char asciiGlyph : asciiText)
+	const TextLayout* textLayout = TextLayoutCache::CreateOrGetTextLayout(asciiText, cellHeight, font);
+	if (textLayout->m_GlyphRuns.empty())
 	{
-		ProportionalGlyph* currentGlyph = font->GetProportionalGlyphForGlyphUnicode(asciiGlyph);
-		if (currentGlyph == nullptr)
-		{
-			continue;
-		}
+		return;
+	}
 
-		float currentGlyphKerning = 0.0f;
-		if (previousGlyph != nullptr && currentGlyph != nullptr)
-		{
-			currentGlyphKerning = font->GetKerningForGlyphPair(previousGlyph->m_glyphUnicode, currentGlyph->m_glyphUnicode);
-		}
+	PushViewMatrix();
+	TranslateViewMatrix(startingLetterMinimums);
 
-		cursorPosition.X += currentGlyphKerning * textScale;
+	glActiveTexture(GL_TEXTURE0);
+	glEnable(GL_TEXTURE_2D);
+	glPushAttrib(GL_CURRENT_BIT);
+	glColor4ub(textTint.m_Red, textTint.m_Green, textTint.m_Blue, textTint.m_Alpha);
 
-		Vector2 glyphOffset = currentGlyph->GetOffset();
-		Vector2 glyphSize = currentGlyph->GetSize();
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+
+	for (const TextGlyphRun& currentRun : textLayout->m_GlyphRuns)
+	{
+		const Vertex3D* runVertices = textLayout->m_Vertices.data() + currentRun.m_FirstVertex;
+		const uint32_t* runIndices = textLayout->m_Indices.data() + currentRun.m_FirstIndex;
 
-		AABB2 glyphBounds;
+		glBindTexture(GL_TEXTURE_2D, currentRun.m_GlyphTexture->m_TextureID);
+		glBindSampler(0, currentRun.m_GlyphTexture->m_SamplerID);
 
-		glyphBounds.minimums.X = cursorPosition.X + (glyphOffset.X * textScale);
-		glyphBounds.maximums.Y = cursorPosition.Y - (glyphOffset.Y * textScale);
+		glVertexPointer(3, GL_FLOAT, sizeof(Vertex3D), &runVertices[0].m_Position);
+		glTexCoordPointer(2, GL_FLOAT, sizeof(Vertex3D), &runVertices[0].m_TextureCoordinates);
 
-		glyphBounds.maximums.X = glyphBounds.minimums.X + (glyphSize.X * textScale);
-		glyphBounds.minimums.Y = glyphBounds.maximums.Y - (glyphSize.Y * textScale);
+		glDrawElements(GL_TRIANGLES, currentRun.m_NumberOfIndices, GL_UNSIGNED_INT, runIndices);
+	}
 
-		AABB2 glyphTextureBounds = font->GetTextureBoundsForGlyph(*currentGlyph);
-		Texture* glyphTexture = font->GetFontTextureForGlyph(*currentGlyph);
+	glDisableClientState(GL_VERTEX_ARRAY);
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 
-		DrawSingle2DTexturedQuadVA(glyphBounds, glyphTextureBounds, glyphTexture, textTint);
+	glPopAttrib();
+	glDisable(GL_TEXTURE_2D);
 
-		cursorPosition.X += currentGlyph->GetAdvance().X * textScale;
-		previousGlyph = currentGlyph;
-	}
+	PopViewMatrix();
 }
\ No newline at end of file
@@ -0,0 +1,250 @@
+#include "Engine/Renderer/RenderUtilities/RenderBackend.hpp"
+#include "Engine/Renderer/RenderUtilities/AdvancedRenderer.hpp"
+
+
+
+RenderBackend::~RenderBackend()
+{
+
+}
+
+
+
+void OpenGLRenderBackend::BeginFrame()
+{
+	AdvancedRenderer::SingletonInstance()->BeginStreamingFrame();
+}
+
+
+
+void OpenGLRenderBackend::EndFrame()
+{
+	AdvancedRenderer::SingletonInstance()->EndStreamingFrame();
+}
+
+
+
+void OpenGLRenderBackend::ClearScreen(const RGBA& clearColor)
+{
+	AdvancedRenderer::SingletonInstance()->ClearScreen(clearColor);
+}
+
+
+
+void OpenGLRenderBackend::SetRenderState(uint8_t renderStateFlags)
+{
+	AdvancedRenderer::SingletonInstance()->EnableBackFaceCulling((renderStateFlags & BACK_FACE_CULLING_STATE) != 0);
+	AdvancedRenderer::SingletonInstance()->EnableDepthTesting((renderStateFlags & DEPTH_TESTING_STATE) != 0);
+}
+
+
+
+void OpenGLRenderBackend::SetCameraMatrices(const Matrix4& viewMatrix, const Matrix4& projectionMatrix)
+{
+	AdvancedRenderer::SingletonInstance()->UpdateModelMatrix(Matrix4::IdentityMatrix4());
+	AdvancedRenderer::SingletonInstance()->UpdateViewMatrix(viewMatrix);
+	AdvancedRenderer::SingletonInstance()->UpdateProjectionMatrix(projectionMatrix);
+}
+
+
+
+void OpenGLRenderBackend::PushCameraMatrices()
+{
+	AdvancedRenderer::SingletonInstance()->PushMatrices();
+}
+
+
+
+void OpenGLRenderBackend::PopCameraMatrices()
+{
+	AdvancedRenderer::SingletonInstance()->PopMatrices();
+}
+
+
+
+bool OpenGLRenderBackend::AllocateStreamingMesh(size_t numberOfVertices, size_t numberOfIndices, StreamingMeshAllocation* meshAllocation)
+{
+	return AdvancedRenderer::SingletonInstance()->AllocateStreamingMesh(numberOfVertices, numberOfIndices, meshAllocation);
+}
+
+
+
+void OpenGLRenderBackend::DrawStreamingMesh(const StreamingMeshAllocation& meshAllocation, Material* meshMaterial, Texture* meshTexture)
+{
+	if (meshMaterial != nullptr && meshTexture != nullptr)
+	{
+		meshMaterial->SetDiffuseTexture(meshTexture);
+	}
+
+	AdvancedRenderer::SingletonInstance()->DrawStreamingMesh(meshAllocation, meshMaterial);
+}
+
+
+
+void OpenGLRenderBackend::DrawMesh(Mesh* drawableMesh, Material* meshMaterial)
+{
+	AdvancedRenderer::SingletonInstance()->DrawMeshWithVAO(drawableMesh, meshMaterial);
+}
+
+
+
+void OpenGLRenderBackend::DrawProportionalText(const Vector2& startingLetterMinimums, const char* asciiText, float cellHeight, const ProportionalFont* font, const RGBA& textTint)
+{
+	AdvancedRenderer::SingletonInstance()->Draw2DProportionalText(startingLetterMinimums, asciiText, cellHeight, font, textTint);
+}
+
+
+
+NullRenderBackend::NullRenderBackend() :
+m_NumberOfStagingMeshes(0U)
+{
+	ResetStatistics();
+}
+
+
+
+void NullRenderBackend::ResetStatistics()
+{
+	m_NumberOfFrames = 0U;
+	m_NumberOfDraws = 0U;
+	m_NumberOfTextDraws = 0U;
+	m_NumberOfStateChanges = 0U;
+	m_NumberOfMaterialChanges = 0U;
+	m_NumberOfVertices = 0U;
+	m_NumberOfIndices = 0U;
+	m_NumberOfUploadedBytes = 0U;
+
+	m_LastMaterial = nullptr;
+	m_LastTexture = nullptr;
+}
+
+
+
+void NullRenderBackend::BeginFrame()
+{
+	m_LastMaterial = nullptr;
+	m_LastTexture = nullptr;
+	m_NumberOfStagingMeshes = 0U;
+}
+
+
+
+void NullRenderBackend::EndFrame()
+{
+	++m_NumberOfFrames;
+}
+
+
+
+void NullRenderBackend::ClearScreen(const RGBA& clearColor)
+{
+	clearColor;
+
+	++m_NumberOfStateChanges;
+}
+
+
+
+void NullRenderBackend::SetRenderState(uint8_t renderStateFlags)
+{
+	renderStateFlags;
+
+	++m_NumberOfStateChanges;
+}
+
+
+
+void NullRenderBackend::SetCameraMatrices(const Matrix4& viewMatrix, const Matrix4& projectionMatrix)
+{
+	viewMatrix;
+	projectionMatrix;
+
+	++m_NumberOfStateChanges;
+}
+
+
+
+void NullRenderBackend::PushCameraMatrices()
+{
+
+}
+
+
+
+void NullRenderBackend::PopCameraMatrices()
+{
+	++m_NumberOfStateChanges;
+}
+
+
+
+bool NullRenderBackend::AllocateStreamingMesh(size_t numberOfVertices, size_t numberOfIndices, StreamingMeshAllocation* meshAllocation)
+{
+	if (m_NumberOfStagingMeshes == m_StagingVertices.size())
+	{
+		m_StagingVertices.emplace_back();
+		m_StagingIndices.emplace_back();
+	}
+
+	std::vector<Vertex3D>& stagingVertices = m_StagingVertices[m_NumberOfStagingMeshes];
+	std::vector<uint32_t>& stagingIndices = m_StagingIndices[m_NumberOfStagingMeshes];
+	stagingVertices.resize(numberOfVertices);
+	stagingIndices.resize(numberOfIndices);
+	++m_NumberOfStagingMeshes;
+
+	meshAllocation->m_Vertices = stagingVertices.data();
+	meshAllocation->m_Indices = stagingIndices.data();
+	meshAllocation->m_NumberOfVertices = numberOfVertices;
+	meshAllocation->m_NumberOfIndices = numberOfIndices;
+	meshAllocation->m_VertexOffset = 0U;
+	meshAllocation->m_IndexOffset = 0U;
+
+	return true;
+}
+
+
+
+void NullRenderBackend::DrawStreamingMesh(const StreamingMeshAllocation& meshAllocation, Material* meshMaterial, Texture* meshTexture)
+{
+	TrackMaterialChange(meshMaterial, meshTexture);
+
+	++m_NumberOfDraws;
+	m_NumberOfVertices += meshAllocation.m_NumberOfVertices;
+	m_NumberOfIndices += meshAllocation.m_NumberOfIndices;
+	m_NumberOfUploadedBytes += (meshAllocation.m_NumberOfVertices * sizeof(Vertex3D)) + (meshAllocation.m_NumberOfIndices * sizeof(uint32_t));
+}
+
+
+
+void NullRenderBackend::DrawMesh(Mesh* drawableMesh, Material* meshMaterial)
+{
+	drawableMesh;
+
+	TrackMaterialChange(meshMaterial, nullptr);
+	++m_NumberOfDraws;
+}
+
+
+
+void NullRenderBackend::DrawProportionalText(const Vector2& startingLetterMinimums, const char* asciiText, float cellHeight, const ProportionalFont* font, const RGBA& textTint)
+{
+	startingLetterMinimums;
+	asciiText;
+	cellHeight;
+	font;
+	textTint;
+
+	++m_NumberOfTextDraws;
+}
+
+
+
+void NullRenderBackend::TrackMaterialChange(Material* meshMaterial, Texture* meshTexture)
+{
+	if (meshMaterial != m_LastMaterial || meshTexture != m_LastTexture)
+	{
+		++m_NumberOfMaterialChanges;
+		m_LastMaterial = meshMaterial;
+		m_LastTexture = meshTexture;
+	}
+}
\ No newline at end of file
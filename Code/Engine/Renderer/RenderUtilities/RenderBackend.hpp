@@ -0,0 +1,104 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "Engine/Math/MatrixMath/Matrix4.hpp"
+#include "Engine/Renderer/Color/RGBA.hpp"
+#include "Engine/Renderer/Vertex/Vertex.hpp"
+#include "Engine/Renderer/MeshAndMaterial/Mesh.hpp"
+#include "Engine/Renderer/MeshAndMaterial/Material.hpp"
+#include "Engine/Renderer/BitmapFonts/BitmapFont.hpp"
+#include "Engine/Renderer/RenderUtilities/AdvancedRenderer.hpp"
+
+
+
+const uint8_t BACK_FACE_CULLING_STATE = 0x01;
+const uint8_t DEPTH_TESTING_STATE = 0x02;
+
+
+
+class RenderBackend
+{
+public:
+	virtual ~RenderBackend();
+
+	virtual void BeginFrame() = 0;
+	virtual void EndFrame() = 0;
+
+	virtual void ClearScreen(const RGBA& clearColor) = 0;
+	virtual void SetRenderState(uint8_t renderStateFlags) = 0;
+	virtual void SetCameraMatrices(const Matrix4& viewMatrix, const Matrix4& projectionMatrix) = 0;
+	virtual void PushCameraMatrices() = 0;
+	virtual void PopCameraMatrices() = 0;
+
+	virtual bool AllocateStreamingMesh(size_t numberOfVertices, size_t numberOfIndices, StreamingMeshAllocation* meshAllocation) = 0;
+	virtual void DrawStreamingMesh(const StreamingMeshAllocation& meshAllocation, Material* meshMaterial, Texture* meshTexture) = 0;
+	virtual void DrawMesh(Mesh* drawableMesh, Material* meshMaterial) = 0;
+	virtual void DrawProportionalText(const Vector2& startingLetterMinimums, const char* asciiText, float cellHeight, const ProportionalFont* font, const RGBA& textTint) = 0;
+};
+
+
+
+class OpenGLRenderBackend : public RenderBackend
+{
+public:
+	virtual void BeginFrame() override;
+	virtual void EndFrame() override;
+
+	virtual void ClearScreen(const RGBA& clearColor) override;
+	virtual void SetRenderState(uint8_t renderStateFlags) override;
+	virtual void SetCameraMatrices(const Matrix4& viewMatrix, const Matrix4& projectionMatrix) override;
+	virtual void PushCameraMatrices() override;
+	virtual void PopCameraMatrices() override;
+
+	virtual bool AllocateStreamingMesh(size_t numberOfVertices, size_t numberOfIndices, StreamingMeshAllocation* meshAllocation) override;
+	virtual void DrawStreamingMesh(const StreamingMeshAllocation& meshAllocation, Material* meshMaterial, Texture* meshTexture) override;
+	virtual void DrawMesh(Mesh* drawableMesh, Material* meshMaterial) override;
+	virtual void DrawProportionalText(const Vector2& startingLetterMinimums, const char* asciiText, float cellHeight, const ProportionalFont* font, const RGBA& textTint) override;
+};
+
+
+
+class NullRenderBackend : public RenderBackend
+{
+public:
+	NullRenderBackend();
+
+	void ResetStatistics();
+
+	virtual void BeginFrame() override;
+	virtual void EndFrame() override;
+
+	virtual void ClearScreen(const RGBA& clearColor) override;
+	virtual void SetRenderState(uint8_t renderStateFlags) override;
+	virtual void SetCameraMatrices(const Matrix4& viewMatrix, const Matrix4& projectionMatrix) override;
+	virtual void PushCameraMatrices() override;
+	virtual void PopCameraMatrices() override;
+
+	virtual bool AllocateStreamingMesh(size_t numberOfVertices, size_t numberOfIndices, StreamingMeshAllocation* meshAllocation) override;
+	virtual void DrawStreamingMesh(const StreamingMeshAllocation& meshAllocation, Material* meshMaterial, Texture* meshTexture) override;
+	virtual void DrawMesh(Mesh* drawableMesh, Material* meshMaterial) override;
+	virtual void DrawProportionalText(const Vector2& startingLetterMinimums, const char* asciiText, float cellHeight, const ProportionalFont* font, const RGBA& textTint) override;
+
+private:
+	void TrackMaterialChange(Material* meshMaterial, Texture* meshTexture);
+
+public:
+	size_t m_NumberOfFrames;
+	size_t m_NumberOfDraws;
+	size_t m_NumberOfTextDraws;
+	size_t m_NumberOfStateChanges;
+	size_t m_NumberOfMaterialChanges;
+	size_t m_NumberOfVertices;
+	size_t m_NumberOfIndices;
+	size_t m_NumberOfUploadedBytes;
+
+private:
+	Material* m_LastMaterial;
+	Texture* m_LastTexture;
+
+	std::vector<std::vector<Vertex3D>> m_StagingVertices;
+	std::vector<std::vector<uint32_t>> m_StagingIndices;
+	size_t m_NumberOfStagingMeshes;
+};
\ No newline at end of file
@@ -1,6 +1,12 @@
 #include "Engine/Renderer/RenderUtilities/RenderBuffer.hpp"
 #include "Engine/Renderer/OpenGL/OpenGLExtensions.hpp"
 
+#include <string.h>
+
+
+
+const uint64_t STREAMING_FENCE_WAIT_TIMEOUT = 1000000000U;
+
 
 
 RenderBuffer::RenderBuffer() :
@@ -8,9 +14,11 @@ m_BufferType(NULL),
 m_RenderBufferID(NULL),
 m_ElementCount(NULL),
 m_ElementSize(NULL),
-m_UsageMode(NULL)
+m_UsageMode(NULL),
+m_StreamingMemory(nullptr),
+m_IsPersistentlyMapped(false)
 {
-
+	memset(m_StreamingFences, 0, sizeof(m_StreamingFences));
 }
 
 
@@ -19,8 +27,11 @@ RenderBuffer::RenderBuffer(unsigned int bufferType, const void* bufferData, size
 m_BufferType(bufferType),
 m_ElementCount(elementCount),
 m_ElementSize(elementSize),
-m_UsageMode(usageMode)
+m_UsageMode(usageMode),
+m_StreamingMemory(nullptr),
+m_IsPersistentlyMapped(false)
 {
+	memset(m_StreamingFences, 0, sizeof(m_StreamingFences));
 	m_RenderBufferID = CreateRenderBuffer(bufferType, bufferData, elementCount, elementSize, usageMode);
 }
 
@@ -28,6 +39,7 @@ m_UsageMode(usageMode)
 
 RenderBuffer::~RenderBuffer()
 {
+	DestroyStreamingStorage();
 	DestroyRenderBuffer(m_RenderBufferID);
 }
 
@@ -71,6 +83,120 @@ void RenderBuffer::WriteToRenderBuffer(unsigned int bufferType, const void* buff
 
 
 
+void RenderBuffer::CreateStreamingBuffer(unsigned int bufferType, size_t capacityInBytes)
+{
+	DestroyStreamingStorage();
+	DestroyRenderBuffer(m_RenderBufferID);
+	UpdateRenderBufferAttributes(bufferType, capacityInBytes, 1U, GL_STREAM_DRAW);
+
+	glGenBuffers(1, &m_RenderBufferID);
+	glBindBuffer(bufferType, m_RenderBufferID);
+
+	if (glBufferStorage != nullptr && glMapBufferRange != nullptr)
+	{
+		GLbitfield storageFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(bufferType, capacityInBytes, nullptr, storageFlags);
+		m_StreamingMemory = (unsigned char*)glMapBufferRange(bufferType, 0, capacityInBytes, storageFlags);
+		m_IsPersistentlyMapped = (m_StreamingMemory != nullptr);
+
+		if (!m_IsPersistentlyMapped)
+		{
+			glBindBuffer(bufferType, NULL);
+			glDeleteBuffers(1, &m_RenderBufferID);
+			glGenBuffers(1, &m_RenderBufferID);
+			glBindBuffer(bufferType, m_RenderBufferID);
+		}
+	}
+
+	if (!m_IsPersistentlyMapped)
+	{
+		glBufferData(bufferType, capacityInBytes, nullptr, GL_STREAM_DRAW);
+		m_StreamingMemory = new unsigned char[capacityInBytes];
+	}
+
+	glBindBuffer(bufferType, NULL);
+	m_StreamingRing.InitializeRing(capacityInBytes);
+}
+
+
+
+void RenderBuffer::BeginStreamingFrame()
+{
+	while (m_StreamingRing.GetNumberOfPendingFrames() > 0U)
+	{
+		if (!RetireOldestStreamingFrame(0U))
+		{
+			break;
+		}
+	}
+}
+
+
+
+void RenderBuffer::EndStreamingFrame()
+{
+	if (m_StreamingRing.GetNumberOfPendingFrames() == MAXIMUM_STREAMING_FRAMES)
+	{
+		RetireOldestStreamingFrame(STREAMING_FENCE_WAIT_TIMEOUT);
+	}
+
+	size_t frameSlot = m_StreamingRing.EndFrame();
+	if (frameSlot != INVALID_STREAMING_OFFSET && glFenceSync != nullptr)
+	{
+		m_StreamingFences[frameSlot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+}
+
+
+
+void* RenderBuffer::AllocateStreamingSpace(size_t byteCount, size_t alignment, size_t* bufferOffset)
+{
+	size_t allocationOffset = m_StreamingRing.Allocate(byteCount, alignment);
+	while (allocationOffset == INVALID_STREAMING_OFFSET && m_StreamingRing.GetNumberOfPendingFrames() > 0U)
+	{
+		RetireOldestStreamingFrame(STREAMING_FENCE_WAIT_TIMEOUT);
+		allocationOffset = m_StreamingRing.Allocate(byteCount, alignment);
+	}
+
+	if (allocationOffset == INVALID_STREAMING_OFFSET)
+	{
+		return nullptr;
+	}
+
+	*bufferOffset = allocationOffset;
+	return m_StreamingMemory + allocationOffset;
+}
+
+
+
+void RenderBuffer::FlushStreamingSpace(size_t bufferOffset, size_t byteCount)
+{
+	if (m_IsPersistentlyMapped || byteCount == 0U)
+	{
+		return;
+	}
+
+	glBindBuffer(m_BufferType, m_RenderBufferID);
+	glBufferSubData(m_BufferType, bufferOffset, byteCount, m_StreamingMemory + bufferOffset);
+	glBindBuffer(m_BufferType, NULL);
+}
+
+
+
+bool RenderBuffer::IsStreamingBuffer() const
+{
+	return (m_StreamingMemory != nullptr);
+}
+
+
+
+bool RenderBuffer::IsPersistentlyMapped() const
+{
+	return m_IsPersistentlyMapped;
+}
+
+
+
 unsigned int RenderBuffer::GetBufferType() const
 {
 	return m_BufferType;
@@ -119,4 +245,65 @@ void RenderBuffer::UpdateRenderBufferAttributes(unsigned int bufferType, size_t
 	m_ElementCount = elementCount;
 	m_ElementSize = elementSize;
 	m_UsageMode = usageMode;
+}
+
+
+
+bool RenderBuffer::RetireOldestStreamingFrame(uint64_t timeoutInNanoseconds)
+{
+	size_t frameSlot = m_StreamingRing.GetOldestPendingFrameSlot();
+	GLsync frameFence = (GLsync)m_StreamingFences[frameSlot];
+
+	if (frameFence != nullptr)
+	{
+		GLenum waitResult = glClientWaitSync(frameFence, GL_SYNC_FLUSH_COMMANDS_BIT, timeoutInNanoseconds);
+		while (waitResult == GL_TIMEOUT_EXPIRED && timeoutInNanoseconds > 0U)
+		{
+			waitResult = glClientWaitSync(frameFence, GL_SYNC_FLUSH_COMMANDS_BIT, timeoutInNanoseconds);
+		}
+
+		if (waitResult == GL_TIMEOUT_EXPIRED)
+		{
+			return false;
+		}
+
+		glDeleteSync(frameFence);
+		m_StreamingFences[frameSlot] = nullptr;
+	}
+
+	m_StreamingRing.RetireOldestFrame();
+	return true;
+}
+
+
+
+void RenderBuffer::DestroyStreamingStorage()
+{
+	if (m_StreamingMemory == nullptr)
+	{
+		return;
+	}
+
+	for (size_t frameIndex = 0; frameIndex < MAXIMUM_STREAMING_FRAMES; ++frameIndex)
+	{
+		if (m_StreamingFences[frameIndex] != nullptr)
+		{
+			glDeleteSync((GLsync)m_StreamingFences[frameIndex]);
+			m_StreamingFences[frameIndex] = nullptr;
+		}
+	}
+
+	if (m_IsPersistentlyMapped)
+	{
+		glBindBuffer(m_BufferType, m_RenderBufferID);
+		glUnmapBuffer(m_BufferType);
+		glBindBuffer(m_BufferType, NULL);
+	}
+	else
+	{
+		delete[] m_StreamingMemory;
+	}
+
+	m_StreamingMemory = nullptr;
+	m_IsPersistentlyMapped = false;
 }
\ No newline at end of file
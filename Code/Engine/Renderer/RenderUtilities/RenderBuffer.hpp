@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Engine/Renderer/RenderUtilities/StreamingRingAllocator.hpp"
+
 
 
 class RenderBuffer
@@ -14,6 +16,14 @@ public:
 
 	void WriteToRenderBuffer(unsigned int bufferType, const void* bufferData, size_t elementCount, size_t elementSize, unsigned int usageMode);
 
+	void CreateStreamingBuffer(unsigned int bufferType, size_t capacityInBytes);
+	void BeginStreamingFrame();
+	void EndStreamingFrame();
+	void* AllocateStreamingSpace(size_t byteCount, size_t alignment, size_t* bufferOffset);
+	void FlushStreamingSpace(size_t bufferOffset, size_t byteCount);
+	bool IsStreamingBuffer() const;
+	bool IsPersistentlyMapped() const;
+
 	unsigned int GetBufferType() const;
 	unsigned int GetRenderBufferID() const;
 	unsigned int GetElementCount() const;
@@ -23,6 +33,8 @@ public:
 
 private:
 	void UpdateRenderBufferAttributes(unsigned int bufferType, size_t elementCount, size_t elementSize, unsigned int usageMode);
+	bool RetireOldestStreamingFrame(uint64_t timeoutInNanoseconds);
+	void DestroyStreamingStorage();
 
 private:
 	unsigned int m_BufferType;
@@ -30,4 +42,9 @@ private:
 	unsigned int m_ElementCount;
 	unsigned int m_ElementSize;
 	unsigned int m_UsageMode;
+
+	StreamingRingAllocator m_StreamingRing;
+	unsigned char* m_StreamingMemory;
+	void* m_StreamingFences[MAXIMUM_STREAMING_FRAMES];
+	bool m_IsPersistentlyMapped;
 };
\ No newline at end of file
@@ -0,0 +1,368 @@
+#include <algorithm>
+#include <string.h>
+
+#include "Engine/Renderer/RenderUtilities/RenderCommandBuffer.hpp"
+#include "Engine/JobSystem/JobSystem.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
+
+
+
+bool CompareRenderCommands::operator()(const RenderCommand& firstCommand, const RenderCommand& secondCommand) const
+{
+	return (firstCommand.m_SortKey < secondCommand.m_SortKey);
+}
+
+
+
+RenderCommandBuffer::RenderCommandBuffer() :
+m_HasTransientMeshRange(false),
+m_NumberOfTransientVertices(0U),
+m_NumberOfTransientIndices(0U),
+m_NextSequenceIndex(0U)
+{
+
+}
+
+
+
+void RenderCommandBuffer::ResetCommandBuffer()
+{
+	m_Commands.clear();
+	m_Matrices.clear();
+	m_TextPayloads.clear();
+	m_TextCharacters.clear();
+
+	m_HasTransientMeshRange = false;
+	m_NumberOfTransientVertices = 0U;
+	m_NumberOfTransientIndices = 0U;
+	m_NextSequenceIndex = 0U;
+}
+
+
+
+void RenderCommandBuffer::ReserveTransientMeshes(RenderBackend* renderBackend, size_t numberOfVertices, size_t numberOfIndices)
+{
+	m_HasTransientMeshRange = false;
+	m_NumberOfTransientVertices = 0U;
+	m_NumberOfTransientIndices = 0U;
+
+	if (numberOfVertices > 0U && numberOfIndices > 0U)
+	{
+		m_HasTransientMeshRange = renderBackend->AllocateStreamingMesh(numberOfVertices, numberOfIndices, &m_TransientMeshRange);
+	}
+}
+
+
+
+uint64_t RenderCommandBuffer::GetNextSortKey(uint8_t layerID, uint32_t stateKey /*= 0U*/)
+{
+	return MakeRenderSortKey(layerID, stateKey, m_NextSequenceIndex++);
+}
+
+
+
+void RenderCommandBuffer::ClearScreen(uint64_t sortKey, const RGBA& clearColor)
+{
+	RenderCommand& clearCommand = AddCommand(sortKey, CLEAR_SCREEN_COMMAND);
+	clearCommand.m_ClearColor = clearColor;
+}
+
+
+
+void RenderCommandBuffer::SetRenderState(uint64_t sortKey, uint8_t renderStateFlags)
+{
+	RenderCommand& stateCommand = AddCommand(sortKey, SET_RENDER_STATE_COMMAND);
+	stateCommand.m_RenderStateFlags = renderStateFlags;
+}
+
+
+
+void RenderCommandBuffer::SetCameraMatrices(uint64_t sortKey, const Matrix4& viewMatrix, const Matrix4& projectionMatrix)
+{
+	RenderCommand& cameraCommand = AddCommand(sortKey, SET_CAMERA_MATRICES_COMMAND);
+	cameraCommand.m_PayloadIndex = static_cast<uint32_t>(m_Matrices.size());
+
+	m_Matrices.push_back(viewMatrix);
+	m_Matrices.push_back(projectionMatrix);
+}
+
+
+
+void RenderCommandBuffer::PushCameraMatrices(uint64_t sortKey)
+{
+	AddCommand(sortKey, PUSH_CAMERA_MATRICES_COMMAND);
+}
+
+
+
+void RenderCommandBuffer::PopCameraMatrices(uint64_t sortKey)
+{
+	AddCommand(sortKey, POP_CAMERA_MATRICES_COMMAND);
+}
+
+
+
+bool RenderCommandBuffer::AllocateTransientMesh(size_t numberOfVertices, size_t numberOfIndices, StreamingMeshAllocation* meshAllocation)
+{
+	if (!m_HasTransientMeshRange || numberOfVertices == 0U || numberOfIndices == 0U)
+	{
+		return false;
+	}
+
+	size_t requiredVertices = m_NumberOfTransientVertices + numberOfVertices;
+	size_t requiredIndices = m_NumberOfTransientIndices + numberOfIndices;
+	if (requiredVertices > m_TransientMeshRange.m_NumberOfVertices || requiredIndices > m_TransientMeshRange.m_NumberOfIndices)
+	{
+		return false;
+	}
+
+	meshAllocation->m_Vertices = m_TransientMeshRange.m_Vertices + m_NumberOfTransientVertices;
+	meshAllocation->m_Indices = m_TransientMeshRange.m_Indices + m_NumberOfTransientIndices;
+	meshAllocation->m_NumberOfVertices = numberOfVertices;
+	meshAllocation->m_NumberOfIndices = numberOfIndices;
+	meshAllocation->m_VertexOffset = m_TransientMeshRange.m_VertexOffset + (m_NumberOfTransientVertices * sizeof(Vertex3D));
+	meshAllocation->m_IndexOffset = m_TransientMeshRange.m_IndexOffset + (m_NumberOfTransientIndices * sizeof(uint32_t));
+
+	m_NumberOfTransientVertices = requiredVertices;
+	m_NumberOfTransientIndices = requiredIndices;
+
+	return true;
+}
+
+
+
+void RenderCommandBuffer::DrawTransientMesh(uint64_t sortKey, const StreamingMeshAllocation& meshAllocation, Material* meshMaterial, Texture* meshTexture)
+{
+	RenderCommand& drawCommand = AddCommand(sortKey, DRAW_TRANSIENT_MESH_COMMAND);
+	drawCommand.m_Material = meshMaterial;
+	drawCommand.m_Texture = meshTexture;
+	drawCommand.m_PayloadIndex = static_cast<uint32_t>(meshAllocation.m_Vertices - m_TransientMeshRange.m_Vertices);
+	drawCommand.m_NumberOfVertices = static_cast<uint32_t>(meshAllocation.m_NumberOfVertices);
+	drawCommand.m_FirstIndex = static_cast<uint32_t>(meshAllocation.m_Indices - m_TransientMeshRange.m_Indices);
+	drawCommand.m_NumberOfIndices = static_cast<uint32_t>(meshAllocation.m_NumberOfIndices);
+}
+
+
+
+void RenderCommandBuffer::DrawMesh(uint64_t sortKey, Mesh* drawableMesh, Material* meshMaterial)
+{
+	RenderCommand& drawCommand = AddCommand(sortKey, DRAW_MESH_COMMAND);
+	drawCommand.m_Mesh = drawableMesh;
+	drawCommand.m_Material = meshMaterial;
+}
+
+
+
+void RenderCommandBuffer::DrawProportionalText(uint64_t sortKey, const Vector2& startingLetterMinimums, const char* asciiText, float cellHeight, const ProportionalFont* font, const RGBA& textTint)
+{
+	RenderCommand& textCommand = AddCommand(sortKey, DRAW_PROPORTIONAL_TEXT_COMMAND);
+	textCommand.m_PayloadIndex = static_cast<uint32_t>(m_TextPayloads.size());
+
+	RenderTextPayload textPayload;
+	textPayload.m_StartingLetterMinimums = startingLetterMinimums;
+	textPayload.m_CellHeight = cellHeight;
+	textPayload.m_Font = font;
+	textPayload.m_TextTint = textTint;
+	textPayload.m_FirstCharacterIndex = static_cast<uint32_t>(m_TextCharacters.size());
+	m_TextPayloads.push_back(textPayload);
+
+	m_TextCharacters.insert(m_TextCharacters.end(), asciiText, asciiText + strlen(asciiText) + 1U);
+}
+
+
+
+void RenderCommandBuffer::SortCommands()
+{
+	std::stable_sort(m_Commands.begin(), m_Commands.end(), CompareRenderCommands());
+}
+
+
+
+void RenderCommandBuffer::ExecuteCommands(RenderBackend* renderBackend) const
+{
+	for (const RenderCommand& currentCommand : m_Commands)
+	{
+		switch (currentCommand.m_CommandType)
+		{
+		case CLEAR_SCREEN_COMMAND:
+			renderBackend->ClearScreen(currentCommand.m_ClearColor);
+			break;
+
+		case SET_RENDER_STATE_COMMAND:
+			renderBackend->SetRenderState(currentCommand.m_RenderStateFlags);
+			break;
+
+		case SET_CAMERA_MATRICES_COMMAND:
+			renderBackend->SetCameraMatrices(m_Matrices[currentCommand.m_PayloadIndex], m_Matrices[currentCommand.m_PayloadIndex + 1]);
+			break;
+
+		case PUSH_CAMERA_MATRICES_COMMAND:
+			renderBackend->PushCameraMatrices();
+			break;
+
+		case POP_CAMERA_MATRICES_COMMAND:
+			renderBackend->PopCameraMatrices();
+			break;
+
+		case DRAW_TRANSIENT_MESH_COMMAND:
+		{
+			StreamingMeshAllocation meshAllocation;
+			meshAllocation.m_Vertices = m_TransientMeshRange.m_Vertices + currentCommand.m_PayloadIndex;
+			meshAllocation.m_Indices = m_TransientMeshRange.m_Indices + currentCommand.m_FirstIndex;
+			meshAllocation.m_NumberOfVertices = currentCommand.m_NumberOfVertices;
+			meshAllocation.m_NumberOfIndices = currentCommand.m_NumberOfIndices;
+			meshAllocation.m_VertexOffset = m_TransientMeshRange.m_VertexOffset + (currentCommand.m_PayloadIndex * sizeof(Vertex3D));
+			meshAllocation.m_IndexOffset = m_TransientMeshRange.m_IndexOffset + (currentCommand.m_FirstIndex * sizeof(uint32_t));
+			renderBackend->DrawStreamingMesh(meshAllocation, currentCommand.m_Material, currentCommand.m_Texture);
+			break;
+		}
+
+		case DRAW_MESH_COMMAND:
+			renderBackend->DrawMesh(currentCommand.m_Mesh, currentCommand.m_Material);
+			break;
+
+		case DRAW_PROPORTIONAL_TEXT_COMMAND:
+		{
+			const RenderTextPayload& textPayload = m_TextPayloads[currentCommand.m_PayloadIndex];
+			renderBackend->DrawProportionalText(textPayload.m_StartingLetterMinimums, m_TextCharacters.data() + textPayload.m_FirstCharacterIndex,
+				textPayload.m_CellHeight, textPayload.m_Font, textPayload.m_TextTint);
+			break;
+		}
+
+		default:
+			break;
+		}
+	}
+}
+
+
+
+size_t RenderCommandBuffer::GetNumberOfCommands() const
+{
+	return m_Commands.size();
+}
+
+
+
+size_t RenderCommandBuffer::GetNumberOfTransientVertices() const
+{
+	return m_NumberOfTransientVertices;
+}
+
+
+
+size_t RenderCommandBuffer::GetNumberOfTransientIndices() const
+{
+	return m_NumberOfTransientIndices;
+}
+
+
+
+RenderCommand& RenderCommandBuffer::AddCommand(uint64_t sortKey, RenderCommandType commandType)
+{
+	m_Commands.emplace_back();
+
+	RenderCommand& newCommand = m_Commands.back();
+	newCommand.m_SortKey = sortKey;
+	newCommand.m_CommandType = commandType;
+	newCommand.m_RenderStateFlags = 0U;
+	newCommand.m_Material = nullptr;
+	newCommand.m_Texture = nullptr;
+	newCommand.m_Mesh = nullptr;
+	newCommand.m_PayloadIndex = 0U;
+	newCommand.m_NumberOfVertices = 0U;
+	newCommand.m_FirstIndex = 0U;
+	newCommand.m_NumberOfIndices = 0U;
+
+	return newCommand;
+}
+
+
+
+RenderCommandRecorder::~RenderCommandRecorder()
+{
+
+}
+
+
+
+void RecordRenderTasks(std::vector<RenderRecordTask>& recordTasks, RenderBackend* renderBackend)
+{
+	RunRenderTasks(recordTasks, PrepareRenderTask, PrepareRenderTaskJob);
+
+	for (RenderRecordTask& currentTask : recordTasks)
+	{
+		currentTask.m_CommandBuffer->ReserveTransientMeshes(renderBackend, currentTask.m_NumberOfVertices, currentTask.m_NumberOfIndices);
+	}
+
+	RunRenderTasks(recordTasks, RecordRenderTask, RecordRenderTaskJob);
+}
+
+
+
+void RunRenderTasks(std::vector<RenderRecordTask>& recordTasks, void (*taskFunction)(RenderRecordTask&), void (*jobFunction)(Job*))
+{
+	if (!JobSystem::JobSystemIsRunning() || recordTasks.size() < 2U)
+	{
+		for (RenderRecordTask& currentTask : recordTasks)
+		{
+			taskFunction(currentTask);
+		}
+
+		return;
+	}
+
+	std::vector<Job*> dispatchedJobs;
+	for (size_t taskIndex = 1U; taskIndex < recordTasks.size(); ++taskIndex)
+	{
+		Job* taskJob = Job::CreateJob(GENERIC, jobFunction);
+		taskJob->WriteToJobData<RenderRecordTask*>(&recordTasks[taskIndex]);
+		Job::DispatchJob(taskJob);
+		dispatchedJobs.push_back(taskJob);
+	}
+
+	taskFunction(recordTasks[0]);
+
+	for (Job* taskJob : dispatchedJobs)
+	{
+		Job::WaitJob(taskJob);
+	}
+}
+
+
+
+void PrepareRenderTask(RenderRecordTask& recordTask)
+{
+	recordTask.m_CommandBuffer->ResetCommandBuffer();
+	recordTask.m_NumberOfVertices = 0U;
+	recordTask.m_NumberOfIndices = 0U;
+	recordTask.m_Recorder->PrepareCommands(&recordTask.m_NumberOfVertices, &recordTask.m_NumberOfIndices);
+}
+
+
+
+void RecordRenderTask(RenderRecordTask& recordTask)
+{
+	recordTask.m_Recorder->RecordCommands(*recordTask.m_CommandBuffer, recordTask.m_LayerID);
+	recordTask.m_CommandBuffer->SortCommands();
+}
+
+
+
+void PrepareRenderTaskJob(Job* currentJob)
+{
+	MEMORY_SCOPE("Rendering");
+
+	RenderRecordTask* recordTask = currentJob->ReadFromJobData<RenderRecordTask*>();
+	PrepareRenderTask(*recordTask);
+}
+
+
+
+void RecordRenderTaskJob(Job* currentJob)
+{
+	MEMORY_SCOPE("Rendering");
+
+	RenderRecordTask* recordTask = currentJob->ReadFromJobData<RenderRecordTask*>();
+	RecordRenderTask(*recordTask);
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "Engine/Renderer/RenderUtilities/RenderBackend.hpp"
+#include "Engine/Renderer/RenderUtilities/AdvancedRenderer.hpp"
+
+
+
+enum RenderCommandType : uint8_t
+{
+	CLEAR_SCREEN_COMMAND,
+	SET_RENDER_STATE_COMMAND,
+	SET_CAMERA_MATRICES_COMMAND,
+	PUSH_CAMERA_MATRICES_COMMAND,
+	POP_CAMERA_MATRICES_COMMAND,
+	DRAW_TRANSIENT_MESH_COMMAND,
+	DRAW_MESH_COMMAND,
+	DRAW_PROPORTIONAL_TEXT_COMMAND
+};
+
+
+
+class Job;
+class RenderCommandBuffer;
+
+
+
+inline uint64_t MakeRenderSortKey(uint8_t layerID, uint32_t stateKey, uint32_t sequenceIndex)
+{
+	return (static_cast<uint64_t>(layerID) << 56) | (static_cast<uint64_t>(stateKey & 0x00FFFFFF) << 32) | static_cast<uint64_t>(sequenceIndex);
+}
+
+
+
+struct RenderCommand
+{
+	uint64_t m_SortKey;
+	RenderCommandType m_CommandType;
+	uint8_t m_RenderStateFlags;
+	RGBA m_ClearColor;
+
+	Material* m_Material;
+	Texture* m_Texture;
+	Mesh* m_Mesh;
+
+	uint32_t m_PayloadIndex;
+	uint32_t m_NumberOfVertices;
+	uint32_t m_FirstIndex;
+	uint32_t m_NumberOfIndices;
+};
+
+
+
+struct RenderTextPayload
+{
+	Vector2 m_StartingLetterMinimums;
+	float m_CellHeight;
+	const ProportionalFont* m_Font;
+	RGBA m_TextTint;
+	uint32_t m_FirstCharacterIndex;
+};
+
+
+
+struct CompareRenderCommands
+{
+	bool operator()(const RenderCommand& firstCommand, const RenderCommand& secondCommand) const;
+};
+
+
+
+class RenderCommandBuffer
+{
+public:
+	RenderCommandBuffer();
+
+	void ResetCommandBuffer();
+	void ReserveTransientMeshes(RenderBackend* renderBackend, size_t numberOfVertices, size_t numberOfIndices);
+	uint64_t GetNextSortKey(uint8_t layerID, uint32_t stateKey = 0U);
+
+	void ClearScreen(uint64_t sortKey, const RGBA& clearColor);
+	void SetRenderState(uint64_t sortKey, uint8_t renderStateFlags);
+	void SetCameraMatrices(uint64_t sortKey, const Matrix4& viewMatrix, const Matrix4& projectionMatrix);
+	void PushCameraMatrices(uint64_t sortKey);
+	void PopCameraMatrices(uint64_t sortKey);
+
+	bool AllocateTransientMesh(size_t numberOfVertices, size_t numberOfIndices, StreamingMeshAllocation* meshAllocation);
+	void DrawTransientMesh(uint64_t sortKey, const StreamingMeshAllocation& meshAllocation, Material* meshMaterial, Texture* meshTexture);
+	void DrawMesh(uint64_t sortKey, Mesh* drawableMesh, Material* meshMaterial);
+	void DrawProportionalText(uint64_t sortKey, const Vector2& startingLetterMinimums, const char* asciiText, float cellHeight, const ProportionalFont* font, const RGBA& textTint);
+
+	void SortCommands();
+	void ExecuteCommands(RenderBackend* renderBackend) const;
+
+	size_t GetNumberOfCommands() const;
+	size_t GetNumberOfTransientVertices() const;
+	size_t GetNumberOfTransientIndices() const;
+
+private:
+	RenderCommand& AddCommand(uint64_t sortKey, RenderCommandType commandType);
+
+private:
+	std::vector<RenderCommand> m_Commands;
+	std::vector<Matrix4> m_Matrices;
+	std::vector<RenderTextPayload> m_TextPayloads;
+	std::vector<char> m_TextCharacters;
+
+	StreamingMeshAllocation m_TransientMeshRange;
+	bool m_HasTransientMeshRange;
+	size_t m_NumberOfTransientVertices;
+	size_t m_NumberOfTransientIndices;
+	uint32_t m_NextSequenceIndex;
+};
+
+
+
+class RenderCommandRecorder
+{
+public:
+	virtual ~RenderCommandRecorder();
+
+	virtual void PrepareCommands(size_t* numberOfVertices, size_t* numberOfIndices) const = 0;
+	virtual void RecordCommands(RenderCommandBuffer& commandBuffer, uint8_t layerID) const = 0;
+};
+
+
+
+struct RenderRecordTask
+{
+	const RenderCommandRecorder* m_Recorder;
+	RenderCommandBuffer* m_CommandBuffer;
+	uint8_t m_LayerID;
+
+	size_t m_NumberOfVertices;
+	size_t m_NumberOfIndices;
+};
+
+
+
+void RecordRenderTasks(std::vector<RenderRecordTask>& recordTasks, RenderBackend* renderBackend);
+void RunRenderTasks(std::vector<RenderRecordTask>& recordTasks, void (*taskFunction)(RenderRecordTask&), void (*jobFunction)(Job*));
+void PrepareRenderTask(RenderRecordTask& recordTask);
+void RecordRenderTask(RenderRecordTask& recordTask);
+void PrepareRenderTaskJob(Job* currentJob);
+void RecordRenderTaskJob(Job* currentJob);
\ No newline at end of file
@@ -0,0 +1,238 @@
+#include "Engine/Renderer/RenderUtilities/StreamingRingAllocator.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+#include "Engine/ErrorHandling/StringUtils.hpp"
+
+
+
+StreamingRingAllocator::StreamingRingAllocator() :
+m_Capacity(0U),
+m_HeadOffset(0U),
+m_UsedBytes(0U),
+m_CurrentFrameBytes(0U),
+m_CurrentFrameNumber(0U),
+m_OldestPendingFrameSlot(0U),
+m_NumberOfPendingFrames(0U)
+{
+
+}
+
+
+
+void StreamingRingAllocator::InitializeRing(size_t capacityInBytes)
+{
+	m_Capacity = capacityInBytes;
+	m_HeadOffset = 0U;
+	m_UsedBytes = 0U;
+	m_CurrentFrameBytes = 0U;
+	m_CurrentFrameNumber = 0U;
+	m_OldestPendingFrameSlot = 0U;
+	m_NumberOfPendingFrames = 0U;
+}
+
+
+
+size_t StreamingRingAllocator::Allocate(size_t byteCount, size_t alignment)
+{
+	if (byteCount == 0U || byteCount > m_Capacity)
+	{
+		return INVALID_STREAMING_OFFSET;
+	}
+
+	alignment = (alignment > 0U) ? alignment : 1U;
+	size_t allocationOffset = ((m_HeadOffset + alignment - 1U) / alignment) * alignment;
+	size_t paddingBytes = allocationOffset - m_HeadOffset;
+
+	if (allocationOffset + byteCount > m_Capacity)
+	{
+		allocationOffset = 0U;
+		paddingBytes = m_Capacity - m_HeadOffset;
+	}
+
+	if (m_UsedBytes + paddingBytes + byteCount > m_Capacity)
+	{
+		return INVALID_STREAMING_OFFSET;
+	}
+
+	m_HeadOffset = allocationOffset + byteCount;
+	m_UsedBytes += paddingBytes + byteCount;
+	m_CurrentFrameBytes += paddingBytes + byteCount;
+
+	return allocationOffset;
+}
+
+
+
+size_t StreamingRingAllocator::EndFrame()
+{
+	size_t frameSlot = (m_OldestPendingFrameSlot + m_NumberOfPendingFrames) % MAXIMUM_STREAMING_FRAMES;
+	if (m_NumberOfPendingFrames == MAXIMUM_STREAMING_FRAMES)
+	{
+		return INVALID_STREAMING_OFFSET;
+	}
+
+	m_PendingFrames[frameSlot].m_FrameNumber = m_CurrentFrameNumber;
+	m_PendingFrames[frameSlot].m_ByteCount = m_CurrentFrameBytes;
+	++m_NumberOfPendingFrames;
+
+	m_CurrentFrameBytes = 0U;
+	++m_CurrentFrameNumber;
+
+	return frameSlot;
+}
+
+
+
+void StreamingRingAllocator::RetireOldestFrame()
+{
+	if (m_NumberOfPendingFrames == 0U)
+	{
+		return;
+	}
+
+	m_UsedBytes -= m_PendingFrames[m_OldestPendingFrameSlot].m_ByteCount;
+	m_OldestPendingFrameSlot = (m_OldestPendingFrameSlot + 1U) % MAXIMUM_STREAMING_FRAMES;
+	--m_NumberOfPendingFrames;
+}
+
+
+
+size_t StreamingRingAllocator::GetCapacity() const
+{
+	return m_Capacity;
+}
+
+
+
+size_t StreamingRingAllocator::GetUsedBytes() const
+{
+	return m_UsedBytes;
+}
+
+
+
+size_t StreamingRingAllocator::GetHeadOffset() const
+{
+	return m_HeadOffset;
+}
+
+
+
+size_t StreamingRingAllocator::GetNumberOfPendingFrames() const
+{
+	return m_NumberOfPendingFrames;
+}
+
+
+
+size_t StreamingRingAllocator::GetOldestPendingFrameSlot() const
+{
+	return m_OldestPendingFrameSlot;
+}
+
+
+
+uint64_t StreamingRingAllocator::GetCurrentFrameNumber() const
+{
+	return m_CurrentFrameNumber;
+}
+
+
+
+const char* StreamingRingAllocator::FindFailedRingCheck()
+{
+	StreamingRingAllocator testRing;
+	testRing.InitializeRing(100U);
+
+	if (testRing.Allocate(0U, 4U) != INVALID_STREAMING_OFFSET || testRing.Allocate(101U, 4U) != INVALID_STREAMING_OFFSET)
+	{
+		return "Empty and oversized allocations should fail.";
+	}
+
+	if (testRing.Allocate(30U, 4U) != 0U || testRing.Allocate(10U, 12U) != 36U)
+	{
+		return "Allocations should be packed in order and aligned.";
+	}
+
+	testRing.EndFrame();
+	if (testRing.GetUsedBytes() != 46U || testRing.GetNumberOfPendingFrames() != 1U)
+	{
+		return "Alignment padding should be charged to the frame.";
+	}
+
+	if (testRing.Allocate(40U, 4U) != 48U)
+	{
+		return "Second frame should continue after the first.";
+	}
+
+	if (testRing.Allocate(20U, 4U) != INVALID_STREAMING_OFFSET)
+	{
+		return "Wrapping into an unretired frame should fail.";
+	}
+
+	testRing.EndFrame();
+	testRing.RetireOldestFrame();
+	if (testRing.GetUsedBytes() != 42U)
+	{
+		return "Retiring a frame should free exactly its bytes.";
+	}
+
+	if (testRing.Allocate(20U, 4U) != 0U || testRing.GetUsedBytes() != 74U)
+	{
+		return "Allocation should wrap to the start and charge the skipped tail.";
+	}
+
+	if (testRing.Allocate(30U, 4U) != INVALID_STREAMING_OFFSET)
+	{
+		return "Wrapped head should not overrun the pending frame.";
+	}
+
+	testRing.EndFrame();
+	testRing.RetireOldestFrame();
+	if (testRing.Allocate(60U, 4U) != 20U)
+	{
+		return "Space freed by a retired frame should be reusable after a wrap.";
+	}
+
+	testRing.EndFrame();
+	testRing.EndFrame();
+	if (testRing.EndFrame() != INVALID_STREAMING_OFFSET || testRing.GetNumberOfPendingFrames() != MAXIMUM_STREAMING_FRAMES)
+	{
+		return "Ending a frame with every slot pending should fail.";
+	}
+
+	testRing.RetireOldestFrame();
+	testRing.RetireOldestFrame();
+	testRing.RetireOldestFrame();
+	if (testRing.GetUsedBytes() != 0U || testRing.GetNumberOfPendingFrames() != 0U)
+	{
+		return "Retiring every frame should empty the ring.";
+	}
+
+	return nullptr;
+}
+
+
+
+void StreamingRingTestCommand(Command& currentCommand)
+{
+	ConsoleLine testMessage;
+
+	if (currentCommand.HasNoArguments())
+	{
+		const char* failedCheck = StreamingRingAllocator::FindFailedRingCheck();
+		if (failedCheck == nullptr)
+		{
+			testMessage = ConsoleLine("Streaming ring test passed.", RGBA::GREEN);
+		}
+		else
+		{
+			testMessage = ConsoleLine(Stringf("Streaming ring test failed: %s", failedCheck), RGBA::RED);
+		}
+	}
+	else
+	{
+		testMessage = ConsoleLine("Streaming Ring Test command takes no arguments.", RGBA::RED);
+	}
+
+	DeveloperConsole::AddNewConsoleLine(testMessage);
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Engine/DeveloperConsole/Command.hpp"
+
+
+
+const size_t MAXIMUM_STREAMING_FRAMES = 3;
+const size_t INVALID_STREAMING_OFFSET = ~static_cast<size_t>(0U);
+
+
+
+struct StreamingFrameRegion
+{
+	uint64_t m_FrameNumber;
+	size_t m_ByteCount;
+};
+
+
+
+class StreamingRingAllocator
+{
+public:
+	StreamingRingAllocator();
+
+	void InitializeRing(size_t capacityInBytes);
+
+	size_t Allocate(size_t byteCount, size_t alignment);
+	size_t EndFrame();
+	void RetireOldestFrame();
+
+	size_t GetCapacity() const;
+	size_t GetUsedBytes() const;
+	size_t GetHeadOffset() const;
+	size_t GetNumberOfPendingFrames() const;
+	size_t GetOldestPendingFrameSlot() const;
+	uint64_t GetCurrentFrameNumber() const;
+
+	static const char* FindFailedRingCheck();
+
+private:
+	size_t m_Capacity;
+	size_t m_HeadOffset;
+	size_t m_UsedBytes;
+	size_t m_CurrentFrameBytes;
+	uint64_t m_CurrentFrameNumber;
+
+	StreamingFrameRegion m_PendingFrames[MAXIMUM_STREAMING_FRAMES];
+	size_t m_OldestPendingFrameSlot;
+	size_t m_NumberOfPendingFrames;
+};
+
+
+
+void StreamingRingTestCommand(Command& currentCommand);
\ No newline at end of file
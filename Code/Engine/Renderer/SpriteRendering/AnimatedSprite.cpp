@@ -130,7 +130,14 @@ void AnimatedSprite::DisableSprite()
 
 void AnimatedSprite::SetCurrentFrame(float currentTime)
 {
+	const SpriteResource* previousSpriteResource = m_SpriteResource;
+
 	m_SpriteResource = m_Sequence->GetAnimationFrame(currentTime);
 	m_Material = m_SpriteResource->m_Material;
 	m_Material->SetDiffuseTexture(m_SpriteResource->m_Texture);
+
+	if (m_SpriteResource != previousSpriteResource)
+	{
+		UpdateSpatialProxy(Vector2::ZERO);
+	}
 }
\ No newline at end of file
@@ -20,9 +20,10 @@ m_Scale(Vector2::ONE),
 m_Rotation(0.0f),
 m_Position(Vector2::ZERO),
 m_LayerID(0),
-m_IsEnabled(false)
+m_IsEnabled(false),
+m_SpatialProxyID(INVALID_SPATIAL_PROXY_ID)
 {
-	m_Mesh = new Mesh();
+
 }
 
 
@@ -32,12 +33,12 @@ m_Scale(Vector2::ONE),
 m_Rotation(0.0f),
 m_Position(Vector2::ZERO),
 m_LayerID(0),
-m_IsEnabled(false)
+m_IsEnabled(false),
+m_SpatialProxyID(INVALID_SPATIAL_PROXY_ID)
 {
 	m_SpriteResource = SpriteDatabase::SingletonInstance()->GetConstantSpriteResource(spriteResourceID);
 	ASSERT_OR_DIE(m_SpriteResource != nullptr, "No Sprite Resource exists for this Sprite.");
 
-	m_Mesh = new Mesh();
 	m_Material = m_SpriteResource->m_Material;
 }
 
@@ -46,8 +47,6 @@ m_IsEnabled(false)
 Sprite::~Sprite()
 {
 	SpriteRenderer::SingletonInstance()->UnregisterSprite(this);
-
-	delete m_Mesh;
 }
 
 
@@ -55,6 +54,7 @@ Sprite::~Sprite()
 void Sprite::SetSpriteScale(const Vector2& spriteScale)
 {
 	m_Scale = spriteScale;
+	UpdateSpatialProxy(Vector2::ZERO);
 }
 
 
@@ -69,6 +69,7 @@ Vector2 Sprite::GetSpriteScale() const
 void Sprite::SetSpriteRotation(float spriteRotation)
 {
 	m_Rotation = spriteRotation;
+	UpdateSpatialProxy(Vector2::ZERO);
 }
 
 
@@ -82,7 +83,9 @@ float Sprite::GetSpriteRotation() const
 
 void Sprite::SetSpritePosition(const Vector2& spritePosition)
 {
+	Vector2 spriteDisplacement = spritePosition - m_Position;
 	m_Position = spritePosition;
+	UpdateSpatialProxy(spriteDisplacement);
 }
 
 
@@ -110,6 +113,32 @@ AABB2 Sprite::GetSpriteWorldBounds() const
 
 
 
+AABB2 Sprite::GetSpriteCullingBounds() const
+{
+	Vector2 spriteMinimums = m_SpriteResource->m_Pivot.GetNegatedVector2();
+	Vector2 spriteMaximums = spriteMinimums + m_SpriteResource->m_Dimensions;
+	Vector2 spriteCorners[4] = { spriteMinimums, Vector2(spriteMaximums.X, spriteMinimums.Y), spriteMaximums, Vector2(spriteMinimums.X, spriteMaximums.Y) };
+
+	float cosAngle = CosineOfDegrees(m_Rotation);
+	float sinAngle = SineOfDegrees(m_Rotation);
+
+	AABB2 cullingBounds(m_Position, m_Position);
+	for (const Vector2& currentCorner : spriteCorners)
+	{
+		float cornerX = (m_Scale.X * currentCorner.X * cosAngle) - (m_Scale.Y * currentCorner.Y * sinAngle) + m_Position.X;
+		float cornerY = (m_Scale.X * currentCorner.X * sinAngle) + (m_Scale.Y * currentCorner.Y * cosAngle) + m_Position.Y;
+
+		cullingBounds.minimums.X = (cornerX < cullingBounds.minimums.X) ? cornerX : cullingBounds.minimums.X;
+		cullingBounds.minimums.Y = (cornerY < cullingBounds.minimums.Y) ? cornerY : cullingBounds.minimums.Y;
+		cullingBounds.maximums.X = (cornerX > cullingBounds.maximums.X) ? cornerX : cullingBounds.maximums.X;
+		cullingBounds.maximums.Y = (cornerY > cullingBounds.maximums.Y) ? cornerY : cullingBounds.maximums.Y;
+	}
+
+	return cullingBounds;
+}
+
+
+
 Vector2 Sprite::GetSpriteDimensions() const
 {
 	float spriteWidth = m_SpriteResource->m_Dimensions.X * m_Scale.X;
@@ -184,57 +213,110 @@ void Sprite::SetMaterial(Material* spriteMaterial)
 
 
 
+Material* Sprite::GetMaterial() const
+{
+	return m_Material;
+}
+
+
+
+const SpriteResource* Sprite::GetSpriteResource() const
+{
+	return m_SpriteResource;
+}
+
+
+
+void Sprite::SetSpatialProxyID(int32_t spatialProxyID)
+{
+	m_SpatialProxyID = spatialProxyID;
+}
+
+
+
+int32_t Sprite::GetSpatialProxyID() const
+{
+	return m_SpatialProxyID;
+}
+
+
+
+void Sprite::UpdateSpatialProxy(const Vector2& spriteDisplacement)
+{
+	if (m_SpatialProxyID != INVALID_SPATIAL_PROXY_ID)
+	{
+		SpriteRenderer::SingletonInstance()->MoveSprite(this, spriteDisplacement);
+	}
+}
+
+
+
 void Sprite::Render() const
 {
-	UpdateSpriteMesh();
+	StreamingMeshAllocation spriteAllocation;
+	if (!AdvancedRenderer::SingletonInstance()->AllocateStreamingMesh(NUMBER_OF_VERTICES, NUMBER_OF_INDICES, &spriteAllocation))
+	{
+		return;
+	}
+
+	WriteSpriteVertices(spriteAllocation.m_Vertices, spriteAllocation.m_Indices);
 	m_Material->SetDiffuseTexture(m_SpriteResource->m_Texture);
-	AdvancedRenderer::SingletonInstance()->DrawPolygonMesh(m_Mesh, NUMBER_OF_VERTICES, NUMBER_OF_INDICES, m_Material);
+	AdvancedRenderer::SingletonInstance()->DrawStreamingMesh(spriteAllocation, m_Material);
+}
+
+
+
+void Sprite::WriteSpriteVertices(Vertex3D* spriteVertices, uint32_t* spriteIndices) const
+{
+	WriteSpriteQuad(m_SpriteResource, m_Position, m_Scale, m_Rotation, spriteVertices, spriteIndices, 0U);
 }
 
 
 
-void Sprite::UpdateSpriteMesh() const
+void Sprite::WriteSpriteQuad(const SpriteResource* spriteResource, const Vector2& spritePosition, const Vector2& spriteScale, float spriteRotation, Vertex3D* spriteVertices, uint32_t* spriteIndices, uint32_t firstVertexIndex)
 {
-	Vertex3D spriteVertices[NUMBER_OF_VERTICES];
-	uint32_t spriteIndices[NUMBER_OF_INDICES] = { 0, 1, 2, 2, 3, 0 };
+	spriteIndices[0] = firstVertexIndex;
+	spriteIndices[1] = firstVertexIndex + 1U;
+	spriteIndices[2] = firstVertexIndex + 2U;
+	spriteIndices[3] = firstVertexIndex + 2U;
+	spriteIndices[4] = firstVertexIndex + 3U;
+	spriteIndices[5] = firstVertexIndex;
 
 	Vertex3D spriteVertex;
 	spriteVertex.m_Color = RGBA::WHITE;
 
-	Vector2 spriteMinimums = m_SpriteResource->m_Pivot.GetNegatedVector2();
-	Vector2 spriteMaximums = spriteMinimums + m_SpriteResource->m_Dimensions;
+	Vector2 spriteMinimums = spriteResource->m_Pivot.GetNegatedVector2();
+	Vector2 spriteMaximums = spriteMinimums + spriteResource->m_Dimensions;
 
-	Vector2 spriteTextureMinimums = m_SpriteResource->m_TextureCoordinates.minimums;
-	Vector2 spriteTextureMaximums = m_SpriteResource->m_TextureCoordinates.maximums;
+	Vector2 spriteTextureMinimums = spriteResource->m_TextureCoordinates.minimums;
+	Vector2 spriteTextureMaximums = spriteResource->m_TextureCoordinates.maximums;
 
-	float cosAngle = CosineOfDegrees(m_Rotation);
-	float sinAngle = SineOfDegrees(m_Rotation);
+	float cosAngle = CosineOfDegrees(spriteRotation);
+	float sinAngle = SineOfDegrees(spriteRotation);
 
 	Vector3 boundingPoint = Vector3::ZERO;
 
-	boundingPoint.X = (m_Scale.X * spriteMinimums.X * cosAngle) - (m_Scale.Y * spriteMinimums.Y * sinAngle) + m_Position.X;
-	boundingPoint.Y = (m_Scale.X * spriteMinimums.X * sinAngle) + (m_Scale.Y * spriteMinimums.Y * cosAngle) + m_Position.Y;
+	boundingPoint.X = (spriteScale.X * spriteMinimums.X * cosAngle) - (spriteScale.Y * spriteMinimums.Y * sinAngle) + spritePosition.X;
+	boundingPoint.Y = (spriteScale.X * spriteMinimums.X * sinAngle) + (spriteScale.Y * spriteMinimums.Y * cosAngle) + spritePosition.Y;
 	spriteVertex.m_Position = boundingPoint;
 	spriteVertex.m_TextureCoordinates = Vector2(spriteTextureMinimums.X, spriteTextureMaximums.Y);
 	spriteVertices[0] = spriteVertex;
 
-	boundingPoint.X = (m_Scale.X * spriteMaximums.X * cosAngle) - (m_Scale.Y * spriteMinimums.Y * sinAngle) + m_Position.X;
-	boundingPoint.Y = (m_Scale.X * spriteMaximums.X * sinAngle) + (m_Scale.Y * spriteMinimums.Y * cosAngle) + m_Position.Y;
+	boundingPoint.X = (spriteScale.X * spriteMaximums.X * cosAngle) - (spriteScale.Y * spriteMinimums.Y * sinAngle) + spritePosition.X;
+	boundingPoint.Y = (spriteScale.X * spriteMaximums.X * sinAngle) + (spriteScale.Y * spriteMinimums.Y * cosAngle) + spritePosition.Y;
 	spriteVertex.m_Position = boundingPoint;
 	spriteVertex.m_TextureCoordinates = Vector2(spriteTextureMaximums.X, spriteTextureMaximums.Y);
 	spriteVertices[1] = spriteVertex;
 
-	boundingPoint.X = (m_Scale.X * spriteMaximums.X * cosAngle) - (m_Scale.Y * spriteMaximums.Y * sinAngle) + m_Position.X;
-	boundingPoint.Y = (m_Scale.X * spriteMaximums.X * sinAngle) + (m_Scale.Y * spriteMaximums.Y * cosAngle) + m_Position.Y;
+	boundingPoint.X = (spriteScale.X * spriteMaximums.X * cosAngle) - (spriteScale.Y * spriteMaximums.Y * sinAngle) + spritePosition.X;
+	boundingPoint.Y = (spriteScale.X * spriteMaximums.X * sinAngle) + (spriteScale.Y * spriteMaximums.Y * cosAngle) + spritePosition.Y;
 	spriteVertex.m_Position = boundingPoint;
 	spriteVertex.m_TextureCoordinates = Vector2(spriteTextureMaximums.X, spriteTextureMinimums.Y);
 	spriteVertices[2] = spriteVertex;
 
-	boundingPoint.X = (m_Scale.X * spriteMinimums.X * cosAngle) - (m_Scale.Y * spriteMaximums.Y * sinAngle) + m_Position.X;
-	boundingPoint.Y = (m_Scale.X * spriteMinimums.X * sinAngle) + (m_Scale.Y * spriteMaximums.Y * cosAngle) + m_Position.Y;
+	boundingPoint.X = (spriteScale.X * spriteMinimums.X * cosAngle) - (spriteScale.Y * spriteMaximums.Y * sinAngle) + spritePosition.X;
+	boundingPoint.Y = (spriteScale.X * spriteMinimums.X * sinAngle) + (spriteScale.Y * spriteMaximums.Y * cosAngle) + spritePosition.Y;
 	spriteVertex.m_Position = boundingPoint;
 	spriteVertex.m_TextureCoordinates = Vector2(spriteTextureMinimums.X, spriteTextureMinimums.Y);
 	spriteVertices[3] = spriteVertex;
-
-	m_Mesh->WriteToMesh(&spriteVertices[0], &spriteIndices[0], NUMBER_OF_VERTICES, NUMBER_OF_INDICES);
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 #include "Engine/Math/VectorMath/2D/Vector2.hpp"
 #include "Engine/Renderer/MeshAndMaterial/Mesh.hpp"
 #include "Engine/Renderer/MeshAndMaterial/Material.hpp"
@@ -7,6 +9,10 @@
 
 
 
+const int32_t INVALID_SPATIAL_PROXY_ID = -1;
+
+
+
 class Sprite
 {
 protected:
@@ -26,6 +32,7 @@ public:
 	Vector2 GetSpritePosition() const;
 
 	AABB2 GetSpriteWorldBounds() const;
+	AABB2 GetSpriteCullingBounds() const;
 	Vector2 GetSpriteDimensions() const;
 
 	void SetLayerID(uint8_t layerID);
@@ -36,21 +43,31 @@ public:
 	bool IsSpriteEnabled() const;
 
 	void SetMaterial(Material* spriteMaterial);
+	Material* GetMaterial() const;
+	const SpriteResource* GetSpriteResource() const;
+
+	void SetSpatialProxyID(int32_t spatialProxyID);
+	int32_t GetSpatialProxyID() const;
 
 	void Render() const;
 
+	static void WriteSpriteQuad(const SpriteResource* spriteResource, const Vector2& spritePosition, const Vector2& spriteScale, float spriteRotation, Vertex3D* spriteVertices, uint32_t* spriteIndices, uint32_t firstVertexIndex);
+
+protected:
+	void UpdateSpatialProxy(const Vector2& spriteDisplacement);
+
 private:
-	void UpdateSpriteMesh() const;
+	void WriteSpriteVertices(Vertex3D* spriteVertices, uint32_t* spriteIndices) const;
 
 protected:
 	Vector2 m_Scale;
 	float m_Rotation;
 	Vector2 m_Position;
 
-	Mesh* m_Mesh;
 	Material* m_Material;
 	uint8_t m_LayerID;
 	bool m_IsEnabled;
+	int32_t m_SpatialProxyID;
 
 	const SpriteResource* m_SpriteResource;
 };
\ No newline at end of file
@@ -0,0 +1,210 @@
+#include <algorithm>
+
+#include "Engine/Renderer/SpriteRendering/SpriteBatcher.hpp"
+#include "Engine/Renderer/ParticleSystem/ParticleRandom.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+#include "Engine/ErrorHandling/StringUtils.hpp"
+#include "Engine/Time/Time.hpp"
+
+
+
+bool CompareSpriteBatchEntries::operator()(const SpriteBatchEntry& firstEntry, const SpriteBatchEntry& secondEntry) const
+{
+	if (firstEntry.m_Material != secondEntry.m_Material)
+	{
+		return (firstEntry.m_Material < secondEntry.m_Material);
+	}
+
+	return (firstEntry.m_Texture < secondEntry.m_Texture);
+}
+
+
+
+void SpriteBatcher::ClearSprites()
+{
+	m_Entries.clear();
+	m_Batches.clear();
+}
+
+
+
+void SpriteBatcher::AddSprite(const Sprite* currentSprite)
+{
+	const SpriteResource* spriteResource = currentSprite->GetSpriteResource();
+
+	SpriteBatchEntry spriteEntry;
+	spriteEntry.m_Material = currentSprite->GetMaterial();
+	spriteEntry.m_Texture = spriteResource->m_Texture;
+	spriteEntry.m_SpriteResource = spriteResource;
+	spriteEntry.m_Position = currentSprite->GetSpritePosition();
+	spriteEntry.m_Scale = currentSprite->GetSpriteScale();
+	spriteEntry.m_Rotation = currentSprite->GetSpriteRotation();
+
+	m_Entries.push_back(spriteEntry);
+}
+
+
+
+void SpriteBatcher::AddSpriteEntry(const SpriteBatchEntry& spriteEntry)
+{
+	m_Entries.push_back(spriteEntry);
+}
+
+
+
+void SpriteBatcher::BuildBatches()
+{
+	m_Batches.clear();
+	std::sort(m_Entries.begin(), m_Entries.end(), CompareSpriteBatchEntries());
+
+	for (size_t entryIndex = 0; entryIndex < m_Entries.size(); ++entryIndex)
+	{
+		const SpriteBatchEntry& currentEntry = m_Entries[entryIndex];
+
+		if (!m_Batches.empty())
+		{
+			SpriteBatch& currentBatch = m_Batches.back();
+			if (currentBatch.m_Material == currentEntry.m_Material && currentBatch.m_Texture == currentEntry.m_Texture && currentBatch.m_NumberOfSprites < MAXIMUM_SPRITES_PER_BATCH)
+			{
+				++currentBatch.m_NumberOfSprites;
+				continue;
+			}
+		}
+
+		SpriteBatch newBatch;
+		newBatch.m_Material = currentEntry.m_Material;
+		newBatch.m_Texture = currentEntry.m_Texture;
+		newBatch.m_FirstEntryIndex = entryIndex;
+		newBatch.m_NumberOfSprites = 1U;
+		m_Batches.push_back(newBatch);
+	}
+}
+
+
+
+void SpriteBatcher::SubmitBatches(RenderCommandBuffer& commandBuffer, uint8_t layerID) const
+{
+	for (const SpriteBatch& currentBatch : m_Batches)
+	{
+		StreamingMeshAllocation batchAllocation;
+		if (!commandBuffer.AllocateTransientMesh(currentBatch.m_NumberOfSprites * 4U, currentBatch.m_NumberOfSprites * 6U, &batchAllocation))
+		{
+			continue;
+		}
+
+		for (size_t spriteIndex = 0; spriteIndex < currentBatch.m_NumberOfSprites; ++spriteIndex)
+		{
+			const SpriteBatchEntry& currentEntry = m_Entries[currentBatch.m_FirstEntryIndex + spriteIndex];
+			Vertex3D* quadVertices = batchAllocation.m_Vertices + (spriteIndex * 4U);
+			uint32_t* quadIndices = batchAllocation.m_Indices + (spriteIndex * 6U);
+			uint32_t firstVertexIndex = static_cast<uint32_t>(spriteIndex * 4U);
+
+			Sprite::WriteSpriteQuad(currentEntry.m_SpriteResource, currentEntry.m_Position, currentEntry.m_Scale, currentEntry.m_Rotation, quadVertices, quadIndices, firstVertexIndex);
+		}
+
+		commandBuffer.DrawTransientMesh(commandBuffer.GetNextSortKey(layerID), batchAllocation, currentBatch.m_Material, currentBatch.m_Texture);
+	}
+}
+
+
+
+size_t SpriteBatcher::GetNumberOfSprites() const
+{
+	return m_Entries.size();
+}
+
+
+
+size_t SpriteBatcher::GetNumberOfBatches() const
+{
+	return m_Batches.size();
+}
+
+
+
+void SpriteBatchBenchmarkCommand(Command& currentCommand)
+{
+	size_t numberOfSprites = 20000;
+	size_t numberOfMaterials = 8;
+	size_t numberOfFrames = 120;
+
+	std::vector<std::string> currentCommandArguments;
+	currentCommand.GetCommandArguments(currentCommandArguments);
+
+	if (currentCommandArguments.size() > 3)
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine("Too many arguments. SpriteBatchBenchmark takes the number of sprites, materials and frames as optional arguments.", RGBA::RED));
+		return;
+	}
+
+	if (currentCommandArguments.size() > 0)
+	{
+		numberOfSprites = static_cast<size_t>(stoul(currentCommandArguments[0]));
+	}
+
+	if (currentCommandArguments.size() > 1)
+	{
+		numberOfMaterials = static_cast<size_t>(stoul(currentCommandArguments[1]));
+	}
+
+	if (currentCommandArguments.size() > 2)
+	{
+		numberOfFrames = static_cast<size_t>(stoul(currentCommandArguments[2]));
+	}
+
+	numberOfMaterials = (numberOfMaterials > 0U) ? numberOfMaterials : 1U;
+	numberOfFrames = (numberOfFrames > 0U) ? numberOfFrames : 1U;
+
+	std::vector<Material> benchmarkMaterials(numberOfMaterials);
+	SpriteResource benchmarkResource;
+	ParticleRandom benchmarkRandom(1U);
+
+	std::vector<SpriteBatchEntry> benchmarkEntries(numberOfSprites);
+	for (size_t spriteIndex = 0; spriteIndex < numberOfSprites; ++spriteIndex)
+	{
+		SpriteBatchEntry& currentEntry = benchmarkEntries[spriteIndex];
+		currentEntry.m_Material = &benchmarkMaterials[benchmarkRandom.GetNextInteger() % numberOfMaterials];
+		currentEntry.m_Texture = nullptr;
+		currentEntry.m_SpriteResource = &benchmarkResource;
+		currentEntry.m_Position = benchmarkRandom.GetVector2WithinRange(Vector2(-100.0f, -100.0f), Vector2(100.0f, 100.0f));
+		currentEntry.m_Scale = Vector2::ONE;
+		currentEntry.m_Rotation = benchmarkRandom.GetFloatWithinRange(0.0f, 360.0f);
+	}
+
+	SpriteBatcher spriteBatcher;
+	RenderCommandBuffer commandBuffer;
+	NullRenderBackend nullBackend;
+
+	double startTime = GetCurrentTimeInMilliseconds();
+	for (size_t frameIndex = 0; frameIndex < numberOfFrames; ++frameIndex)
+	{
+		spriteBatcher.ClearSprites();
+		for (const SpriteBatchEntry& currentEntry : benchmarkEntries)
+		{
+			spriteBatcher.AddSpriteEntry(currentEntry);
+		}
+
+		spriteBatcher.BuildBatches();
+
+		nullBackend.BeginFrame();
+		commandBuffer.ResetCommandBuffer();
+		commandBuffer.ReserveTransientMeshes(&nullBackend, spriteBatcher.GetNumberOfSprites() * 4U, spriteBatcher.GetNumberOfSprites() * 6U);
+		spriteBatcher.SubmitBatches(commandBuffer, 0U);
+		commandBuffer.SortCommands();
+
+		commandBuffer.ExecuteCommands(&nullBackend);
+		nullBackend.EndFrame();
+	}
+
+	double frameTime = (GetCurrentTimeInMilliseconds() - startTime) / static_cast<double>(numberOfFrames);
+	size_t drawsPerFrame = nullBackend.m_NumberOfDraws / numberOfFrames;
+	size_t maximumExpectedDraws = numberOfMaterials + (numberOfSprites / MAXIMUM_SPRITES_PER_BATCH);
+
+	if (nullBackend.m_NumberOfVertices != numberOfSprites * 4U * numberOfFrames || drawsPerFrame > maximumExpectedDraws)
+	{
+		DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("Sprite batching produced %u draws and %u vertices per frame, expected at most %u draws.", drawsPerFrame, nullBackend.m_NumberOfVertices / numberOfFrames, maximumExpectedDraws), RGBA::RED));
+		return;
+	}
+
+	DeveloperConsole::AddNewConsoleLine(ConsoleLine(Stringf("%u sprites, %u materials: %u draws instead of %u, %.3f ms per frame.", numberOfSprites, numberOfMaterials, drawsPerFrame, numberOfSprites, frameTime), RGBA::GREEN));
+}
\ No newline at end of file
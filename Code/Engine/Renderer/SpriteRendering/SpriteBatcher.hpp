@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "Engine/Renderer/SpriteRendering/Sprite.hpp"
+#include "Engine/Renderer/RenderUtilities/RenderCommandBuffer.hpp"
+#include "Engine/DeveloperConsole/Command.hpp"
+
+
+
+const size_t MAXIMUM_SPRITES_PER_BATCH = 4096;
+
+
+
+struct SpriteBatchEntry
+{
+	Material* m_Material;
+	Texture* m_Texture;
+	const SpriteResource* m_SpriteResource;
+	Vector2 m_Position;
+	Vector2 m_Scale;
+	float m_Rotation;
+};
+
+
+
+struct CompareSpriteBatchEntries
+{
+	bool operator()(const SpriteBatchEntry& firstEntry, const SpriteBatchEntry& secondEntry) const;
+};
+
+
+
+struct SpriteBatch
+{
+	Material* m_Material;
+	Texture* m_Texture;
+	size_t m_FirstEntryIndex;
+	size_t m_NumberOfSprites;
+};
+
+
+
+class SpriteBatcher
+{
+public:
+	void ClearSprites();
+	void AddSprite(const Sprite* currentSprite);
+	void AddSpriteEntry(const SpriteBatchEntry& spriteEntry);
+
+	void BuildBatches();
+	void SubmitBatches(RenderCommandBuffer& commandBuffer, uint8_t layerID) const;
+
+	size_t GetNumberOfSprites() const;
+	size_t GetNumberOfBatches() const;
+
+private:
+	std::vector<SpriteBatchEntry> m_Entries;
+	std::vector<SpriteBatch> m_Batches;
+};
+
+
+
+void SpriteBatchBenchmarkCommand(Command& currentCommand);
\ No newline at end of file
@@ -11,6 +11,7 @@ SpriteDatabase* g_SpriteDatabase = nullptr;
 
 std::map<const char*, SpriteResource*, CompareCStrings, UntrackedAllocator<std::pair<const char*, SpriteResource*>>> SpriteDatabase::s_SpriteRegistry;
 std::map<const char*, AnimationSequence*, CompareCStrings, UntrackedAllocator<std::pair<const char*, AnimationSequence*>>> SpriteDatabase::s_AnimationRegistry;
+std::vector<std::string> SpriteDatabase::s_AtlasPageNames;
 
 
 
@@ -59,17 +60,7 @@ SpriteResource* SpriteDatabase::AddSpriteResource(const char* spriteResourceID,
 	SpriteResource* spriteResource = new SpriteResource();
 	spriteResource->m_ID = spriteResourceID;
 	spriteResource->m_Material = SpriteRenderer::SingletonInstance()->GetDefaultMaterial();
-
-	SamplerData samplerData = SamplerData(REPEAT_WRAP, REPEAT_WRAP, LINEAR_FILTER, NEAREST_FILTER);
-	spriteResource->m_Texture = Texture::CreateOrGetTexture(textureFilePath, samplerData);
-
-	IntVector2 texelSize = spriteResource->m_Texture->m_TexelSize;
-	float spriteWidth = static_cast<float>(texelSize.X) * SpriteRenderer::SingletonInstance()->GetVirtualToImportRatio();
-	float spriteHeight = static_cast<float>(texelSize.Y) * SpriteRenderer::SingletonInstance()->GetVirtualToImportRatio();
-
-	spriteResource->m_Dimensions = Vector2(spriteWidth, spriteHeight);
-	spriteResource->m_Pivot = Vector2(spriteWidth / 2.0f, spriteHeight / 2.0f);
-
+	spriteResource->m_TextureFilePath = textureFilePath;
 	spriteResource->m_TextureCoordinates = textureCoordinates;
 
 	s_SpriteRegistry[spriteResourceID] = spriteResource;
@@ -92,6 +83,65 @@ AnimationSequence* SpriteDatabase::AddAnimationSequence(const char* animationSeq
 
 
 
+void SpriteDatabase::BuildSpriteAtlas(const char* atlasCacheFilePath, const IntVector2& pageSize /*= IntVector2(DEFAULT_ATLAS_PAGE_SIZE, DEFAULT_ATLAS_PAGE_SIZE)*/, int texelPadding /*= DEFAULT_ATLAS_TEXEL_PADDING*/)
+{
+	TextureAtlas spriteAtlas;
+	std::vector<SpriteResource*> atlasResources;
+	std::vector<size_t> sourceIndices;
+	for (const auto& spriteRegistryPair : s_SpriteRegistry)
+	{
+		if (spriteRegistryPair.second->m_Texture == nullptr)
+		{
+			sourceIndices.push_back(spriteAtlas.AddSourceImage(spriteRegistryPair.second->m_TextureFilePath.c_str()));
+			atlasResources.push_back(spriteRegistryPair.second);
+		}
+	}
+
+	if (atlasResources.empty())
+	{
+		return;
+	}
+
+	if (!spriteAtlas.LoadAtlasCache(atlasCacheFilePath, pageSize, texelPadding))
+	{
+		bool isPacked = spriteAtlas.PackAtlas(pageSize, texelPadding);
+		ASSERT_OR_DIE(isPacked, "Sprite atlas source images could not be loaded.");
+
+		spriteAtlas.SaveAtlasCache(atlasCacheFilePath);
+	}
+
+	std::vector<Texture*> pageTextures;
+	SamplerData samplerData = SamplerData(CLAMP_WRAP, CLAMP_WRAP, LINEAR_FILTER, NEAREST_FILTER);
+	for (size_t pageIndex = 0; pageIndex < spriteAtlas.GetNumberOfPages(); ++pageIndex)
+	{
+		const TextureAtlasPage& atlasPage = spriteAtlas.GetAtlasPage(pageIndex);
+		s_AtlasPageNames.push_back(Stringf("%s#Page%u", atlasCacheFilePath, s_AtlasPageNames.size()));
+		pageTextures.push_back(Texture::CreateOrGetTextureFromTexels(s_AtlasPageNames.back().c_str(), atlasPage.m_TexelSize, atlasPage.m_Texels.data(), samplerData));
+	}
+
+	for (size_t resourceIndex = 0; resourceIndex < atlasResources.size(); ++resourceIndex)
+	{
+		SpriteResource* spriteResource = atlasResources[resourceIndex];
+		const TextureAtlasEntry& atlasEntry = spriteAtlas.GetAtlasEntry(sourceIndices[resourceIndex]);
+
+		spriteResource->m_Texture = pageTextures[atlasEntry.m_PageIndex];
+		SetSpriteDimensions(spriteResource, atlasEntry.m_TexelSize);
+		spriteResource->m_TextureCoordinates = TextureAtlas::RemapTextureCoordinates(atlasEntry, spriteResource->m_TextureCoordinates);
+	}
+}
+
+
+
+void SpriteDatabase::LoadSpriteTextures()
+{
+	for (auto& spriteRegistryPair : s_SpriteRegistry)
+	{
+		LoadSpriteTexture(spriteRegistryPair.second);
+	}
+}
+
+
+
 void SpriteDatabase::DestroyAllSpriteResources()
 {
 	for (auto currentSpriteResource = s_SpriteRegistry.begin(); currentSpriteResource != s_SpriteRegistry.end();)
@@ -119,6 +169,7 @@ const SpriteResource* SpriteDatabase::GetConstantSpriteResource(const char* spri
 	auto spriteRegistryIterator = s_SpriteRegistry.find(spriteResourceID);
 	if (spriteRegistryIterator != s_SpriteRegistry.end())
 	{
+		LoadSpriteTexture(spriteRegistryIterator->second);
 		return spriteRegistryIterator->second;
 	}
 
@@ -132,6 +183,7 @@ SpriteResource* SpriteDatabase::GetEditableSpriteResource(const char* spriteReso
 	auto spriteRegistryIterator = s_SpriteRegistry.find(spriteResourceID);
 	if (spriteRegistryIterator != s_SpriteRegistry.end())
 	{
+		LoadSpriteTexture(spriteRegistryIterator->second);
 		return spriteRegistryIterator->second;
 	}
 
@@ -140,6 +192,29 @@ SpriteResource* SpriteDatabase::GetEditableSpriteResource(const char* spriteReso
 
 
 
+void SpriteDatabase::LoadSpriteTexture(SpriteResource* spriteResource)
+{
+	if (spriteResource->m_Texture == nullptr)
+	{
+		SamplerData samplerData = SamplerData(REPEAT_WRAP, REPEAT_WRAP, LINEAR_FILTER, NEAREST_FILTER);
+		spriteResource->m_Texture = Texture::CreateOrGetTexture(spriteResource->m_TextureFilePath.c_str(), samplerData);
+		SetSpriteDimensions(spriteResource, spriteResource->m_Texture->m_TexelSize);
+	}
+}
+
+
+
+void SpriteDatabase::SetSpriteDimensions(SpriteResource* spriteResource, const IntVector2& texelSize)
+{
+	float spriteWidth = static_cast<float>(texelSize.X) * SpriteRenderer::SingletonInstance()->GetVirtualToImportRatio();
+	float spriteHeight = static_cast<float>(texelSize.Y) * SpriteRenderer::SingletonInstance()->GetVirtualToImportRatio();
+
+	spriteResource->m_Dimensions = Vector2(spriteWidth, spriteHeight);
+	spriteResource->m_Pivot = Vector2(spriteWidth / 2.0f, spriteHeight / 2.0f);
+}
+
+
+
 const AnimationSequence* SpriteDatabase::GetConstantAnimationSequence(const char* animationSequenceID)
 {
 	auto animationRegistryIterator = s_AnimationRegistry.find(animationSequenceID);
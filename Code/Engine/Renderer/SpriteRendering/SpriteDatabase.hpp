@@ -1,8 +1,11 @@
 #pragma once
 
 #include <map>
+#include <string>
+#include <vector>
 #include "Engine/Renderer/SpriteRendering/SpriteResource.hpp"
 #include "Engine/Renderer/SpriteRendering/AnimatedSprite.hpp"
+#include "Engine/Renderer/Texture/TextureAtlas.hpp"
 #include "Engine/ErrorHandling/StringUtils.hpp"
 #include "Engine/DebugTools/MemoryAnalytics/UntrackedAllocator.hpp"
 
@@ -14,6 +17,9 @@ private:
 	SpriteDatabase();
 	SpriteDatabase(const SpriteDatabase&) = delete;
 
+	static void LoadSpriteTexture(SpriteResource* spriteResource);
+	static void SetSpriteDimensions(SpriteResource* spriteResource, const IntVector2& texelSize);
+
 public:
 	static void InitializeSpriteDatabase();
 	static void UninitializeSpriteDatabase();
@@ -23,6 +29,9 @@ public:
 	SpriteResource* AddSpriteResource(const char* spriteResourceID, const char* textureFilePath, const AABB2& textureCoordinates);
 	AnimationSequence* AddAnimationSequence(const char* animationSequenceID, const SpriteAnimationMode& animationMode);
 
+	void LoadSpriteTextures();
+	void BuildSpriteAtlas(const char* atlasCacheFilePath, const IntVector2& pageSize = IntVector2(DEFAULT_ATLAS_PAGE_SIZE, DEFAULT_ATLAS_PAGE_SIZE), int texelPadding = DEFAULT_ATLAS_TEXEL_PADDING);
+
 	static void DestroyAllSpriteResources();
 	static void DestroyAllAnimationSequences();
 
@@ -35,4 +44,5 @@ public:
 public:
 	static std::map<const char*, SpriteResource*, CompareCStrings, UntrackedAllocator<std::pair<const char*, SpriteResource*>>> s_SpriteRegistry;
 	static std::map<const char*, AnimationSequence*, CompareCStrings, UntrackedAllocator<std::pair<const char*, AnimationSequence*>>> s_AnimationRegistry;
+	static std::vector<std::string> s_AtlasPageNames;
 };
\ No newline at end of file
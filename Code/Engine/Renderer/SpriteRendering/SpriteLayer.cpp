@@ -1,10 +1,27 @@
 #include "Engine/Renderer/SpriteRendering/SpriteLayer.hpp"
+#include "Engine/Math/MathUtilities/MathUtilities.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
 
 
 
-SpriteLayer::SpriteLayer(uint8_t layerID) :
+bool SpriteCullingQuery::QueryCallback(int32_t currentProxyID)
+{
+	const Sprite* currentSprite = static_cast<const Sprite*>(m_SpatialTree->GetNodeData(currentProxyID));
+	if (currentSprite->IsSpriteEnabled())
+	{
+		m_SpriteBatcher->AddSprite(currentSprite);
+	}
+
+	return true;
+}
+
+
+
+SpriteLayer::SpriteLayer(uint8_t layerID, float proxyMargin) :
 m_ID(layerID),
-m_IsEnabled(true)
+m_IsEnabled(true),
+m_ProxyMargin(proxyMargin),
+m_SpatialTree(Vector2D(proxyMargin, proxyMargin))
 {
 
 }
@@ -14,6 +31,12 @@ m_IsEnabled(true)
 void SpriteLayer::AddSprite(Sprite* currentSprite)
 {
 	m_Sprites.insert(currentSprite);
+
+	if (currentSprite->GetSpatialProxyID() == INVALID_SPATIAL_PROXY_ID)
+	{
+		int32_t spatialProxyID = m_SpatialTree.AddFixtureToTree(ConvertToSpatialAABB(currentSprite->GetSpriteCullingBounds()), currentSprite);
+		currentSprite->SetSpatialProxyID(spatialProxyID);
+	}
 }
 
 
@@ -21,6 +44,20 @@ void SpriteLayer::AddSprite(Sprite* currentSprite)
 void SpriteLayer::RemoveSprite(Sprite* currentSprite)
 {
 	m_Sprites.erase(currentSprite);
+
+	if (currentSprite->GetSpatialProxyID() != INVALID_SPATIAL_PROXY_ID)
+	{
+		m_SpatialTree.RemoveFixtureFromTree(currentSprite->GetSpatialProxyID());
+		currentSprite->SetSpatialProxyID(INVALID_SPATIAL_PROXY_ID);
+	}
+}
+
+
+
+void SpriteLayer::MoveSprite(Sprite* currentSprite, const Vector2& spriteDisplacement)
+{
+	Vector2D fixtureDisplacement(ClampFloat(spriteDisplacement.X, -m_ProxyMargin, m_ProxyMargin), ClampFloat(spriteDisplacement.Y, -m_ProxyMargin, m_ProxyMargin));
+	m_SpatialTree.MoveFixtureWithinTree(currentSprite->GetSpatialProxyID(), ConvertToSpatialAABB(currentSprite->GetSpriteCullingBounds()), fixtureDisplacement);
 }
 
 
@@ -53,25 +90,54 @@ uint8_t SpriteLayer::GetLayerID() const
 
 
 
-void SpriteLayer::RenderAllSprites() const
+void SpriteLayer::SetCullingBounds(const AABB2& cullingBounds)
 {
-	for (const Sprite* currentSprite : m_Sprites)
-	{
-		if (currentSprite->IsSpriteEnabled())
-		{
-			currentSprite->Render();
-		}
-	}
+	m_CullingBounds = cullingBounds;
+}
+
+
+
+void SpriteLayer::CollectVisibleSprites(SpriteBatcher& spriteBatcher, const AABB2& viewBounds) const
+{
+	SpriteCullingQuery cullingQuery;
+	cullingQuery.m_SpatialTree = &m_SpatialTree;
+	cullingQuery.m_SpriteBatcher = &spriteBatcher;
+
+	m_SpatialTree.QueryAABB(&cullingQuery, ConvertToSpatialAABB(viewBounds));
+}
+
+
+
+void SpriteLayer::PrepareCommands(size_t* numberOfVertices, size_t* numberOfIndices) const
+{
+	m_SpriteBatcher.ClearSprites();
+	CollectVisibleSprites(m_SpriteBatcher, m_CullingBounds);
+	m_SpriteBatcher.BuildBatches();
+
+	*numberOfVertices = m_SpriteBatcher.GetNumberOfSprites() * 4U;
+	*numberOfIndices = m_SpriteBatcher.GetNumberOfSprites() * 6U;
+}
+
+
+
+void SpriteLayer::RecordCommands(RenderCommandBuffer& commandBuffer, uint8_t layerID) const
+{
+	m_SpriteBatcher.SubmitBatches(commandBuffer, layerID);
 }
 
 
 
 void SpriteLayer::UpdateAllParticleSystems(float deltaTimeInSeconds)
 {
+	MEMORY_SCOPE("Particles");
+
+	m_UpdatingEmitters.clear();
 	for (ParticleSystem* currentParticleSystem : m_ParticleSystems)
 	{
-		currentParticleSystem->Update(deltaTimeInSeconds);
+		m_UpdatingEmitters.insert(m_UpdatingEmitters.end(), currentParticleSystem->m_ParticleEmitters.begin(), currentParticleSystem->m_ParticleEmitters.end());
 	}
+
+	ParticleEmitter::UpdateParticleEmitters(m_UpdatingEmitters, deltaTimeInSeconds);
 }
 
 
@@ -94,10 +160,17 @@ void SpriteLayer::DestroyTerminatedParticleSystems()
 
 
 
-void SpriteLayer::RenderAllParticleSystems() const
+const std::set<ParticleSystem*>& SpriteLayer::GetParticleSystems() const
 {
-	for (const ParticleSystem* currentParticleSystem : m_ParticleSystems)
-	{
-		currentParticleSystem->Render();
-	}
+	return m_ParticleSystems;
+}
+
+
+
+AABB2D ConvertToSpatialAABB(const AABB2& spriteBounds)
+{
+	Vector2D spatialMinimums(spriteBounds.minimums.X, spriteBounds.minimums.Y);
+	Vector2D spatialMaximums(spriteBounds.maximums.X, spriteBounds.maximums.Y);
+
+	return AABB2D(spatialMinimums, spatialMaximums);
 }
\ No newline at end of file
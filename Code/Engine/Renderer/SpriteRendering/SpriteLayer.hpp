@@ -1,8 +1,11 @@
 #pragma once
 
 #include <set>
+#include <vector>
 #include "Engine/Renderer/SpriteRendering/Sprite.hpp"
+#include "Engine/Renderer/SpriteRendering/SpriteBatcher.hpp"
 #include "Engine/Renderer/ParticleSystem/ParticleSystem.hpp"
+#include "Engine/PhysicsSystem/CollisionDetection/BroadPhaseCollision.hpp"
 
 
 
@@ -10,13 +13,30 @@
 
 
 
-class SpriteLayer
+const float SPRITE_PROXY_MARGIN_FRACTION = 0.02f;
+
+
+
+struct SpriteCullingQuery
+{
+	bool QueryCallback(int32_t currentProxyID);
+
+	const DynamicAABBTree* m_SpatialTree;
+	SpriteBatcher* m_SpriteBatcher;
+};
+
+
+
+
+
+class SpriteLayer : public RenderCommandRecorder
 {
 public:
-	SpriteLayer(uint8_t layerID);
+	SpriteLayer(uint8_t layerID, float proxyMargin);
 
 	void AddSprite(Sprite* currentSprite);
 	void RemoveSprite(Sprite* currentSprite);
+	void MoveSprite(Sprite* currentSprite, const Vector2& spriteDisplacement);
 
 	void RegisterParticleSystem(ParticleSystem* particleSystem);
 
@@ -24,16 +44,29 @@ public:
 	bool IsLayerEnabled() const;
 	uint8_t GetLayerID() const;
 
-	void RenderAllSprites() const;
+	void SetCullingBounds(const AABB2& cullingBounds);
+	void CollectVisibleSprites(SpriteBatcher& spriteBatcher, const AABB2& viewBounds) const;
+	virtual void PrepareCommands(size_t* numberOfVertices, size_t* numberOfIndices) const override;
+	virtual void RecordCommands(RenderCommandBuffer& commandBuffer, uint8_t layerID) const override;
 
 	void UpdateAllParticleSystems(float deltaTimeInSeconds);
 	void DestroyTerminatedParticleSystems();
-	void RenderAllParticleSystems() const;
+	const std::set<ParticleSystem*>& GetParticleSystems() const;
 
 private:
 	uint8_t m_ID;
 	bool m_IsEnabled;
 
 	std::set<Sprite*> m_Sprites;
+	float m_ProxyMargin;
+	DynamicAABBTree m_SpatialTree;
+	AABB2 m_CullingBounds;
+	mutable SpriteBatcher m_SpriteBatcher;
+
 	std::set<ParticleSystem*> m_ParticleSystems;
-};
\ No newline at end of file
+	std::vector<ParticleEmitter*> m_UpdatingEmitters;
+};
+
+
+
+AABB2D ConvertToSpatialAABB(const AABB2& spriteBounds);
\ No newline at end of file
@@ -1,8 +1,12 @@
+#include <algorithm>
+
 #include "Engine/Renderer/SpriteRendering/SpriteRenderer.hpp"
 #include "Engine/Renderer/RenderUtilities/AdvancedRenderer.hpp"
+#include "Engine/Renderer/Texture/TextureAtlas.hpp"
 #include "Engine/Math/MatrixMath/Matrix4.hpp"
 #include "Engine/DeveloperConsole/DeveloperConsole.hpp"
 #include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
 
 
 
@@ -17,13 +21,20 @@ bool CompareLayerIDs::operator()(SpriteLayer* firstLayer, SpriteLayer* secondLay
 
 
 
-SpriteRenderer::SpriteRenderer()
+SpriteRenderer::SpriteRenderer() :
+m_VirtualSize(1.0f),
+m_ImportSize(1.0f)
 {
 	m_RendererClock = new Clock();
 	m_DefaultMaterial = new Material("Data/Shaders/DefaultShader.vert", "Data/Shaders/DefaultShader.frag");
+	m_RenderBackend = &m_OpenGLRenderBackend;
 
 	DeveloperConsole::RegisterCommands("EnableSpriteLayer", "Enables the given layer. Takes layer ID as argument.", EnableLayerCommand);
 	DeveloperConsole::RegisterCommands("DisableSpriteLayer", "Disables the given layer. Takes layer ID as argument.", DisableLayerCommand);
+	DeveloperConsole::RegisterCommands("ParticleBenchmark", "Measures headless particle update cost across job threads. Takes the number of particles, emitters and frames as optional arguments.", ParticleBenchmarkCommand);
+	DeveloperConsole::RegisterCommands("StreamingRingTest", "Checks the streaming vertex ring's wrap and frame fencing logic without touching the GPU.", StreamingRingTestCommand);
+	DeveloperConsole::RegisterCommands("SpriteBatchBenchmark", "Measures headless sprite batching cost and draw count. Takes the number of sprites, materials and frames as optional arguments.", SpriteBatchBenchmarkCommand);
+	DeveloperConsole::RegisterCommands("TextureAtlasTest", "Checks the texture atlas packer's placement, padding and coordinate remapping without touching the GPU.", TextureAtlasTestCommand);
 }
 
 
@@ -33,6 +44,11 @@ SpriteRenderer::~SpriteRenderer()
 	delete m_RendererClock;
 	delete m_DefaultMaterial;
 
+	for (RenderCommandBuffer* currentRecordBuffer : m_RecordBuffers)
+	{
+		delete currentRecordBuffer;
+	}
+
 	for (auto spriteLayerIterator = m_SpriteLayers.begin(); spriteLayerIterator != m_SpriteLayers.end();)
 	{
 		SpriteLayer* currentSpriteLayer = *spriteLayerIterator;
@@ -82,6 +98,8 @@ SpriteRenderer* SpriteRenderer::SingletonInstance()
 
 void SpriteRenderer::Update()
 {
+	MEMORY_SCOPE("Sprites");
+
 	float deltaTimeInSeconds = m_RendererClock->GetDeltaTimeFloat();
 	for (AnimatedSprite* currentAnimatedSprite : m_AnimatedSprites)
 	{
@@ -95,22 +113,32 @@ void SpriteRenderer::Update()
 
 void SpriteRenderer::Render() const
 {
-	AdvancedRenderer::SingletonInstance()->ClearScreen(m_ClearColor);
-	AdvancedRenderer::SingletonInstance()->EnableBackFaceCulling(true);
-	AdvancedRenderer::SingletonInstance()->EnableDepthTesting(false);
+	MEMORY_SCOPE("Rendering");
 
 	Vector2 screenBottomLeft = GetScreenBounds().minimums;
 	Vector2 screenTopRight = GetScreenBounds().maximums;
-	
-	Matrix4 modelMatrix = Matrix4::IdentityMatrix4();
+
 	Matrix4 viewMatrix = Matrix4::IdentityMatrix4();
 	Matrix4 projectionMatrix = AdvancedRenderer::SingletonInstance()->GetOrthographicProjectionMatrix(screenBottomLeft, screenTopRight, -1.0f, 1.0f);
 
-	AdvancedRenderer::SingletonInstance()->UpdateModelMatrix(modelMatrix);
-	AdvancedRenderer::SingletonInstance()->UpdateViewMatrix(viewMatrix);
-	AdvancedRenderer::SingletonInstance()->UpdateProjectionMatrix(projectionMatrix);
+	m_CommandBuffer.ResetCommandBuffer();
+	m_CommandBuffer.ClearScreen(m_CommandBuffer.GetNextSortKey(0U), m_ClearColor);
+	m_CommandBuffer.SetRenderState(m_CommandBuffer.GetNextSortKey(0U), BACK_FACE_CULLING_STATE);
+	m_CommandBuffer.SetCameraMatrices(m_CommandBuffer.GetNextSortKey(0U), viewMatrix, projectionMatrix);
 
-	RenderAllLayers();
+	m_CommandBuffer.SortCommands();
+
+	m_RenderBackend->BeginFrame();
+
+	CollectRecordTasks();
+	RecordRenderTasks(m_RecordTasks, m_RenderBackend);
+
+	m_CommandBuffer.ExecuteCommands(m_RenderBackend);
+	for (const RenderRecordTask& currentTask : m_RecordTasks)
+	{
+		currentTask.m_CommandBuffer->ExecuteCommands(m_RenderBackend);
+	}
+	m_RenderBackend->EndFrame();
 }
 
 
@@ -122,6 +150,13 @@ void SpriteRenderer::SetClearColor(const RGBA& clearColor)
 
 
 
+void SpriteRenderer::SetRenderBackend(RenderBackend* renderBackend)
+{
+	m_RenderBackend = (renderBackend != nullptr) ? renderBackend : &m_OpenGLRenderBackend;
+}
+
+
+
 void SpriteRenderer::SetVirtualSize(float virtualSize)
 {
 	m_VirtualSize = virtualSize;
@@ -279,6 +314,14 @@ void SpriteRenderer::UnregisterSprite(Sprite* currentSprite)
 
 
 
+void SpriteRenderer::MoveSprite(Sprite* currentSprite, const Vector2& spriteDisplacement)
+{
+	SpriteLayer* currentLayer = CreateOrGetSpriteLayer(currentSprite->GetLayerID());
+	currentLayer->MoveSprite(currentSprite, spriteDisplacement);
+}
+
+
+
 void SpriteRenderer::RegisterAnimatedSprite(AnimatedSprite* currentAnimatedSprite)
 {
 	if (currentAnimatedSprite == nullptr)
@@ -369,6 +412,20 @@ void SpriteRenderer::PlayParticleSystem(const char* definitionID, const Vector2&
 
 
 
+void SpriteRenderer::AddOverlayRecorder(const RenderCommandRecorder* overlayRecorder)
+{
+	m_OverlayRecorders.push_back(overlayRecorder);
+}
+
+
+
+void SpriteRenderer::RemoveOverlayRecorder(const RenderCommandRecorder* overlayRecorder)
+{
+	m_OverlayRecorders.erase(std::remove(m_OverlayRecorders.begin(), m_OverlayRecorders.end(), overlayRecorder), m_OverlayRecorders.end());
+}
+
+
+
 SpriteLayer* SpriteRenderer::CreateOrGetSpriteLayer(uint8_t layerID)
 {
 	for (SpriteLayer* currentLayer : m_SpriteLayers)
@@ -379,7 +436,7 @@ SpriteLayer* SpriteRenderer::CreateOrGetSpriteLayer(uint8_t layerID)
 		}
 	}
 
-	SpriteLayer* newLayer = new SpriteLayer(layerID);
+	SpriteLayer* newLayer = new SpriteLayer(layerID, m_VirtualSize * SPRITE_PROXY_MARGIN_FRACTION);
 	m_SpriteLayers.insert(newLayer);
 
 	return newLayer;
@@ -408,16 +465,48 @@ void SpriteRenderer::UpdateAllLayers(float deltaTimeInSeconds)
 
 
 
-void SpriteRenderer::RenderAllLayers() const
+void SpriteRenderer::CollectRecordTasks() const
 {
-	for (const SpriteLayer* currentLayer : m_SpriteLayers)
+	m_RecordTasks.clear();
+
+	AABB2 viewBounds = GetScreenBounds();
+	for (SpriteLayer* currentLayer : m_SpriteLayers)
 	{
 		if (currentLayer->IsLayerEnabled())
 		{
-			currentLayer->RenderAllSprites();
-			currentLayer->RenderAllParticleSystems();
+			currentLayer->SetCullingBounds(viewBounds);
+			AddRecordTask(currentLayer, currentLayer->GetLayerID());
+
+			for (const ParticleSystem* currentParticleSystem : currentLayer->GetParticleSystems())
+			{
+				AddRecordTask(currentParticleSystem, currentLayer->GetLayerID());
+			}
 		}
 	}
+
+	for (const RenderCommandRecorder* currentOverlayRecorder : m_OverlayRecorders)
+	{
+		AddRecordTask(currentOverlayRecorder, OVERLAY_LAYER_ID);
+	}
+}
+
+
+
+void SpriteRenderer::AddRecordTask(const RenderCommandRecorder* recorder, uint8_t layerID) const
+{
+	size_t taskIndex = m_RecordTasks.size();
+	if (taskIndex == m_RecordBuffers.size())
+	{
+		m_RecordBuffers.push_back(new RenderCommandBuffer());
+	}
+
+	RenderRecordTask recordTask;
+	recordTask.m_Recorder = recorder;
+	recordTask.m_CommandBuffer = m_RecordBuffers[taskIndex];
+	recordTask.m_LayerID = layerID;
+	recordTask.m_NumberOfVertices = 0U;
+	recordTask.m_NumberOfIndices = 0U;
+	m_RecordTasks.push_back(recordTask);
 }
 
 
@@ -9,12 +9,17 @@
 #include "Engine/Renderer/SpriteRendering/Sprite.hpp"
 #include "Engine/Renderer/SpriteRendering/AnimatedSprite.hpp"
 #include "Engine/Renderer/SpriteRendering/SpriteLayer.hpp"
+#include "Engine/Renderer/SpriteRendering/SpriteBatcher.hpp"
 #include "Engine/Renderer/Color/RGBA.hpp"
 #include "Engine/DeveloperConsole/Command.hpp"
 #include "Engine/Time/Clock.hpp"
 
 
 
+const uint8_t OVERLAY_LAYER_ID = 0xFF;
+
+
+
 struct CompareLayerIDs
 {
 	bool operator()(SpriteLayer* firstLayer, SpriteLayer* secondLayer) const;
@@ -39,6 +44,7 @@ public:
 	void Render() const;
 
 	void SetClearColor(const RGBA& clearColor);
+	void SetRenderBackend(RenderBackend* renderBackend);
 
 	void SetVirtualSize(float virtualSize);
 	float GetVirtualSize() const;
@@ -65,6 +71,7 @@ public:
 
 	void RegisterSprite(Sprite* currentSprite);
 	void UnregisterSprite(Sprite* currentSprite);
+	void MoveSprite(Sprite* currentSprite, const Vector2& spriteDisplacement);
 
 	void RegisterAnimatedSprite(AnimatedSprite* currentAnimatedSprite);
 	void UnregisterAnimatedSprite(AnimatedSprite* currentAnimatedSprite);
@@ -77,11 +84,15 @@ public:
 
 	void PlayParticleSystem(const char* definitionID, const Vector2& spawnPosition);
 
+	void AddOverlayRecorder(const RenderCommandRecorder* overlayRecorder);
+	void RemoveOverlayRecorder(const RenderCommandRecorder* overlayRecorder);
+
 private:
 	SpriteLayer* CreateOrGetSpriteLayer(uint8_t layerID);
 	
 	void UpdateAllLayers(float deltaTimeInSeconds);
-	void RenderAllLayers() const;
+	void CollectRecordTasks() const;
+	void AddRecordTask(const RenderCommandRecorder* recorder, uint8_t layerID) const;
 
 private:
 	RGBA m_ClearColor;
@@ -98,6 +109,15 @@ private:
 
 	std::set<SpriteLayer*, CompareLayerIDs> m_SpriteLayers;
 	std::set<AnimatedSprite*> m_AnimatedSprites;
+
+	std::vector<const RenderCommandRecorder*> m_OverlayRecorders;
+
+	mutable RenderCommandBuffer m_CommandBuffer;
+	mutable std::vector<RenderCommandBuffer*> m_RecordBuffers;
+	mutable std::vector<RenderRecordTask> m_RecordTasks;
+
+	OpenGLRenderBackend m_OpenGLRenderBackend;
+	RenderBackend* m_RenderBackend;
 };
 
 void EnableLayerCommand(Command& currentCommand);
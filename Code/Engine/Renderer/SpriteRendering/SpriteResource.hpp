@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include "Engine/Math/VectorMath/2D/Vector2.hpp"
 #include "Engine/Math/VectorMath/2D/AABB2.hpp"
 #include "Engine/Renderer/MeshAndMaterial/Material.hpp"
@@ -19,6 +21,7 @@ public:
 	Vector2 m_Dimensions;
 	Vector2 m_Pivot;
 
+	std::string m_TextureFilePath;
 	Texture* m_Texture;
 	AABB2 m_TextureCoordinates;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Engine/Renderer/RenderUtilities/RenderConstants.hpp"
 #include "ThirdParty/stb/STB_Image.hpp"
 #include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
 
 
 
@@ -107,6 +108,22 @@ Texture::Texture(const IntVector2& texelSize, const TextureFormat& texelFormat,
 
 
 
+Texture::Texture(const IntVector2& texelSize, const unsigned char* texelData, const SamplerData& samplerData) :
+m_TextureID(0),
+m_TexelSize(texelSize),
+m_SamplerID(0)
+{
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glGenTextures(1, (GLuint*)&m_TextureID);
+	glBindTexture(GL_TEXTURE_2D, m_TextureID);
+
+	CreateSampler(samplerData);
+
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, texelSize.X, texelSize.Y, 0, GL_RGBA, GL_UNSIGNED_BYTE, texelData);
+}
+
+
+
 Texture* Texture::GetTextureByName(const char* imageFilePath)
 {
 	Texture* existingTexture = nullptr;
@@ -153,6 +170,8 @@ void Texture::CreateSampler(const SamplerData& samplerData)
 
 Texture* Texture::CreateOrGetTexture(const char* imageFilePath, const SamplerData& samplerData)
 {
+	MEMORY_SCOPE("Textures");
+
 	Texture* newTexture = GetTextureByName(imageFilePath);
 	if (newTexture == nullptr)
 	{
@@ -165,6 +184,22 @@ Texture* Texture::CreateOrGetTexture(const char* imageFilePath, const SamplerDat
 
 
 
+Texture* Texture::CreateOrGetTextureFromTexels(const char* textureName, const IntVector2& texelSize, const unsigned char* texelData, const SamplerData& samplerData)
+{
+	MEMORY_SCOPE("Textures");
+
+	Texture* newTexture = GetTextureByName(textureName);
+	if (newTexture == nullptr)
+	{
+		newTexture = new Texture(texelSize, texelData, samplerData);
+		s_TextureRegistry[textureName] = newTexture;
+	}
+
+	return newTexture;
+}
+
+
+
 Texture* Texture::CreateDefaultTexture(const IntVector2& texelSize, const TextureFormat& texelFormat, const SamplerData& samplerData, bool hasColorData /*= false*/, const RGBA& texelColor /*= RGBA::WHITE*/)
 {
 	Texture* newDefaultTexture = new Texture(texelSize, texelFormat, samplerData, hasColorData, texelColor);
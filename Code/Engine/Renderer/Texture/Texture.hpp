@@ -36,6 +36,7 @@ class Texture
 private:
 	Texture(const char* imageFilePath, const SamplerData& samplerData);
 	Texture(const IntVector2& texelSize, const TextureFormat& texelFormat, const SamplerData& samplerData, bool hasColorData = false, const RGBA& texelColor = RGBA::WHITE);
+	Texture(const IntVector2& texelSize, const unsigned char* texelData, const SamplerData& samplerData);
 
 	static Texture* GetTextureByName(const char* imageFilePath);
 
@@ -44,6 +45,7 @@ private:
 
 public:
 	static Texture* CreateOrGetTexture(const char* imageFilePath, const SamplerData& samplerData);
+	static Texture* CreateOrGetTextureFromTexels(const char* textureName, const IntVector2& texelSize, const unsigned char* texelData, const SamplerData& samplerData);
 	static Texture* CreateDefaultTexture(const IntVector2& texelSize, const TextureFormat& texelFormat, const SamplerData& samplerData, bool hasColorData = false, const RGBA& texelColor = RGBA::WHITE);
 
 	static void DestroyAllTextures();
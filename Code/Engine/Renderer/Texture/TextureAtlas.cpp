@@ -0,0 +1,714 @@
+#include <algorithm>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "Engine/Renderer/Texture/TextureAtlas.hpp"
+#include "Engine/DeveloperConsole/DeveloperConsole.hpp"
+#include "Engine/ErrorHandling/StringUtils.hpp"
+#include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
+#include "ThirdParty/stb/STB_Image.hpp"
+
+
+
+const uint32_t TextureAtlas::s_FileVersion = 1U;
+
+const uint64_t ATLAS_SIGNATURE_OFFSET_BASIS = 14695981039346656037ULL;
+const uint64_t ATLAS_SIGNATURE_PRIME = 1099511628211ULL;
+
+
+
+uint64_t HashAtlasBytes(uint64_t currentHash, const void* byteData, size_t numberOfBytes)
+{
+	const unsigned char* byteArray = reinterpret_cast<const unsigned char*>(byteData);
+	for (size_t byteIndex = 0; byteIndex < numberOfBytes; ++byteIndex)
+	{
+		currentHash ^= byteArray[byteIndex];
+		currentHash *= ATLAS_SIGNATURE_PRIME;
+	}
+
+	return currentHash;
+}
+
+
+
+SkylinePacker::SkylinePacker() :
+m_PageSize(0, 0),
+m_UsedArea(0U)
+{
+
+}
+
+
+
+void SkylinePacker::InitializePacker(const IntVector2& pageSize)
+{
+	m_PageSize = pageSize;
+	m_UsedArea = 0U;
+
+	SkylineNode startingNode;
+	startingNode.m_X = 0;
+	startingNode.m_Y = 0;
+	startingNode.m_Width = pageSize.X;
+
+	m_Skyline.clear();
+	m_Skyline.push_back(startingNode);
+}
+
+
+
+bool SkylinePacker::PackRectangle(const IntVector2& rectangleSize, IntVector2* rectanglePosition)
+{
+	if (rectangleSize.X <= 0 || rectangleSize.Y <= 0)
+	{
+		return false;
+	}
+
+	size_t bestNodeIndex = m_Skyline.size();
+	int bestTop = m_PageSize.Y + 1;
+	int bestWidth = m_PageSize.X + 1;
+	int bestY = 0;
+
+	for (size_t nodeIndex = 0; nodeIndex < m_Skyline.size(); ++nodeIndex)
+	{
+		int rectangleY = 0;
+		if (!FitRectangle(nodeIndex, rectangleSize, &rectangleY))
+		{
+			continue;
+		}
+
+		int rectangleTop = rectangleY + rectangleSize.Y;
+		if (rectangleTop < bestTop || (rectangleTop == bestTop && m_Skyline[nodeIndex].m_Width < bestWidth))
+		{
+			bestNodeIndex = nodeIndex;
+			bestTop = rectangleTop;
+			bestWidth = m_Skyline[nodeIndex].m_Width;
+			bestY = rectangleY;
+		}
+	}
+
+	if (bestNodeIndex == m_Skyline.size())
+	{
+		return false;
+	}
+
+	*rectanglePosition = IntVector2(m_Skyline[bestNodeIndex].m_X, bestY);
+	AddSkylineLevel(bestNodeIndex, *rectanglePosition, rectangleSize);
+	m_UsedArea += static_cast<size_t>(rectangleSize.X) * static_cast<size_t>(rectangleSize.Y);
+
+	return true;
+}
+
+
+
+IntVector2 SkylinePacker::GetPageSize() const
+{
+	return m_PageSize;
+}
+
+
+
+float SkylinePacker::GetPageOccupancy() const
+{
+	size_t pageArea = static_cast<size_t>(m_PageSize.X) * static_cast<size_t>(m_PageSize.Y);
+	if (pageArea == 0U)
+	{
+		return 0.0f;
+	}
+
+	return static_cast<float>(m_UsedArea) / static_cast<float>(pageArea);
+}
+
+
+
+bool SkylinePacker::FitRectangle(size_t nodeIndex, const IntVector2& rectangleSize, int* rectangleY) const
+{
+	if (m_Skyline[nodeIndex].m_X + rectangleSize.X > m_PageSize.X)
+	{
+		return false;
+	}
+
+	int remainingWidth = rectangleSize.X;
+	int fittedY = m_Skyline[nodeIndex].m_Y;
+	while (remainingWidth > 0)
+	{
+		fittedY = (m_Skyline[nodeIndex].m_Y > fittedY) ? m_Skyline[nodeIndex].m_Y : fittedY;
+		if (fittedY + rectangleSize.Y > m_PageSize.Y)
+		{
+			return false;
+		}
+
+		remainingWidth -= m_Skyline[nodeIndex].m_Width;
+		++nodeIndex;
+	}
+
+	*rectangleY = fittedY;
+	return true;
+}
+
+
+
+void SkylinePacker::AddSkylineLevel(size_t nodeIndex, const IntVector2& rectanglePosition, const IntVector2& rectangleSize)
+{
+	SkylineNode newNode;
+	newNode.m_X = rectanglePosition.X;
+	newNode.m_Y = rectanglePosition.Y + rectangleSize.Y;
+	newNode.m_Width = rectangleSize.X;
+	m_Skyline.insert(m_Skyline.begin() + nodeIndex, newNode);
+
+	for (size_t currentIndex = nodeIndex + 1; currentIndex < m_Skyline.size();)
+	{
+		const SkylineNode& previousNode = m_Skyline[currentIndex - 1];
+		SkylineNode& currentNode = m_Skyline[currentIndex];
+
+		int overlapWidth = (previousNode.m_X + previousNode.m_Width) - currentNode.m_X;
+		if (overlapWidth <= 0)
+		{
+			break;
+		}
+
+		currentNode.m_X += overlapWidth;
+		currentNode.m_Width -= overlapWidth;
+		if (currentNode.m_Width > 0)
+		{
+			break;
+		}
+
+		m_Skyline.erase(m_Skyline.begin() + currentIndex);
+	}
+
+	for (size_t currentIndex = 0; currentIndex + 1 < m_Skyline.size();)
+	{
+		if (m_Skyline[currentIndex].m_Y == m_Skyline[currentIndex + 1].m_Y)
+		{
+			m_Skyline[currentIndex].m_Width += m_Skyline[currentIndex + 1].m_Width;
+			m_Skyline.erase(m_Skyline.begin() + currentIndex + 1);
+			continue;
+		}
+
+		++currentIndex;
+	}
+}
+
+
+
+TextureAtlas::TextureAtlas() :
+m_PageSize(0, 0),
+m_TexelPadding(0)
+{
+
+}
+
+
+
+size_t TextureAtlas::AddSourceImage(const char* imageFilePath)
+{
+	for (size_t sourceIndex = 0; sourceIndex < m_Sources.size(); ++sourceIndex)
+	{
+		if (m_Sources[sourceIndex].m_IsImageFile && m_Sources[sourceIndex].m_SourceName == imageFilePath)
+		{
+			return sourceIndex;
+		}
+	}
+
+	TextureAtlasSource atlasSource;
+	atlasSource.m_SourceName = imageFilePath;
+	atlasSource.m_IsImageFile = true;
+	atlasSource.m_TexelSize = IntVector2(0, 0);
+	m_Sources.push_back(atlasSource);
+
+	return m_Sources.size() - 1;
+}
+
+
+
+size_t TextureAtlas::AddSourceTexels(const char* sourceName, const IntVector2& texelSize, const unsigned char* texelData)
+{
+	size_t numberOfBytes = static_cast<size_t>(texelSize.X) * static_cast<size_t>(texelSize.Y) * ATLAS_BYTES_PER_TEXEL;
+
+	TextureAtlasSource atlasSource;
+	atlasSource.m_SourceName = sourceName;
+	atlasSource.m_IsImageFile = false;
+	atlasSource.m_TexelSize = texelSize;
+	atlasSource.m_Texels.assign(texelData, texelData + numberOfBytes);
+	m_Sources.push_back(atlasSource);
+
+	return m_Sources.size() - 1;
+}
+
+
+
+bool TextureAtlas::PackAtlas(const IntVector2& pageSize, int texelPadding)
+{
+	MEMORY_SCOPE("Textures");
+
+	ClearAtlas();
+
+	std::vector<size_t> packingOrder;
+	packingOrder.reserve(m_Sources.size());
+	for (size_t sourceIndex = 0; sourceIndex < m_Sources.size(); ++sourceIndex)
+	{
+		if (m_Sources[sourceIndex].m_Texels.empty() && !LoadSourceTexels(m_Sources[sourceIndex]))
+		{
+			return false;
+		}
+
+		packingOrder.push_back(sourceIndex);
+	}
+
+	std::sort(packingOrder.begin(), packingOrder.end(), [this](size_t firstIndex, size_t secondIndex)
+	{
+		const IntVector2& firstSize = m_Sources[firstIndex].m_TexelSize;
+		const IntVector2& secondSize = m_Sources[secondIndex].m_TexelSize;
+		if (firstSize.Y != secondSize.Y)
+		{
+			return (firstSize.Y > secondSize.Y);
+		}
+
+		return (firstSize.X > secondSize.X);
+	});
+
+	std::vector<SkylinePacker> pagePackers;
+	m_Entries.resize(m_Sources.size());
+	for (size_t sourceIndex : packingOrder)
+	{
+		const IntVector2& sourceSize = m_Sources[sourceIndex].m_TexelSize;
+		IntVector2 paddedSize = IntVector2(sourceSize.X + (2 * texelPadding), sourceSize.Y + (2 * texelPadding));
+
+		IntVector2 paddedPosition;
+		size_t pageIndex = 0;
+		for (; pageIndex < pagePackers.size(); ++pageIndex)
+		{
+			if (pagePackers[pageIndex].PackRectangle(paddedSize, &paddedPosition))
+			{
+				break;
+			}
+		}
+
+		if (pageIndex == pagePackers.size())
+		{
+			IntVector2 newPageSize = IntVector2((paddedSize.X > pageSize.X) ? paddedSize.X : pageSize.X, (paddedSize.Y > pageSize.Y) ? paddedSize.Y : pageSize.Y);
+			pagePackers.emplace_back();
+			pagePackers.back().InitializePacker(newPageSize);
+
+			bool isPacked = pagePackers.back().PackRectangle(paddedSize, &paddedPosition);
+			ASSERT_OR_DIE(isPacked, "Atlas source does not fit into an empty page.");
+		}
+
+		TextureAtlasEntry& atlasEntry = m_Entries[sourceIndex];
+		atlasEntry.m_PageIndex = static_cast<uint32_t>(pageIndex);
+		atlasEntry.m_TexelPosition = IntVector2(paddedPosition.X + texelPadding, paddedPosition.Y + texelPadding);
+		atlasEntry.m_TexelSize = sourceSize;
+	}
+
+	m_PageSize = pageSize;
+	m_TexelPadding = texelPadding;
+
+	m_Pages.resize(pagePackers.size());
+	for (size_t pageIndex = 0; pageIndex < pagePackers.size(); ++pageIndex)
+	{
+		IntVector2 currentPageSize = pagePackers[pageIndex].GetPageSize();
+		m_Pages[pageIndex].m_TexelSize = currentPageSize;
+		m_Pages[pageIndex].m_Texels.assign(static_cast<size_t>(currentPageSize.X) * static_cast<size_t>(currentPageSize.Y) * ATLAS_BYTES_PER_TEXEL, 0);
+	}
+
+	for (size_t sourceIndex = 0; sourceIndex < m_Sources.size(); ++sourceIndex)
+	{
+		TextureAtlasEntry& atlasEntry = m_Entries[sourceIndex];
+		CalculateEntryCoordinates(atlasEntry);
+		CopySourceToPage(m_Sources[sourceIndex], atlasEntry, texelPadding);
+		if (m_Sources[sourceIndex].m_IsImageFile)
+		{
+			std::vector<unsigned char>().swap(m_Sources[sourceIndex].m_Texels);
+		}
+	}
+
+	return true;
+}
+
+
+
+void TextureAtlas::ClearAtlas()
+{
+	m_Entries.clear();
+	m_Pages.clear();
+}
+
+
+
+bool TextureAtlas::SaveAtlasCache(const char* cacheFilePath) const
+{
+	if (m_Pages.empty() || m_Entries.size() != m_Sources.size())
+	{
+		return false;
+	}
+
+	BinaryFileWriter fileWriter;
+	if (!fileWriter.OpenBinaryFile(cacheFilePath))
+	{
+		return false;
+	}
+
+	WriteToStream(fileWriter, CalculateSourceSignature(m_PageSize, m_TexelPadding));
+	fileWriter.CloseBinaryFile();
+
+	return true;
+}
+
+
+
+bool TextureAtlas::LoadAtlasCache(const char* cacheFilePath, const IntVector2& pageSize, int texelPadding)
+{
+	BinaryFileReader fileReader;
+	if (!fileReader.OpenBinaryFile(cacheFilePath))
+	{
+		return false;
+	}
+
+	bool isLoaded = ReadFromStream(fileReader, pageSize, texelPadding);
+	fileReader.CloseBinaryFile();
+
+	if (!isLoaded)
+	{
+		ClearAtlas();
+	}
+
+	return isLoaded;
+}
+
+
+
+size_t TextureAtlas::GetNumberOfSources() const
+{
+	return m_Sources.size();
+}
+
+
+
+size_t TextureAtlas::GetNumberOfPages() const
+{
+	return m_Pages.size();
+}
+
+
+
+const TextureAtlasEntry& TextureAtlas::GetAtlasEntry(size_t sourceIndex) const
+{
+	return m_Entries[sourceIndex];
+}
+
+
+
+const TextureAtlasPage& TextureAtlas::GetAtlasPage(size_t pageIndex) const
+{
+	return m_Pages[pageIndex];
+}
+
+
+
+AABB2 TextureAtlas::RemapTextureCoordinates(const TextureAtlasEntry& atlasEntry, const AABB2& textureCoordinates)
+{
+	Vector2 entryMinimums = atlasEntry.m_TextureCoordinates.minimums;
+	Vector2 entryDimensions = atlasEntry.m_TextureCoordinates.maximums - atlasEntry.m_TextureCoordinates.minimums;
+
+	Vector2 remappedMinimums = Vector2(entryMinimums.X + (textureCoordinates.minimums.X * entryDimensions.X), entryMinimums.Y + (textureCoordinates.minimums.Y * entryDimensions.Y));
+	Vector2 remappedMaximums = Vector2(entryMinimums.X + (textureCoordinates.maximums.X * entryDimensions.X), entryMinimums.Y + (textureCoordinates.maximums.Y * entryDimensions.Y));
+
+	return AABB2(remappedMinimums, remappedMaximums);
+}
+
+
+
+bool TextureAtlas::LoadSourceTexels(TextureAtlasSource& atlasSource) const
+{
+	if (!atlasSource.m_IsImageFile)
+	{
+		return false;
+	}
+
+	int numberOfComponents = 0;
+	unsigned char* imageData = stbi_load(atlasSource.m_SourceName.c_str(), &atlasSource.m_TexelSize.X, &atlasSource.m_TexelSize.Y, &numberOfComponents, static_cast<int>(ATLAS_BYTES_PER_TEXEL));
+	if (imageData == nullptr)
+	{
+		return false;
+	}
+
+	size_t numberOfBytes = static_cast<size_t>(atlasSource.m_TexelSize.X) * static_cast<size_t>(atlasSource.m_TexelSize.Y) * ATLAS_BYTES_PER_TEXEL;
+	atlasSource.m_Texels.assign(imageData, imageData + numberOfBytes);
+	stbi_image_free(imageData);
+
+	return true;
+}
+
+
+
+void TextureAtlas::CalculateEntryCoordinates(TextureAtlasEntry& atlasEntry) const
+{
+	const IntVector2& pageSize = m_Pages[atlasEntry.m_PageIndex].m_TexelSize;
+
+	Vector2 entryMinimums = Vector2(static_cast<float>(atlasEntry.m_TexelPosition.X) / static_cast<float>(pageSize.X), static_cast<float>(atlasEntry.m_TexelPosition.Y) / static_cast<float>(pageSize.Y));
+	Vector2 entryMaximums = Vector2(static_cast<float>(atlasEntry.m_TexelPosition.X + atlasEntry.m_TexelSize.X) / static_cast<float>(pageSize.X), static_cast<float>(atlasEntry.m_TexelPosition.Y + atlasEntry.m_TexelSize.Y) / static_cast<float>(pageSize.Y));
+
+	atlasEntry.m_TextureCoordinates = AABB2(entryMinimums, entryMaximums);
+}
+
+
+
+void TextureAtlas::CopySourceToPage(const TextureAtlasSource& atlasSource, const TextureAtlasEntry& atlasEntry, int texelPadding)
+{
+	TextureAtlasPage& atlasPage = m_Pages[atlasEntry.m_PageIndex];
+	const IntVector2& sourceSize = atlasSource.m_TexelSize;
+
+	for (int pageY = -texelPadding; pageY < sourceSize.Y + texelPadding; ++pageY)
+	{
+		int sourceY = (pageY < 0) ? 0 : ((pageY >= sourceSize.Y) ? sourceSize.Y - 1 : pageY);
+		const unsigned char* sourceRow = atlasSource.m_Texels.data() + (static_cast<size_t>(sourceY) * sourceSize.X * ATLAS_BYTES_PER_TEXEL);
+		unsigned char* pageRow = atlasPage.m_Texels.data() + ((static_cast<size_t>(atlasEntry.m_TexelPosition.Y + pageY) * atlasPage.m_TexelSize.X + atlasEntry.m_TexelPosition.X) * ATLAS_BYTES_PER_TEXEL);
+
+		memcpy(pageRow, sourceRow, static_cast<size_t>(sourceSize.X) * ATLAS_BYTES_PER_TEXEL);
+		for (int paddingX = 1; paddingX <= texelPadding; ++paddingX)
+		{
+			memcpy(pageRow - (paddingX * ATLAS_BYTES_PER_TEXEL), sourceRow, ATLAS_BYTES_PER_TEXEL);
+			memcpy(pageRow + ((sourceSize.X - 1 + paddingX) * ATLAS_BYTES_PER_TEXEL), sourceRow + ((sourceSize.X - 1) * ATLAS_BYTES_PER_TEXEL), ATLAS_BYTES_PER_TEXEL);
+		}
+	}
+}
+
+
+
+uint64_t TextureAtlas::CalculateSourceSignature(const IntVector2& pageSize, int texelPadding) const
+{
+	uint64_t sourceSignature = ATLAS_SIGNATURE_OFFSET_BASIS;
+	sourceSignature = HashAtlasBytes(sourceSignature, &pageSize.X, sizeof(pageSize.X));
+	sourceSignature = HashAtlasBytes(sourceSignature, &pageSize.Y, sizeof(pageSize.Y));
+	sourceSignature = HashAtlasBytes(sourceSignature, &texelPadding, sizeof(texelPadding));
+
+	for (const TextureAtlasSource& atlasSource : m_Sources)
+	{
+		sourceSignature = HashAtlasBytes(sourceSignature, atlasSource.m_SourceName.c_str(), atlasSource.m_SourceName.size() + 1);
+		if (atlasSource.m_IsImageFile)
+		{
+			struct _stat64 fileStatus;
+			if (_stat64(atlasSource.m_SourceName.c_str(), &fileStatus) == 0)
+			{
+				sourceSignature = HashAtlasBytes(sourceSignature, &fileStatus.st_size, sizeof(fileStatus.st_size));
+				sourceSignature = HashAtlasBytes(sourceSignature, &fileStatus.st_mtime, sizeof(fileStatus.st_mtime));
+			}
+		}
+		else
+		{
+			sourceSignature = HashAtlasBytes(sourceSignature, &atlasSource.m_TexelSize.X, sizeof(atlasSource.m_TexelSize.X));
+			sourceSignature = HashAtlasBytes(sourceSignature, &atlasSource.m_TexelSize.Y, sizeof(atlasSource.m_TexelSize.Y));
+			sourceSignature = HashAtlasBytes(sourceSignature, atlasSource.m_Texels.data(), atlasSource.m_Texels.size());
+		}
+	}
+
+	return sourceSignature;
+}
+
+
+
+void TextureAtlas::WriteToStream(const BinaryWriteInterface& streamWriter, uint64_t sourceSignature) const
+{
+	streamWriter.Write<uint32_t>(s_FileVersion);
+	streamWriter.Write<uint64_t>(sourceSignature);
+	streamWriter.Write<uint32_t>(static_cast<uint32_t>(m_Entries.size()));
+	streamWriter.Write<uint32_t>(static_cast<uint32_t>(m_Pages.size()));
+
+	for (const TextureAtlasPage& atlasPage : m_Pages)
+	{
+		streamWriter.Write<int32_t>(atlasPage.m_TexelSize.X);
+		streamWriter.Write<int32_t>(atlasPage.m_TexelSize.Y);
+		streamWriter.WriteBytes(atlasPage.m_Texels.data(), atlasPage.m_Texels.size());
+	}
+
+	for (const TextureAtlasEntry& atlasEntry : m_Entries)
+	{
+		streamWriter.Write<uint32_t>(atlasEntry.m_PageIndex);
+		streamWriter.Write<int32_t>(atlasEntry.m_TexelPosition.X);
+		streamWriter.Write<int32_t>(atlasEntry.m_TexelPosition.Y);
+		streamWriter.Write<int32_t>(atlasEntry.m_TexelSize.X);
+		streamWriter.Write<int32_t>(atlasEntry.m_TexelSize.Y);
+	}
+}
+
+
+
+bool TextureAtlas::ReadFromStream(const BinaryReadInterface& streamReader, const IntVector2& pageSize, int texelPadding)
+{
+	ClearAtlas();
+
+	uint32_t fileVersion = 0U;
+	uint64_t fileSignature = 0U;
+	uint32_t numberOfEntries = 0U;
+	uint32_t numberOfPages = 0U;
+	if (!streamReader.Read<uint32_t>(fileVersion) || fileVersion != s_FileVersion)
+	{
+		return false;
+	}
+
+	if (!streamReader.Read<uint64_t>(fileSignature) || fileSignature != CalculateSourceSignature(pageSize, texelPadding))
+	{
+		return false;
+	}
+
+	if (!streamReader.Read<uint32_t>(numberOfEntries) || !streamReader.Read<uint32_t>(numberOfPages) || numberOfEntries != m_Sources.size() || numberOfPages == 0U)
+	{
+		return false;
+	}
+
+	m_Pages.resize(numberOfPages);
+	for (TextureAtlasPage& atlasPage : m_Pages)
+	{
+		if (!streamReader.Read<int32_t>(atlasPage.m_TexelSize.X) || !streamReader.Read<int32_t>(atlasPage.m_TexelSize.Y) || atlasPage.m_TexelSize.X <= 0 || atlasPage.m_TexelSize.Y <= 0)
+		{
+			return false;
+		}
+
+		atlasPage.m_Texels.resize(static_cast<size_t>(atlasPage.m_TexelSize.X) * static_cast<size_t>(atlasPage.m_TexelSize.Y) * ATLAS_BYTES_PER_TEXEL);
+		if (streamReader.ReadBytes(atlasPage.m_Texels.data(), atlasPage.m_Texels.size()) != atlasPage.m_Texels.size())
+		{
+			return false;
+		}
+	}
+
+	m_Entries.resize(numberOfEntries);
+	for (TextureAtlasEntry& atlasEntry : m_Entries)
+	{
+		bool isEntryRead = streamReader.Read<uint32_t>(atlasEntry.m_PageIndex) &&
+			streamReader.Read<int32_t>(atlasEntry.m_TexelPosition.X) && streamReader.Read<int32_t>(atlasEntry.m_TexelPosition.Y) &&
+			streamReader.Read<int32_t>(atlasEntry.m_TexelSize.X) && streamReader.Read<int32_t>(atlasEntry.m_TexelSize.Y);
+		if (!isEntryRead || atlasEntry.m_PageIndex >= numberOfPages)
+		{
+			return false;
+		}
+
+		CalculateEntryCoordinates(atlasEntry);
+	}
+
+	m_PageSize = pageSize;
+	m_TexelPadding = texelPadding;
+	return true;
+}
+
+
+
+const char* TextureAtlas::FindFailedAtlasCheck()
+{
+	SkylinePacker testPacker;
+	testPacker.InitializePacker(IntVector2(64, 64));
+
+	IntVector2 packedPosition;
+	for (int rectangleIndex = 0; rectangleIndex < 4; ++rectangleIndex)
+	{
+		if (!testPacker.PackRectangle(IntVector2(32, 32), &packedPosition))
+		{
+			return "Four quarter-page rectangles should fill a page exactly.";
+		}
+	}
+
+	if (testPacker.PackRectangle(IntVector2(1, 1), &packedPosition) || testPacker.GetPageOccupancy() != 1.0f)
+	{
+		return "A full page should reject further rectangles.";
+	}
+
+	const int texelPadding = 1;
+	const IntVector2 sourceSizes[] = { IntVector2(10, 20), IntVector2(30, 5), IntVector2(12, 12), IntVector2(40, 40), IntVector2(7, 3), IntVector2(25, 18), IntVector2(80, 16), IntVector2(1, 1) };
+	const size_t numberOfSources = sizeof(sourceSizes) / sizeof(sourceSizes[0]);
+
+	TextureAtlas testAtlas;
+	std::vector<unsigned char> sourceTexels;
+	for (size_t sourceIndex = 0; sourceIndex < numberOfSources; ++sourceIndex)
+	{
+		sourceTexels.assign(static_cast<size_t>(sourceSizes[sourceIndex].X) * static_cast<size_t>(sourceSizes[sourceIndex].Y) * ATLAS_BYTES_PER_TEXEL, static_cast<unsigned char>(sourceIndex + 1));
+		testAtlas.AddSourceTexels(Stringf("TestSource%u", sourceIndex).c_str(), sourceSizes[sourceIndex], sourceTexels.data());
+	}
+
+	if (!testAtlas.PackAtlas(IntVector2(64, 64), texelPadding))
+	{
+		return "Packing in-memory sources should succeed.";
+	}
+
+	if (testAtlas.GetNumberOfPages() < 2U)
+	{
+		return "An oversized source should be given its own page.";
+	}
+
+	for (size_t sourceIndex = 0; sourceIndex < numberOfSources; ++sourceIndex)
+	{
+		const TextureAtlasEntry& atlasEntry = testAtlas.GetAtlasEntry(sourceIndex);
+		const TextureAtlasPage& atlasPage = testAtlas.GetAtlasPage(atlasEntry.m_PageIndex);
+
+		if (atlasEntry.m_TexelPosition.X < texelPadding || atlasEntry.m_TexelPosition.Y < texelPadding ||
+			atlasEntry.m_TexelPosition.X + atlasEntry.m_TexelSize.X + texelPadding > atlasPage.m_TexelSize.X ||
+			atlasEntry.m_TexelPosition.Y + atlasEntry.m_TexelSize.Y + texelPadding > atlasPage.m_TexelSize.Y)
+		{
+			return "Packed sources should stay inside their page with padding.";
+		}
+
+		for (size_t otherIndex = sourceIndex + 1; otherIndex < numberOfSources; ++otherIndex)
+		{
+			const TextureAtlasEntry& otherEntry = testAtlas.GetAtlasEntry(otherIndex);
+			if (otherEntry.m_PageIndex != atlasEntry.m_PageIndex)
+			{
+				continue;
+			}
+
+			bool isSeparated = (atlasEntry.m_TexelPosition.X + atlasEntry.m_TexelSize.X + texelPadding <= otherEntry.m_TexelPosition.X - texelPadding) ||
+				(otherEntry.m_TexelPosition.X + otherEntry.m_TexelSize.X + texelPadding <= atlasEntry.m_TexelPosition.X - texelPadding) ||
+				(atlasEntry.m_TexelPosition.Y + atlasEntry.m_TexelSize.Y + texelPadding <= otherEntry.m_TexelPosition.Y - texelPadding) ||
+				(otherEntry.m_TexelPosition.Y + otherEntry.m_TexelSize.Y + texelPadding <= atlasEntry.m_TexelPosition.Y - texelPadding);
+			if (!isSeparated)
+			{
+				return "Packed sources should not overlap.";
+			}
+		}
+
+		for (int texelY = -texelPadding; texelY < atlasEntry.m_TexelSize.Y + texelPadding; ++texelY)
+		{
+			for (int texelX = -texelPadding; texelX < atlasEntry.m_TexelSize.X + texelPadding; ++texelX)
+			{
+				size_t pageTexelIndex = (static_cast<size_t>(atlasEntry.m_TexelPosition.Y + texelY) * atlasPage.m_TexelSize.X) + (atlasEntry.m_TexelPosition.X + texelX);
+				if (atlasPage.m_Texels[pageTexelIndex * ATLAS_BYTES_PER_TEXEL] != static_cast<unsigned char>(sourceIndex + 1))
+				{
+					return "Page texels should hold the source and its extruded border.";
+				}
+			}
+		}
+
+		AABB2 remappedCoordinates = TextureAtlas::RemapTextureCoordinates(atlasEntry, AABB2::UNIT_AABB2);
+		Vector2 expectedMinimums = Vector2(static_cast<float>(atlasEntry.m_TexelPosition.X) / static_cast<float>(atlasPage.m_TexelSize.X), static_cast<float>(atlasEntry.m_TexelPosition.Y) / static_cast<float>(atlasPage.m_TexelSize.Y));
+		if (remappedCoordinates.minimums.X != expectedMinimums.X || remappedCoordinates.minimums.Y != expectedMinimums.Y)
+		{
+			return "Unit coordinates should map onto the packed texel rectangle.";
+		}
+	}
+
+	return nullptr;
+}
+
+
+
+void TextureAtlasTestCommand(Command& currentCommand)
+{
+	ConsoleLine testMessage;
+
+	if (currentCommand.HasNoArguments())
+	{
+		const char* failedCheck = TextureAtlas::FindFailedAtlasCheck();
+		if (failedCheck == nullptr)
+		{
+			testMessage = ConsoleLine("Texture atlas test passed.", RGBA::GREEN);
+		}
+		else
+		{
+			testMessage = ConsoleLine(Stringf("Texture atlas test failed: %s", failedCheck), RGBA::RED);
+		}
+	}
+	else
+	{
+		testMessage = ConsoleLine("Texture Atlas Test command takes no arguments.", RGBA::RED);
+	}
+
+	DeveloperConsole::AddNewConsoleLine(testMessage);
+}
\ No newline at end of file
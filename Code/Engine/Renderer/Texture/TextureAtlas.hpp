@@ -0,0 +1,124 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "Engine/Math/VectorMath/2D/IntVector2.hpp"
+#include "Engine/Math/VectorMath/2D/AABB2.hpp"
+#include "Engine/IO Utilities/BinaryFileIO.hpp"
+#include "Engine/DeveloperConsole/Command.hpp"
+
+
+
+const int DEFAULT_ATLAS_PAGE_SIZE = 2048;
+const int DEFAULT_ATLAS_TEXEL_PADDING = 2;
+const size_t ATLAS_BYTES_PER_TEXEL = 4;
+
+
+
+struct SkylineNode
+{
+	int m_X;
+	int m_Y;
+	int m_Width;
+};
+
+
+
+class SkylinePacker
+{
+public:
+	SkylinePacker();
+
+	void InitializePacker(const IntVector2& pageSize);
+	bool PackRectangle(const IntVector2& rectangleSize, IntVector2* rectanglePosition);
+
+	IntVector2 GetPageSize() const;
+	float GetPageOccupancy() const;
+
+private:
+	bool FitRectangle(size_t nodeIndex, const IntVector2& rectangleSize, int* rectangleY) const;
+	void AddSkylineLevel(size_t nodeIndex, const IntVector2& rectanglePosition, const IntVector2& rectangleSize);
+
+private:
+	IntVector2 m_PageSize;
+	size_t m_UsedArea;
+	std::vector<SkylineNode> m_Skyline;
+};
+
+
+
+struct TextureAtlasSource
+{
+	std::string m_SourceName;
+	bool m_IsImageFile;
+	IntVector2 m_TexelSize;
+	std::vector<unsigned char> m_Texels;
+};
+
+
+
+struct TextureAtlasEntry
+{
+	uint32_t m_PageIndex;
+	IntVector2 m_TexelPosition;
+	IntVector2 m_TexelSize;
+	AABB2 m_TextureCoordinates;
+};
+
+
+
+struct TextureAtlasPage
+{
+	IntVector2 m_TexelSize;
+	std::vector<unsigned char> m_Texels;
+};
+
+
+
+class TextureAtlas
+{
+public:
+	TextureAtlas();
+
+	size_t AddSourceImage(const char* imageFilePath);
+	size_t AddSourceTexels(const char* sourceName, const IntVector2& texelSize, const unsigned char* texelData);
+
+	bool PackAtlas(const IntVector2& pageSize, int texelPadding);
+	void ClearAtlas();
+
+	bool SaveAtlasCache(const char* cacheFilePath) const;
+	bool LoadAtlasCache(const char* cacheFilePath, const IntVector2& pageSize, int texelPadding);
+
+	size_t GetNumberOfSources() const;
+	size_t GetNumberOfPages() const;
+	const TextureAtlasEntry& GetAtlasEntry(size_t sourceIndex) const;
+	const TextureAtlasPage& GetAtlasPage(size_t pageIndex) const;
+
+	static AABB2 RemapTextureCoordinates(const TextureAtlasEntry& atlasEntry, const AABB2& textureCoordinates);
+	static const char* FindFailedAtlasCheck();
+
+private:
+	bool LoadSourceTexels(TextureAtlasSource& atlasSource) const;
+	void CalculateEntryCoordinates(TextureAtlasEntry& atlasEntry) const;
+	void CopySourceToPage(const TextureAtlasSource& atlasSource, const TextureAtlasEntry& atlasEntry, int texelPadding);
+	uint64_t CalculateSourceSignature(const IntVector2& pageSize, int texelPadding) const;
+
+	void WriteToStream(const BinaryWriteInterface& streamWriter, uint64_t sourceSignature) const;
+	bool ReadFromStream(const BinaryReadInterface& streamReader, const IntVector2& pageSize, int texelPadding);
+
+private:
+	static const uint32_t s_FileVersion;
+
+	std::vector<TextureAtlasSource> m_Sources;
+	std::vector<TextureAtlasEntry> m_Entries;
+	std::vector<TextureAtlasPage> m_Pages;
+
+	IntVector2 m_PageSize;
+	int m_TexelPadding;
+};
+
+
+
+void TextureAtlasTestCommand(Command& currentCommand);
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Engine/ErrorHandling/ErrorWarningAssert.hpp"
 #include "Engine/FileUtilities/FileUtilities.hpp"
 #include "Engine/Time/Clock.hpp"
+#include "Engine/DebugTools/MemoryAnalytics/MemoryTags.hpp"
 
 
 
@@ -194,6 +195,8 @@ UISystem* UISystem::SingletonInstance()
 
 void UISystem::Update()
 {
+	MEMORY_SCOPE("UI");
+
 	float deltaTimeInSeconds = m_UISystemClock->GetDeltaTimeFloat();
 	
 	for (BaseWidget* currentWidget : m_AllWidgets)
@@ -209,13 +212,58 @@ void UISystem::Update()
 
 void UISystem::Render() const
 {
+	RenderRecordTask recordTask;
+	recordTask.m_Recorder = this;
+	recordTask.m_CommandBuffer = &m_CommandBuffer;
+	recordTask.m_LayerID = 0U;
+	recordTask.m_NumberOfVertices = 0U;
+	recordTask.m_NumberOfIndices = 0U;
+
+	m_RecordTasks.clear();
+	m_RecordTasks.push_back(recordTask);
+
+	m_OpenGLRenderBackend.BeginFrame();
+	RecordRenderTasks(m_RecordTasks, &m_OpenGLRenderBackend);
+	m_CommandBuffer.ExecuteCommands(&m_OpenGLRenderBackend);
+	m_OpenGLRenderBackend.EndFrame();
+}
+
+
+
+void UISystem::PrepareCommands(size_t* numberOfVertices, size_t* numberOfIndices) const
+{
+	size_t numberOfWidgets = 0U;
 	for (BaseWidget* currentWidget : m_AllWidgets)
 	{
 		if (currentWidget != nullptr)
 		{
-			currentWidget->Render();
+			++numberOfWidgets;
 		}
 	}
+
+	*numberOfVertices = numberOfWidgets * NUMBER_OF_WIDGET_VERTICES;
+	*numberOfIndices = numberOfWidgets * NUMBER_OF_WIDGET_INDICES;
+}
+
+
+
+void UISystem::RecordCommands(RenderCommandBuffer& commandBuffer, uint8_t layerID) const
+{
+	commandBuffer.PushCameraMatrices(commandBuffer.GetNextSortKey(layerID));
+
+	Matrix4 viewMatrix = Matrix4::IdentityMatrix4();
+	Matrix4 projectionMatrix = AdvancedRenderer::SingletonInstance()->GetOrthographicProjectionMatrix(Vector2::ZERO, m_ViewDimensions, -1.0f, 1.0f);
+	commandBuffer.SetCameraMatrices(commandBuffer.GetNextSortKey(layerID), viewMatrix, projectionMatrix);
+
+	for (BaseWidget* currentWidget : m_AllWidgets)
+	{
+		if (currentWidget != nullptr)
+		{
+			currentWidget->Render(commandBuffer, layerID);
+		}
+	}
+
+	commandBuffer.PopCameraMatrices(commandBuffer.GetNextSortKey(layerID));
 }
 
 
@@ -4,6 +4,7 @@
 
 #include "Engine/Renderer/UISystem/Widgets/BaseWidget.hpp"
 #include "Engine/Renderer/UISystem/WidgetProperty.hpp"
+#include "Engine/Renderer/RenderUtilities/RenderCommandBuffer.hpp"
 
 
 
@@ -11,7 +12,7 @@ class Clock;
 
 
 
-class UISystem
+class UISystem : public RenderCommandRecorder
 {
 private:
 	UISystem(const Vector2& viewDimensions);
@@ -31,6 +32,8 @@ public:
 
 	void Update();
 	void Render() const;
+	virtual void PrepareCommands(size_t* numberOfVertices, size_t* numberOfIndices) const override;
+	virtual void RecordCommands(RenderCommandBuffer& commandBuffer, uint8_t layerID) const override;
 
 	Vector2 GetOriginForAnchorPoint(uint8_t anchorPoint);
 	Material* GetDefaultMaterial() const;
@@ -45,4 +48,8 @@ public:
 
 private:
 	Material* m_DefaultMaterial;
+
+	mutable RenderCommandBuffer m_CommandBuffer;
+	mutable std::vector<RenderRecordTask> m_RecordTasks;
+	mutable OpenGLRenderBackend m_OpenGLRenderBackend;
 };
\ No newline at end of file
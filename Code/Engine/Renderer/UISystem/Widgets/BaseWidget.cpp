@@ -361,13 +361,16 @@ void BaseWidget::HandleClickingOnEvent(const AABB2& widgetBounds)
 
 
 
-void BaseWidget::RenderWidget(const AABB2& widgetBounds) const
+void BaseWidget::RenderWidget(RenderCommandBuffer& commandBuffer, uint8_t layerID, const AABB2& widgetBounds) const
 {
-	const size_t NUMBER_OF_WIDGET_VERTICES = 4U;
-	const size_t NUMBER_OF_WIDGET_INDICES = 6U;
+	StreamingMeshAllocation widgetAllocation;
+	if (!commandBuffer.AllocateTransientMesh(NUMBER_OF_WIDGET_VERTICES, NUMBER_OF_WIDGET_INDICES, &widgetAllocation))
+	{
+		return;
+	}
 
-	Vertex3D widgetVertices[NUMBER_OF_WIDGET_VERTICES];
-	uint32_t widgetIndices[NUMBER_OF_WIDGET_INDICES] = { 0, 1, 2, 0, 2, 3 };
+	Vertex3D* widgetVertices = widgetAllocation.m_Vertices;
+	uint32_t* widgetIndices = widgetAllocation.m_Indices;
 
 	RGBA widgetTint = GetStateSpecificWidgetProperty<RGBA>("TextureTint");
 	Vector2 textureMinimums = GetStateSpecificWidgetProperty<Vector2>("TextureMinimums");
@@ -392,18 +395,21 @@ void BaseWidget::RenderWidget(const AABB2& widgetBounds) const
 	widgetVertex.m_TextureCoordinates = Vector2(textureMinimums.X, textureMinimums.Y);
 	widgetVertices[3] = widgetVertex;
 
-	Mesh widgetMesh;
-	widgetMesh.WriteToMesh(&widgetVertices[0], &widgetIndices[0], NUMBER_OF_WIDGET_VERTICES, NUMBER_OF_WIDGET_INDICES);
+	widgetIndices[0] = 0;
+	widgetIndices[1] = 1;
+	widgetIndices[2] = 2;
+	widgetIndices[3] = 0;
+	widgetIndices[4] = 2;
+	widgetIndices[5] = 3;
 
 	Material* widgetMaterial = nullptr;
 	Texture* widgetTexture = GetWidgetTexture();
 	if (widgetTexture != nullptr)
 	{
 		widgetMaterial = UISystem::SingletonInstance()->GetDefaultMaterial();
-		widgetMaterial->SetDiffuseTexture(widgetTexture);
 	}
 
-	AdvancedRenderer::SingletonInstance()->DrawPolygonMesh(&widgetMesh, NUMBER_OF_WIDGET_VERTICES, NUMBER_OF_WIDGET_INDICES, widgetMaterial);
+	commandBuffer.DrawTransientMesh(commandBuffer.GetNextSortKey(layerID), widgetAllocation, widgetMaterial, widgetTexture);
 }
 
 
@@ -10,6 +10,7 @@
 #include "Engine/Math/VectorMath/3D/IntVector3.hpp"
 #include "Engine/Math/VectorMath/4D/IntVector4.hpp"
 #include "Engine/Renderer/RenderUtilities/AdvancedRenderer.hpp"
+#include "Engine/Renderer/RenderUtilities/RenderCommandBuffer.hpp"
 
 #include "Engine/Math/VectorMath/2D/AABB2.hpp"
 #include "Engine/EventSystem/NamedProperties.hpp"
@@ -17,6 +18,11 @@
 
 
 
+const size_t NUMBER_OF_WIDGET_VERTICES = 4U;
+const size_t NUMBER_OF_WIDGET_INDICES = 6U;
+
+
+
 enum AnchorPoint : uint8_t
 {
 	TOP_LEFT,
@@ -50,7 +56,7 @@ public:
 	virtual ~BaseWidget();
 
 	virtual void Update(float) = 0;
-	virtual void Render() const = 0;
+	virtual void Render(RenderCommandBuffer& commandBuffer, uint8_t layerID) const = 0;
 
 	Vector2 GetWorldPosition() const;
 	float GetWorldRotation() const;
@@ -90,7 +96,7 @@ public:
 
 protected:
 	virtual void HandleClickingOnEvent(const AABB2& widgetBounds);
-	virtual void RenderWidget(const AABB2& widgetBounds) const;
+	virtual void RenderWidget(RenderCommandBuffer& commandBuffer, uint8_t layerID, const AABB2& widgetBounds) const;
 	virtual void TriggerOnClickEvent() const;
 
 private:
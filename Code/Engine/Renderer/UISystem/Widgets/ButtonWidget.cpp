@@ -47,7 +47,7 @@ void ButtonWidget::Update(float)
 
 
 
-void ButtonWidget::Render() const
+void ButtonWidget::Render(RenderCommandBuffer& commandBuffer, uint8_t layerID) const
 {
 	if (IsWidgetHidden())
 	{
@@ -65,18 +65,18 @@ void ButtonWidget::Render() const
 	Vector2 buttonTextDimensions = Vector2(textWidth, textHeight);
 	ResizeButtonWithText(buttonBounds, buttonTextDimensions);
 
-	RenderWidget(buttonBounds);
-	RenderButtonText(buttonFont, textString, buttonTextDimensions);
+	RenderWidget(commandBuffer, layerID, buttonBounds);
+	RenderButtonText(commandBuffer, layerID, buttonFont, textString, buttonTextDimensions);
 }
 
 
 
-void ButtonWidget::RenderButtonText(ProportionalFont* buttonTextFont, const std::string& buttonTextString, const Vector2& buttonTextDimensions) const
+void ButtonWidget::RenderButtonText(RenderCommandBuffer& commandBuffer, uint8_t layerID, ProportionalFont* buttonTextFont, const std::string& buttonTextString, const Vector2& buttonTextDimensions) const
 {
 	RGBA fontColor = GetStateSpecificWidgetProperty<RGBA>("FontColor");
 	Vector2 textMinimums = GetWorldPosition() - (buttonTextDimensions * 0.5f);
 
-	AdvancedRenderer::SingletonInstance()->Draw2DProportionalText(textMinimums, buttonTextString.c_str(), buttonTextDimensions.Y, buttonTextFont, fontColor);
+	commandBuffer.DrawProportionalText(commandBuffer.GetNextSortKey(layerID), textMinimums, buttonTextString.c_str(), buttonTextDimensions.Y, buttonTextFont, fontColor);
 }
 
 
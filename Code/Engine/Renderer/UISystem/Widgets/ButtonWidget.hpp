@@ -11,9 +11,9 @@ public:
 	~ButtonWidget();
 
 	void Update(float) override;
-	void Render() const override;
+	void Render(RenderCommandBuffer& commandBuffer, uint8_t layerID) const override;
 
 private:
-	void RenderButtonText(ProportionalFont* buttonTextFont, const std::string& buttonTextString, const Vector2& buttonTextDimensions) const;
+	void RenderButtonText(RenderCommandBuffer& commandBuffer, uint8_t layerID, ProportionalFont* buttonTextFont, const std::string& buttonTextString, const Vector2& buttonTextDimensions) const;
 	void ResizeButtonWithText(AABB2& buttonBounds, const Vector2& buttonTextDimensions) const;
 };
\ No newline at end of file
@@ -39,24 +39,36 @@ double GetCurrentTimeInMilliseconds()
 
 TimeStampData GetTimeStampForCurrentTime()
 {
-	tm* currentTime = new tm();
-	time_t timeHandle = time(NULL);
-	errno_t success = localtime_s(currentTime, &timeHandle);
+	return GetTimeStampForRawTime(GetRawTimeForCurrentTime());
+}
+
+
+
+int64_t GetRawTimeForCurrentTime()
+{
+	return static_cast<int64_t>(time(NULL));
+}
+
+
+
+TimeStampData GetTimeStampForRawTime(int64_t rawTime)
+{
+	tm currentTime;
+	time_t timeHandle = static_cast<time_t>(rawTime);
+	errno_t success = localtime_s(&currentTime, &timeHandle);
 
 	TimeStampData currentTimeStamp = TimeStampData();
 
 	if (success == 0)
 	{
-		currentTimeStamp.m_Year = currentTime->tm_year + 1900;
-		currentTimeStamp.m_Month = currentTime->tm_mon + 1;
-		currentTimeStamp.m_Day = currentTime->tm_mday;
+		currentTimeStamp.m_Year = currentTime.tm_year + 1900;
+		currentTimeStamp.m_Month = currentTime.tm_mon + 1;
+		currentTimeStamp.m_Day = currentTime.tm_mday;
 
-		currentTimeStamp.m_Hour = currentTime->tm_hour;
-		currentTimeStamp.m_Minute = currentTime->tm_min;
-		currentTimeStamp.m_Second = currentTime->tm_sec;
+		currentTimeStamp.m_Hour = currentTime.tm_hour;
+		currentTimeStamp.m_Minute = currentTime.tm_min;
+		currentTimeStamp.m_Second = currentTime.tm_sec;
 	}
 
-	delete currentTime;
-
 	return currentTimeStamp;
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 
 
 struct TimeStampData
@@ -17,4 +19,7 @@ struct TimeStampData
 
 double GetCurrentTimeInSeconds();
 double GetCurrentTimeInMilliseconds();
-TimeStampData GetTimeStampForCurrentTime();
\ No newline at end of file
+TimeStampData GetTimeStampForCurrentTime();
+
+int64_t GetRawTimeForCurrentTime();
+TimeStampData GetTimeStampForRawTime(int64_t rawTime);
\ No newline at end of file